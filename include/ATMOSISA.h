@@ -1,13 +1,19 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <stdexcept>
+#include <algorithm>
 #include <array>
 #include <tuple>
 #include <vector>
 
 namespace Atmosphere {
 
+class ISATable;
+
 /**
  * @brief International Standard Atmosphere (ISA) Calculator - FULL VERSION
  * 
@@ -100,35 +106,42 @@ public:
      * @brief Calculate only temperature at given altitude
      */
     static inline double temperature(double h) {
-        return calculate(h).T;
+        const double H = checkedGeopotential(h);
+        return calculateTemperature(H, getLayer(H));
     }
     
     /**
      * @brief Calculate only speed of sound at given altitude
      */
     static inline double speedOfSound(double h) {
-        return calculate(h).a;
+        return std::sqrt(gamma * R * temperature(h));
     }
     
     /**
      * @brief Calculate only pressure at given altitude
      */
     static inline double pressure(double h) {
-        return calculate(h).P;
+        const double H = checkedGeopotential(h);
+        const int layer = getLayer(H);
+        return calculatePressure(H, calculateTemperature(H, layer), layer);
     }
     
     /**
      * @brief Calculate only density at given altitude
      */
     static inline double density(double h) {
-        return calculate(h).rho;
+        const double H = checkedGeopotential(h);
+        const int layer = getLayer(H);
+        const double T = calculateTemperature(H, layer);
+        return calculatePressure(H, T, layer) / (R * T);
     }
     
     /**
      * @brief Calculate only dynamic viscosity at given altitude
      */
     static inline double viscosity(double h) {
-        return calculate(h).mu;
+        const double T = temperature(h);
+        return C1 * std::pow(T, 1.5) / (T + S);
     }
     
     /**
@@ -142,17 +155,191 @@ public:
      * @brief Calculate pressure ratio at given altitude
      */
     static inline double pressureRatio(double h) {
-        return calculate(h).delta;
+        return pressure(h) / P0;
     }
 
     /**
      * @brief Calculate density ratio at given altitude
      */
     static inline double densityRatio(double h) {
-        return calculate(h).sigma;
+        return density(h) / rho0;
+    }
+
+    /**
+     * @brief Output arrays of the batch kernel (structure of arrays)
+     *
+     * Each pointer, when not null, must address n doubles; only the requested
+     * properties are computed and written.
+     */
+    struct BatchOutput {
+        double* T = nullptr;        // Temperature [K]
+        double* a = nullptr;        // Speed of sound [m/s]
+        double* P = nullptr;        // Pressure [Pa]
+        double* rho = nullptr;      // Density [kg/m³]
+        double* mu = nullptr;       // Dynamic viscosity [Pa·s]
+        double* nu = nullptr;       // Kinematic viscosity [m²/s]
+        double* delta = nullptr;    // Pressure ratio P/P0 [-]
+        double* theta = nullptr;    // Temperature ratio T/T0 [-]
+        double* sigma = nullptr;    // Density ratio rho/rho0 [-]
+    };
+
+    /**
+     * @brief Batch kernel: atmospheric properties at n altitudes
+     *
+     * The layer is selected without branches (sum of comparisons with the
+     * layer bases) and the isothermal and gradient pressure laws are merged
+     * into a single expression, so the loop body is straight-line code that
+     * the compiler can vectorize.
+     *
+     * @param h Geometric altitudes [m] (range: -5000 to 86000)
+     * @param n Number of altitudes
+     * @param out Output arrays; null pointers are skipped
+     * @throws std::out_of_range if any altitude is outside valid range (nothing is written)
+     */
+    static inline void calculate(const double* h, size_t n, const BatchOutput& out) {
+        for (size_t i = 0; i < n; ++i) {
+            if (!(h[i] >= hMin && h[i] <= hMax)) {
+                throw std::out_of_range("Altitude must be between -5000 m and 86000 m");
+            }
+        }
+        kernel(h, n, out, nullptr);
+    }
+
+    /**
+     * @brief Non-throwing batch kernel with a status mask
+     *
+     * Altitudes outside the valid range (or NaN) get status 0 and NaN in every
+     * requested output; valid altitudes get status 1.
+     *
+     * @param h Geometric altitudes [m]
+     * @param n Number of altitudes
+     * @param out Output arrays; null pointers are skipped
+     * @param status n flags (written), may be null
+     * @return size_t Number of valid altitudes
+     */
+    static inline size_t tryCalculate(const double* h, size_t n, const BatchOutput& out,
+                                      std::uint8_t* status) noexcept {
+        return kernel(h, n, out, status);
+    }
+
+    /**
+     * @brief Batch kernel on a vector of altitudes
+     */
+    static inline void calculate(const std::vector<double>& h, const BatchOutput& out) {
+        calculate(h.data(), h.size(), out);
+    }
+
+    /**
+     * @brief Pressure altitude: ISA altitude at which the pressure equals P
+     *
+     * Closed-form inverse of the layer pressure laws, no iteration.
+     *
+     * @param P Static pressure [Pa]
+     * @return double Geometric pressure altitude [m]
+     * @throws std::out_of_range if P is outside the pressures of -5000 m to 86000 m
+     */
+    static inline double pressureAltitude(double P) {
+        return checkedAltitude(inverse(P, P_base, p_exp));
+    }
+
+    /**
+     * @brief Density altitude: ISA altitude at which the density equals rho
+     *
+     * @param rho Density [kg/m³]
+     * @return double Geometric density altitude [m]
+     * @throws std::out_of_range if rho is outside the densities of -5000 m to 86000 m
+     */
+    static inline double densityAltitude(double rho) {
+        return checkedAltitude(inverse(rho, rho_base, rho_exp));
+    }
+
+    /**
+     * @brief Density altitude of an off-standard (ISA + deltaT) day
+     *
+     * The pressure at a pressure altitude is the standard one and the
+     * temperature is T_ISA + deltaT (same convention as ISATable).
+     *
+     * @param pressureAltitude Geometric pressure altitude [m]
+     * @param deltaT Temperature offset from ISA [K]
+     * @return double Geometric density altitude [m]
+     */
+    static inline double densityAltitude(double pressureAltitude, double deltaT) {
+        const double H = checkedGeopotential(pressureAltitude);
+        const int layer = getLayer(H);
+        const double T = calculateTemperature(H, layer);
+        return densityAltitude(calculatePressure(H, T, layer) / (R * (T + deltaT)));
+    }
+
+    /**
+     * @brief Temperature offset from ISA of a measured pressure and temperature
+     *
+     * @param P Static pressure [Pa]
+     * @param T Static (outside air) temperature [K]
+     * @return double T - T_ISA(pressure altitude) [K]
+     */
+    static inline double temperatureOffset(double P, double T) {
+        const double H = geometricToGeopotential(pressureAltitude(P));
+        return T - calculateTemperature(H, getLayer(H));
+    }
+
+    /**
+     * @brief Vectorized pressure altitude
+     *
+     * Non-throwing: invalid pressures give NaN and status 0.
+     *
+     * @param P n static pressures [Pa]
+     * @param h n pressure altitudes [m] (written)
+     * @param n Number of samples
+     * @param status n flags (written), may be null
+     * @return size_t Number of valid samples
+     */
+    static inline size_t pressureAltitude(const double* P, double* h, size_t n,
+                                          std::uint8_t* status = nullptr) noexcept {
+        return inverse(P, h, n, status, P_base, p_exp);
+    }
+
+    /**
+     * @brief Vectorized density altitude (non-throwing, as above)
+     *
+     * @param rho n densities [kg/m³]
+     * @param h n density altitudes [m] (written)
+     * @param n Number of samples
+     * @param status n flags (written), may be null
+     * @return size_t Number of valid samples
+     */
+    static inline size_t densityAltitude(const double* rho, double* h, size_t n,
+                                         std::uint8_t* status = nullptr) noexcept {
+        return inverse(rho, h, n, status, rho_base, rho_exp);
+    }
+
+    /**
+     * @brief Vectorized density altitude from measured pressure and temperature
+     *
+     * Non-throwing, as above. Used for flight-test data where the static
+     * pressure and the outside air temperature are recorded.
+     *
+     * @param P n static pressures [Pa]
+     * @param T n static temperatures [K]
+     * @param h n density altitudes [m] (written)
+     * @param n Number of samples
+     * @param status n flags (written), may be null
+     * @return size_t Number of valid samples
+     */
+    static inline size_t densityAltitude(const double* P, const double* T, double* h, size_t n,
+                                         std::uint8_t* status = nullptr) noexcept {
+        size_t valid = 0;
+        for (size_t i = 0; i < n; ++i) {
+            h[i] = inverse(P[i] / (R * T[i]), rho_base, rho_exp);
+            const bool ok = !std::isnan(h[i]);
+            if (status) status[i] = ok ? 1 : 0;
+            valid += ok ? 1 : 0;
+        }
+        return valid;
     }
     
 private:
+    friend class ISATable;   // Lookup table built on the same layer data
+
     // Layer boundaries (geopotential altitude) [m]
     static constexpr std::array<double, 9> H_base = {
         -5000.0,    // Layer 0: Below sea level
@@ -205,6 +392,166 @@ private:
         0.373384    // Layer 8
     };
     
+    // Valid geometric altitude range [m]
+    static constexpr double hMin = -5000.0;
+    static constexpr double hMax = 86000.0;
+
+    // Pressure law of each layer in the form P = P_b * exp(k_log * ln(T/T_b) + k_lin * dH):
+    // gradient layers use k_log = g0/(R L), isothermal layers k_lin = -g0/(R T_b)
+    static constexpr std::array<double, 9> k_log = {
+        g0 / (R * 0.0065),      // Layer 0
+        g0 / (R * 0.0065),      // Layer 1
+        0.0,                    // Layer 2 (isothermal)
+        g0 / (R * -0.001),      // Layer 3
+        g0 / (R * -0.0028),     // Layer 4
+        0.0,                    // Layer 5 (isothermal)
+        g0 / (R * 0.0028),      // Layer 6
+        g0 / (R * 0.002),       // Layer 7
+        0.0                     // Layer 8 (isothermal)
+    };
+    static constexpr std::array<double, 9> k_lin = {
+        0.0, 0.0, -g0 / (R * 216.65),
+        0.0, 0.0, -g0 / (R * 270.65),
+        0.0, 0.0, -g0 / (R * 186.946)
+    };
+
+    // Base densities [kg/m³], rho_b = P_b / (R T_b)
+    static constexpr std::array<double, 9> rho_base = {
+        177687.0 / (R * 320.65),  101325.0 / (R * 288.15),  22632.1 / (R * 216.65),
+        5474.89 / (R * 216.65),   868.019 / (R * 228.65),   110.906 / (R * 270.65),
+        66.9389 / (R * 270.65),   3.95642 / (R * 214.65),   0.373384 / (R * 186.946)
+    };
+
+    // Inverse laws of each layer, with r = P/P_b (or rho/rho_b):
+    //   gradient layers   : T/T_b = r^e  ->  dH = (T_b / L) (1 - r^e)
+    //   isothermal layers : dH = -(R T_b / g0) ln(r)
+    // written as dH = inv_a (1 - exp(e ln r)) + inv_b ln r, with e = R L / g0 for the
+    // pressure and e = R L / (g0 - R L) for the density
+    static constexpr std::array<double, 9> p_exp = {
+        R * 0.0065 / g0,  R * 0.0065 / g0,  0.0,
+        R * -0.001 / g0,  R * -0.0028 / g0, 0.0,
+        R * 0.0028 / g0,  R * 0.002 / g0,   0.0
+    };
+    static constexpr std::array<double, 9> rho_exp = {
+        R * 0.0065 / (g0 - R * 0.0065),  R * 0.0065 / (g0 - R * 0.0065),  0.0,
+        R * -0.001 / (g0 + R * 0.001),   R * -0.0028 / (g0 + R * 0.0028), 0.0,
+        R * 0.0028 / (g0 - R * 0.0028),  R * 0.002 / (g0 - R * 0.002),    0.0
+    };
+    static constexpr std::array<double, 9> inv_a = {
+        320.65 / 0.0065,  288.15 / 0.0065,  0.0,
+        216.65 / -0.001,  228.65 / -0.0028, 0.0,
+        270.65 / 0.0028,  214.65 / 0.002,   0.0
+    };
+    static constexpr std::array<double, 9> inv_b = {
+        0.0, 0.0, -R * 216.65 / g0,
+        0.0, 0.0, -R * 270.65 / g0,
+        0.0, 0.0, -R * 186.946 / g0
+    };
+
+    /**
+     * @brief Closed-form inverse of a monotonically decreasing layer law
+     *
+     * The layer is selected by counting the base values not smaller than the
+     * query (no branches); out-of-range or non-positive queries give NaN.
+     *
+     * @param value Pressure or density
+     * @param base Base values of the layers (P_base or rho_base)
+     * @param exponent Exponent e of the gradient layers (p_exp or rho_exp)
+     * @return double Geometric altitude [m], NaN if outside -5000 m to 86000 m
+     */
+    static inline double inverse(double value, const std::array<double, 9>& base,
+                                 const std::array<double, 9>& exponent) noexcept {
+        int layer = 0;
+        for (int k = 1; k < 9; ++k) layer += (value <= base[k]);
+
+        const double lr = std::log(value / base[layer]);
+        const double dH = inv_a[layer] * (1.0 - std::exp(exponent[layer] * lr)) + inv_b[layer] * lr;
+        const double H = H_base[layer] + dH;
+        const double h = R_earth * H / (R_earth - H);
+
+        // Tolleranza per gli arrotondamenti agli estremi dell'intervallo
+        const bool ok = (value > 0.0) && (h >= hMin - 1e-6) && (h <= hMax + 1e-6);
+        return ok ? std::clamp(h, hMin, hMax) : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    static inline size_t inverse(const double* value, double* h, size_t n, std::uint8_t* status,
+                                 const std::array<double, 9>& base,
+                                 const std::array<double, 9>& exponent) noexcept {
+        size_t valid = 0;
+        for (size_t i = 0; i < n; ++i) {
+            h[i] = inverse(value[i], base, exponent);
+            const bool ok = !std::isnan(h[i]);
+            if (status) status[i] = ok ? 1 : 0;
+            valid += ok ? 1 : 0;
+        }
+        return valid;
+    }
+
+    /**
+     * @brief Throw if an inverse query fell outside the valid range
+     */
+    static inline double checkedAltitude(double h) {
+        if (std::isnan(h)) {
+            throw std::out_of_range("Value outside the ISA range (-5000 m to 86000 m)");
+        }
+        return h;
+    }
+
+    /**
+     * @brief Shared body of the batch kernels
+     *
+     * Out-of-range altitudes are clamped for the arithmetic (so no branch is
+     * needed in the loop) and their outputs replaced by NaN at the end.
+     */
+    static inline size_t kernel(const double* h, size_t n, const BatchOutput& out,
+                                std::uint8_t* status) noexcept {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        size_t valid = 0;
+
+        for (size_t i = 0; i < n; ++i) {
+            const bool ok = (h[i] >= hMin && h[i] <= hMax);
+            const double hc = ok ? h[i] : 0.0;
+            const double H = geometricToGeopotential(hc);
+
+            // Selezione dello strato senza salti: somma dei confronti con le quote di base
+            int layer = 0;
+            for (int k = 1; k < 9; ++k) layer += (H >= H_base[k]);
+
+            const double dH = H - H_base[layer];
+            const double T = T_base[layer] - lapse_rate[layer] * dH;
+            const double P = P_base[layer] * std::exp(k_log[layer] * std::log(T / T_base[layer]) + k_lin[layer] * dH);
+            const double rho = P / (R * T);
+            const double bad = ok ? 0.0 : nan;   // NaN si propaga nelle uscite non valide
+
+            if (out.T)     out.T[i]     = T + bad;
+            if (out.theta) out.theta[i] = T / T0 + bad;
+            if (out.a)     out.a[i]     = std::sqrt(gamma * R * T) + bad;
+            if (out.P)     out.P[i]     = P + bad;
+            if (out.delta) out.delta[i] = P / P0 + bad;
+            if (out.rho)   out.rho[i]   = rho + bad;
+            if (out.sigma) out.sigma[i] = rho / rho0 + bad;
+            if (out.mu || out.nu) {
+                const double mu = C1 * T * std::sqrt(T) / (T + S);
+                if (out.mu) out.mu[i] = mu + bad;
+                if (out.nu) out.nu[i] = mu / rho + bad;
+            }
+
+            if (status) status[i] = ok ? 1 : 0;
+            valid += ok ? 1 : 0;
+        }
+        return valid;
+    }
+
+    /**
+     * @brief Validate the altitude and convert it to geopotential altitude
+     */
+    static inline double checkedGeopotential(double h) {
+        if (h < hMin || h > hMax) {
+            throw std::out_of_range("Altitude must be between -5000 m and 86000 m");
+        }
+        return geometricToGeopotential(h);
+    }
+
     /**
      * @brief Convert geometric altitude to geopotential altitude
      */
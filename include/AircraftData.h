@@ -6,6 +6,7 @@
 #include <map>
 #include <stdexcept>
 #include "RegressionMethod.h"
+#include "RegressionModel.h"
 #include "Interpolant.h"
 
 namespace AERO {
@@ -17,12 +18,15 @@ struct InterpolableVariable {
     std::string yLabel;               // Y axis label, e.g.: "bodyLengthToFuselageOverallLength"
     std::string xUnit;                // X unit, e.g.: "kg"
     std::string yUnit;                // Y unit, e.g.: "adim", "m", etc.
+    std::string chartFlag;            // Chart flag from the workbook, "Yes" to plot the regression
     RegressionMethod method;          // Regression/interpolation method (POLYNOMIAL, LINEAR, etc.)
     int polynomialDegree;             // Polynomial degree for regression
     
     std::vector<double> xData;        // X data already converted
     std::vector<double> yData;        // Y data already converted
-    std::vector<double> coefficients; // Interpolation coefficients
+    std::vector<double> coefficients; // Interpolation coefficients, layout of Interpolant::getCoefficients()
+    RegressionModel model;            // Fitted model, evaluated by interpolate()
+    bool fitted = false;              // True once fit() has been called on the current data
     
     // Checks if the variable is valid (X and Y data are not empty and have the same size)
     /**
@@ -41,21 +45,104 @@ struct InterpolableVariable {
     int getNumDataPoints() const {
         return xData.size();
     }
+
+    // Fits the regression once and stores the resulting model
+    /**
+     * @brief Fits the regression on xData/yData and stores model and coefficients.
+     *
+     * Called by ExcelReader when the variable is loaded; call it again if xData,
+     * yData, method or polynomialDegree are changed afterwards.
+     */
+    void fit() {
+        if (method == RegressionMethod::CONSTANT) {
+            model = RegressionModel{method, {}};
+            coefficients.clear();
+        } else {
+            Interpolant interp(xData, yData, polynomialDegree, method);
+            model = interp.getModel();
+            coefficients = model.monomialCoefficients();
+        }
+        fitted = true;
+    }
     
     // Method to interpolate a new value given xValue
     /**
      * @brief Interpolates the variable for a given X value.
+     *
+     * When the variable has been fitted this is a pure O(degree) evaluation of the
+     * stored model; otherwise the regression is computed on the fly.
+     *
      * @param xValue Query X value.
      * @return Interpolated Y value.
      */
     double interpolate(double xValue) const {
 
-        // Creates an Interpolant object with the current data and settings - The header is Interpolant.h which already contains everything
+        if (fitted) {
+            return model.evaluate(xValue);
+        }
+
+        // Not fitted yet: creates an Interpolant object with the current data and settings
         Interpolant interp(xData, yData, polynomialDegree, method);
         return interp.getYValueFromRegression(xValue);
     }
 };
 
+// Lightweight handle to an interpolable variable
+// Resolves the variable name once (ComponentData::getHandle) so that hot loops
+// can evaluate the regression without repeating the std::map lookup.
+// The handle stays valid as long as the ComponentData it was obtained from
+// is alive and its 'variables' map is not modified.
+class VariableHandle {
+private:
+    const InterpolableVariable* variable = nullptr;
+
+public:
+    VariableHandle() = default;
+
+    /**
+     * @brief Creates a handle bound to an existing variable.
+     * @param var Variable to bind.
+     */
+    explicit VariableHandle(const InterpolableVariable& var) : variable(&var) {}
+
+    /**
+     * @brief Checks whether the handle is bound to a variable.
+     * @return true if the handle can be used.
+     */
+    bool isValid() const {
+        return variable != nullptr;
+    }
+
+    /**
+     * @brief Returns the bound variable.
+     * @return Constant reference to the variable.
+     */
+    const InterpolableVariable& get() const {
+        return *variable;
+    }
+
+    /**
+     * @brief Interpolates the bound variable for a given X value.
+     * @param xValue Query X value.
+     * @return Interpolated Y value.
+     */
+    double interpolate(double xValue) const {
+        return variable->interpolate(xValue);
+    }
+
+    /**
+     * @brief Interpolates the bound variable for n X values.
+     * @param xValues Pointer to n query X values.
+     * @param yValues Pointer to n output values (written).
+     * @param n Number of query values.
+     */
+    void interpolate(const double* xValues, double* yValues, size_t n) const {
+        for (size_t i = 0; i < n; ++i) {
+            yValues[i] = variable->interpolate(xValues[i]);
+        }
+    }
+};
+
 // Structure representing the data of an aircraft component
 // Each ComponentData object contains:
 // - The name of the component (e.g.: "FUSELAGE", "WING", etc.)
@@ -98,6 +185,17 @@ struct ComponentData {
         return variables.find(varName) != variables.end();
     }
     
+    // Resolves a variable name once and returns a handle for repeated evaluation
+    /**
+     * @brief Returns a handle to a variable, resolving its name once.
+     * @param varName Variable key.
+     * @return Handle bound to the requested variable.
+     * @throws std::out_of_range If the variable is not found.
+     */
+    VariableHandle getHandle(const std::string& varName) const {
+        return VariableHandle(getVariable(varName));
+    }
+    
     // Returns the list of available variable names
     /**
      * @brief Returns the list of available variable names.
@@ -141,6 +239,9 @@ struct ComponentData {
      */
     void getChartOfVariableRegression(const std::string& varName, std::string enableChart, std::string aircraftName) const {
         const InterpolableVariable& var = getVariable(varName);
+        if (enableChart != "Yes") {
+            return; // Nessun grafico richiesto: evita di rifare il fit (es. dati caricati dalla cache)
+        }
         Interpolant interp(var.xData, var.yData, var.polynomialDegree, var.method);
         interp.getChartOfRegression(var.xLabel, var.yLabel, var.xUnit, var.yUnit, enableChart,aircraftName);
     }
@@ -0,0 +1,406 @@
+#ifndef AIRCRAFTDATACACHE_H
+#define AIRCRAFTDATACACHE_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+#include <type_traits>
+#include "AircraftData.h"
+#include "RegressionMethod.h"
+#include "RegressionModel.h"
+#include "FNV1AHASH.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace AERO {
+
+// Binary cache of the aircraft data read from an Excel workbook.
+// The cache file lives next to the workbook ("<workbook>.cache") and stores, for
+// every component, the parsed x/y data, labels, units, regression settings and
+// fitted coefficients, so that a later run can skip OpenXLSX and every refit.
+//
+// File layout (native byte order, the cache is meant to be machine-local):
+//   magic[8] | formatVersion (u32) | workbook size (u64) | cache key (u64)
+//   aircraftName | 6 x component { name | count (u32) | count x variable }
+//   variable = varName, xLabel, yLabel, xUnit, yUnit (strings),
+//              chartFlag (string), method (i32), polynomialDegree (i32), fitted (u8),
+//              xData, yData, coefficients (vectors of double),
+//              model coefficients (vector of double), center, scale (double,
+//              polynomial model in z = (x - center) / scale)
+// Strings and vectors are written as a u64 length followed by the raw bytes.
+//
+// The cache key is the FNV-1a hash of the whole workbook continued with
+// formatVersion and fittingVersion, so the cache is invalidated automatically
+// when the workbook changes, when the layout changes or when the regression
+// code would produce different coefficients.
+namespace CACHE {
+
+inline constexpr char magic[8] = {'A', 'E', 'R', 'O', 'C', 'A', 'C', 'H'};
+inline constexpr std::uint32_t formatVersion = 4;
+
+// Versione del codice di regressione (Interpolant/RegressionModel): va incrementata
+// ogni volta che il fit produce coefficienti diversi, anche a layout invariato
+inline constexpr std::uint32_t fittingVersion = 2;
+
+// Read-only memory mapping of a whole file
+class MappedFile
+{
+private:
+    const unsigned char* bytes = nullptr;
+    std::size_t length = 0;
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+#endif
+
+    void close()
+    {
+#ifdef _WIN32
+        if (bytes) UnmapViewOfFile(bytes);
+        if (mappingHandle) CloseHandle(mappingHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+        mappingHandle = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (bytes) munmap(const_cast<unsigned char*>(bytes), length);
+#endif
+        bytes = nullptr;
+        length = 0;
+    }
+
+public:
+    /**
+     * @brief Maps the file in memory; isOpen() is false if it cannot be mapped.
+     * @param path File to map.
+     */
+    explicit MappedFile(const std::string& path)
+    {
+#ifdef _WIN32
+        fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) return;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) return;
+
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mappingHandle) return;
+
+        bytes = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (bytes) length = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0)
+        {
+            void* mapped = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED)
+            {
+                bytes = static_cast<const unsigned char*>(mapped);
+                length = static_cast<std::size_t>(info.st_size);
+            }
+        }
+        ::close(fd);
+#endif
+    }
+
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return bytes != nullptr; }
+    const unsigned char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+};
+
+/**
+ * @brief Cache key of a workbook: content hash continued with the format and fitting versions.
+ * @param data Pointer to the workbook bytes.
+ * @param size Number of bytes.
+ * @return Key value.
+ */
+inline std::uint64_t cacheKey(const unsigned char* data, std::size_t size)
+{
+    std::uint64_t key = FNV1A::hashBytes(data, size);
+    key = FNV1A::hashBytes(&formatVersion, sizeof(formatVersion), key);
+    return FNV1A::hashBytes(&fittingVersion, sizeof(fittingVersion), key);
+}
+
+/**
+ * @brief Returns the cache file path associated with a workbook.
+ * @param workbookPath Full path of the Excel workbook.
+ * @return Path of the cache file.
+ */
+inline std::string cachePathFor(const std::string& workbookPath)
+{
+    return workbookPath + ".cache";
+}
+
+namespace detail {
+
+// Appends raw values to a byte buffer
+class Writer
+{
+public:
+    std::vector<char> buffer;
+
+    template <typename T>
+    void put(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written");
+        const char* raw = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), raw, raw + sizeof(T));
+    }
+
+    void putString(const std::string& value)
+    {
+        put<std::uint64_t>(value.size());
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    void putVector(const std::vector<double>& values)
+    {
+        put<std::uint64_t>(values.size());
+        const char* raw = reinterpret_cast<const char*>(values.data());
+        buffer.insert(buffer.end(), raw, raw + values.size() * sizeof(double));
+    }
+};
+
+// Reads raw values back from a mapped range, with bounds checking
+class Reader
+{
+private:
+    const unsigned char* cursor;
+    const unsigned char* end;
+
+    void require(std::size_t bytes) const
+    {
+        if (static_cast<std::size_t>(end - cursor) < bytes)
+        {
+            throw std::runtime_error("Truncated aircraft data cache");
+        }
+    }
+
+public:
+    Reader(const unsigned char* data, std::size_t size) : cursor(data), end(data + size) {}
+
+    template <typename T>
+    T get()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read");
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return value;
+    }
+
+    std::string getString()
+    {
+        const std::uint64_t size = get<std::uint64_t>();
+        require(size);
+        std::string value(reinterpret_cast<const char*>(cursor), size);
+        cursor += size;
+        return value;
+    }
+
+    std::vector<double> getVector()
+    {
+        const std::uint64_t size = get<std::uint64_t>();
+        if (size > static_cast<std::uint64_t>(end - cursor) / sizeof(double))
+        {
+            throw std::runtime_error("Truncated aircraft data cache");
+        }
+        std::vector<double> values(size);
+        std::memcpy(values.data(), cursor, size * sizeof(double));
+        cursor += size * sizeof(double);
+        return values;
+    }
+};
+
+inline void writeComponent(Writer& out, const ComponentData& component)
+{
+    out.putString(component.componentName);
+    out.put<std::uint32_t>(static_cast<std::uint32_t>(component.variables.size()));
+    for (const auto& [name, var] : component.variables)
+    {
+        out.putString(var.varName);
+        out.putString(var.xLabel);
+        out.putString(var.yLabel);
+        out.putString(var.xUnit);
+        out.putString(var.yUnit);
+        out.putString(var.chartFlag);
+        out.put<std::int32_t>(static_cast<std::int32_t>(var.method));
+        out.put<std::int32_t>(var.polynomialDegree);
+        out.put<std::uint8_t>(var.fitted ? 1 : 0);
+        out.putVector(var.xData);
+        out.putVector(var.yData);
+        out.putVector(var.coefficients);
+        out.putVector(var.model.coefficients);
+        out.put<double>(var.model.center);
+        out.put<double>(var.model.scale);
+    }
+}
+
+inline ComponentData readComponent(Reader& in)
+{
+    ComponentData component;
+    component.componentName = in.getString();
+    const std::uint32_t count = in.get<std::uint32_t>();
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        InterpolableVariable var;
+        var.varName = in.getString();
+        var.xLabel = in.getString();
+        var.yLabel = in.getString();
+        var.xUnit = in.getString();
+        var.yUnit = in.getString();
+        var.chartFlag = in.getString();
+        var.method = static_cast<RegressionMethod>(in.get<std::int32_t>());
+        var.polynomialDegree = in.get<std::int32_t>();
+        var.fitted = in.get<std::uint8_t>() != 0;
+        var.xData = in.getVector();
+        var.yData = in.getVector();
+        var.coefficients = in.getVector();
+        var.model = RegressionModel{var.method, in.getVector()};
+        var.model.center = in.get<double>();
+        var.model.scale = in.get<double>();
+        component.variables[var.varName] = std::move(var);
+    }
+    return component;
+}
+
+} // namespace detail
+
+/**
+ * @brief Writes the cache of an aircraft read from a workbook.
+ *
+ * The file is written to a temporary path and renamed, so a concurrent reader
+ * never sees a partially written cache.
+ *
+ * @param workbookPath Full path of the source Excel workbook.
+ * @param aircraft Aircraft data read (and fitted) from that workbook.
+ * @throws std::runtime_error If the workbook cannot be mapped or the cache cannot be written.
+ */
+inline void save(const std::string& workbookPath, const AircraftData& aircraft)
+{
+    MappedFile workbook(workbookPath);
+    if (!workbook.isOpen())
+    {
+        throw std::runtime_error("Cannot map workbook for hashing: " + workbookPath);
+    }
+
+    detail::Writer out;
+    out.buffer.insert(out.buffer.end(), magic, magic + sizeof(magic));
+    out.put<std::uint32_t>(formatVersion);
+    out.put<std::uint64_t>(workbook.size());
+    out.put<std::uint64_t>(cacheKey(workbook.data(), workbook.size()));
+    out.putString(aircraft.aircraftName);
+
+    for (const ComponentData* component : {&aircraft.fuselage, &aircraft.wing, &aircraft.horizontal,
+                                           &aircraft.vertical, &aircraft.undercarriage, &aircraft.engine})
+    {
+        detail::writeComponent(out, *component);
+    }
+
+    const std::string cachePath = cachePathFor(workbookPath);
+    const std::string tempPath = cachePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Cannot create cache file: " + tempPath);
+        }
+        file.write(out.buffer.data(), static_cast<std::streamsize>(out.buffer.size()));
+        if (!file)
+        {
+            throw std::runtime_error("Cannot write cache file: " + tempPath);
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, cachePath, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+        throw std::runtime_error("Cannot replace cache file: " + cachePath);
+    }
+}
+
+/**
+ * @brief Loads the cached aircraft data of a workbook, if it is still valid.
+ * @param workbookPath Full path of the source Excel workbook.
+ * @param aircraft Output aircraft data, written only on success.
+ * @return true if a valid cache was found and loaded; false if it is missing,
+ *         stale (workbook or fitting code changed), from another format version or corrupted.
+ */
+inline bool load(const std::string& workbookPath, AircraftData& aircraft)
+{
+    MappedFile cache(cachePathFor(workbookPath));
+    if (!cache.isOpen() || cache.size() < sizeof(magic) ||
+        std::memcmp(cache.data(), magic, sizeof(magic)) != 0)
+    {
+        return false;
+    }
+
+    try
+    {
+        detail::Reader in(cache.data() + sizeof(magic), cache.size() - sizeof(magic));
+        if (in.get<std::uint32_t>() != formatVersion)
+        {
+            return false;
+        }
+
+        const std::uint64_t workbookSize = in.get<std::uint64_t>();
+        const std::uint64_t workbookKey = in.get<std::uint64_t>();
+
+        // Cheap size check first, content hash only when sizes agree
+        std::error_code ec;
+        const auto currentSize = std::filesystem::file_size(workbookPath, ec);
+        if (ec || currentSize != workbookSize)
+        {
+            return false;
+        }
+
+        MappedFile workbook(workbookPath);
+        if (!workbook.isOpen() || cacheKey(workbook.data(), workbook.size()) != workbookKey)
+        {
+            return false;
+        }
+
+        AircraftData loaded;
+        loaded.aircraftName = in.getString();
+        loaded.fuselage = detail::readComponent(in);
+        loaded.wing = detail::readComponent(in);
+        loaded.horizontal = detail::readComponent(in);
+        loaded.vertical = detail::readComponent(in);
+        loaded.undercarriage = detail::readComponent(in);
+        loaded.engine = detail::readComponent(in);
+
+        aircraft = std::move(loaded);
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+} // namespace CACHE
+} // namespace AERO
+
+#endif // AIRCRAFTDATACACHE_H
@@ -12,6 +12,7 @@
 #include "XMLPARSER.h"
 #include "VSPAeroGenerator.h"
 #include "ATMOSISA.h"
+#include "ISATable.h"
 #include "ConvDensity.h"
 #include "EnumDensity.h"
 #include "EnumAircraftCategory.h"
@@ -109,9 +110,9 @@ public:
     // ============================================================
     BuildAircraft &buildAircraft()
     {
-        seaLevelDensity = Atmosphere::ISA::density(0.0);
+        seaLevelDensity = Atmosphere::ISATable::standard().density(0.0);
 
-        densityRatio = Atmosphere::ISA::densityRatio(settings.altitude);
+        densityRatio = Atmosphere::ISATable::standard().densityRatio(settings.altitude);
 
         // --- COMMON DATA ---
         commonData
@@ -172,7 +173,7 @@ public:
             .setThicknessToRootChordRatioWing(parser.getValue<double>("myXMLDataToAircraft/wingData/thicknessToRootChordRatio"))
             .setNWingMountedEngines(parser.getValue<int>("myXMLDataToAircraft/wingData/numberOfWingMountedEngines"))
             .setWingKinkThicknessRatio(parser.getValue<double>("myXMLDataToAircraft/wingData/wingKinkThicknessRatio"))
-            .setMaxOperatingEAS(settings.Mach * Atmosphere::ISA::speedOfSound(settings.altitude) * sqrt(densityRatio))
+            .setMaxOperatingEAS(settings.Mach * Atmosphere::ISATable::standard().speedOfSound(settings.altitude) * sqrt(densityRatio))
             .setWingStrutPosition(parser.getValue<double>("myXMLDataToAircraft/wingData/wingStrutPosition"))
             .setStrutToWingChordRatio(parser.getValue<double>("myXMLDataToAircraft/wingData/strutToWingChordRatio"))
             .setPercentageComposite(parser.getValue<double>("myXMLDataToAircraft/wingData/percentageCompositeWing"))
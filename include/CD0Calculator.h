@@ -43,12 +43,14 @@
 #include "VSPScriptGenerator.h"
 #include "VSPAeroGenerator.h"
 #include "WETTEDAREA.h"
+#include "VSPGEOMETRYSESSION.h"
 #include "BUILDAIRCRAFT.h"
 #include "WETTEDAREA.h"
 #include "RestoreSettings.h"
 #include "ATMOSISA.h"
 #include "Interpolant2D.h"
 #include "Interpolant3D.h"
+#include "DigitizedCharts.h"
 #include "RegressionMethod.h"
 #include "ChordCalculator.h"
 
@@ -188,115 +190,27 @@ private:
     double circularRodCDLaminarFlowSadraey = 1.2;   // CD for circular rod in laminar flow, from Sadraey's book
     double circularRodCDTurbulentFlowSadraey = 0.3; // CD for circular rod in turbulent flow, from Sadraey's book
 
-    // ============================================================
-    // DELTA 1 — Dipendenza dal Flap Chord Ratio (cf/c)
-    // ============================================================
-
-    // Slotted Flap, t/c = 0.12
-    const std::vector<double> x_delta1_slotted_tc012 = {
-        0.00159403, 0.0430673, 0.0877139, 0.130226, 0.165823, 0.218411,
-        0.269378, 0.319278, 0.339972, 0.358527, 0.372816, 0.380750, 0.388679};
-    const std::vector<double> y_delta1_slotted_tc012 = {
-        0.00901016, 0.168349, 0.384670, 0.612953, 0.823170, 1.15947,
-        1.55868, 1.96388, 2.15593, 2.37194, 2.60588, 2.74683, 2.89978};
-
-    // Slotted Flap, t/c = 0.21
-    const std::vector<double> x_delta1_slotted_tc021 = {
-        0.00213218, 0.0505095, 0.0919714, 0.137138, 0.178577, 0.231162,
-        0.252926, 0.283184, 0.315027, 0.345282, 0.367564, 0.398341};
-    const std::vector<double> y_delta1_slotted_tc021 = {
-        -0.00596847, 0.201406, 0.390715, 0.640009, 0.889258, 1.23454,
-        1.41463, 1.66075, 1.93985, 2.19496, 2.41401, 2.69610};
-
-    // Plain Flap, t/c = 0.30
-    const std::vector<double> x_delta1_plain_tc030 = {
-        0.00212651, 0.0446647, 0.0930330, 0.168485, 0.223197,
-        0.261431, 0.295424, 0.324621, 0.364455, 0.401097};
-    const std::vector<double> y_delta1_plain_tc030 = {
-        0.00901654, 0.168368, 0.399718, 0.823202, 1.17751,
-        1.45369, 1.67887, 1.91599, 2.18620, 2.44738};
-
-    // Plain Flap, t/c = 0.12
-    const std::vector<double> x_delta1_plain_tc012 = {
-        0.00159744, 0.0499850, 0.103127, 0.160515, 0.225852, 0.275260,
-        0.303410, 0.325195, 0.346450, 0.370365, 0.399600};
-    const std::vector<double> y_delta1_plain_tc012 = {
-        1.91502e-05, 0.180420, 0.459780, 0.778152, 1.19552, 1.49282,
-        1.68197, 1.80511, 1.92224, 2.04541, 2.18362};
-
-    // Plain Flap, t/c = 0.21
-    const std::vector<double> x_delta1_plain_tc021 = {
-        0.00478891, 0.0382920, 0.0728475, 0.121201, 0.163705, 0.208865,
-        0.255085, 0.291208, 0.324690, 0.353920, 0.382090, 0.401764};
-    const std::vector<double> y_delta1_plain_tc021 = {
-        0.00904846, 0.123337, 0.270605, 0.540916, 0.790178, 1.05745,
-        1.33673, 1.56494, 1.73317, 1.88337, 2.01858, 2.09374};
-
-    // ============================================================
-    // DELTA 2 — Dipendenza dalla Deflessione del Flap (gradi)
-    // ============================================================
-
-    // Split Flap, t/c = 0.12
-    const std::vector<double> x_delta2_split_tc012 = {
-        0.343643, 5.26919, 10.3093, 17.1821, 22.6804, 30.0115, 38.9462,
-        47.6518, 54.7537, 63.2302, 71.3631, 77.0905, 81.4433, 83.8488, 86.8270, 89.6907};
-    const std::vector<double> y_delta2_split_tc012 = {
-        0.000994036, 0.00646123, 0.0156561, 0.0315606, 0.0467197, 0.0708250, 0.0979125,
-        0.129722, 0.153579, 0.180417, 0.204026, 0.218439, 0.227386, 0.230865, 0.234095, 0.234841};
-
-    // Split Flap, t/c = 0.30
-    const std::vector<double> x_delta2_split_tc030 = {
-        0.458190, 5.26919, 9.85109, 16.2658, 21.5349, 32.4170, 38.9462,
-        45.0172, 53.7228, 61.8557, 69.4158, 75.1432, 79.8396, 83.6197, 87.1707, 89.3471};
-    const std::vector<double> y_delta2_split_tc030 = {
-        0.000994036, 0.00149105, 0.00397614, 0.0124254, 0.0216203, 0.0424950, 0.0581511,
-        0.0770378, 0.104622, 0.130716, 0.152087, 0.169483, 0.182406, 0.190855, 0.197565, 0.200547};
-
-    // Split Flap, t/c = 0.21
-    const std::vector<double> x_delta2_split_tc021 = {
-        0.343643, 5.95647, 11.4548, 16.8385, 24.1695, 30.1260, 37.4570,
-        44.6735, 52.9210, 59.6793, 63.5739, 68.6140, 73.3104, 77.0905,
-        80.6415, 83.2761, 86.1397, 90.1489};
-    const std::vector<double> y_delta2_split_tc021 = {
-        -0.000497018, 0.00273360, 0.00869781, 0.0191352, 0.0333002, 0.0509443, 0.0745527,
-        0.0999006, 0.128976, 0.153579, 0.164761, 0.179175, 0.194085, 0.204026,
-        0.211233, 0.216203, 0.219433, 0.223658};
-
-    // Slotted Flap, t/c = 0.30
-    const std::vector<double> x_delta2_slotted_tc030 = {
-        0.458190, 6.41466, 13.1730, 20.8477, 27.9496, 34.1352, 42.2680,
-        48.1100, 55.4410, 61.9702, 67.4685, 72.1649, 77.0905, 82.8179, 87.7434, 92.7835};
-    const std::vector<double> y_delta2_slotted_tc030 = {
-        0.000248509, 0.000994036, 0.00521869, 0.0109344, 0.0206262, 0.0333002, 0.0506958,
-        0.0636183, 0.0792744, 0.0926938, 0.102634, 0.109841, 0.116551, 0.123012, 0.126243, 0.127237};
-
-    // Slotted Flap, t/c = 0.21
-    const std::vector<double> x_delta2_slotted_tc021 = {
-        0.229095, 7.21650, 13.2875, 20.2749, 29.2096, 38.0298, 46.9645,
-        55.6701, 60.7102, 67.4685, 73.5395, 77.8923, 82.5888, 85.6816,
-        88.0871, 90.1489, 93.3562};
-    const std::vector<double> y_delta2_slotted_tc021 = {
-        0.000248509, 0.00149105, 0.00472167, 0.0106859, 0.0218688, 0.0357853, 0.0497018,
-        0.0636183, 0.0705765, 0.0805169, 0.0889662, 0.0959245, 0.102137, 0.104125,
-        0.104871, 0.104871, 0.103877};
-
-    // Slotted Flap, t/c = 0.12
-    const std::vector<double> x_delta2_slotted_tc012 = {
-        0.229095, 7.21650, 11.6838, 15.5785, 19.8167, 25.0859, 29.6678,
-        33.2188, 37.6861, 42.0389, 47.3081, 54.7537, 60.2520, 64.7194,
-        71.0195, 77.4341, 82.9324, 86.9416, 89.6907, 92.6690};
-    const std::vector<double> y_delta2_slotted_tc012 = {
-        0.000248509, 0.000248509, 0.00149105, 0.00298211, 0.00571571, 0.0109344, 0.0168986,
-        0.0246024, 0.0328032, 0.0424950, 0.0534294, 0.0666004, 0.0765408, 0.0844930,
-        0.0934394, 0.101640, 0.108101, 0.112326, 0.114314, 0.114066};
-
-    // Plain Flap, tutti i t/c
-    const std::vector<double> x_delta2_plain_all_tc = {
-        0.114548, 3.78007, 8.59107, 14.7766, 21.3440, 30.1260,
-        39.5189, 46.7736, 51.8137, 57.6174, 62.0466, 64.1848};
-    const std::vector<double> y_delta2_plain_all_tc = {
-        0.000248509, 0.00132538, 0.00712392, 0.0188867, 0.0324718, 0.0569914,
-        0.0849901, 0.108516, 0.127402, 0.145129, 0.156395, 0.162856};
+    /// @brief Returns the shared geometry session of the aircraft: geometry IDs, wetted areas of all the
+    /// components and fuselage/nacelle sections, collected with a single vspscript run per .vsp3 version.
+    std::shared_ptr<const VSPGEOMTRYEXTRACTOR::GeometrySession> geometrySession() const
+    {
+        std::vector<std::string> components = {wing.id, horizontal.id, vertical.id, fus.id};
+
+        if (!canard.id.empty())
+        {
+            components.push_back(canard.id);
+        }
+        if (!boom.id.empty())
+        {
+            components.push_back(boom.id);
+        }
+        if (!nac.id.empty())
+        {
+            components.push_back(nac.id + "_" + std::to_string(builder.getEngineData().getNumberOfEngines()));
+        }
+
+        return VSPGEOMTRYEXTRACTOR::GeometrySession::acquire(nameOfAircraft, components);
+    }
 
 public:
 
@@ -486,21 +400,10 @@ public:
 
         // Swet wing calculation
 
-        WETTEDAREA::WettedArea wettedAreaCalculatorWing(nameOfAircraft + "_GetGeomOfAircraft.vspscript", aircraftData);
-
-        wettedAreaCalculatorWing.getAllGeoms(nameOfAircraft, false);
-
-        wettedAreaCalculatorWing.executeAndCaptureGeomIds();
-
-        wettedAreaCalculatorWing.CalculateWettedArea(nameOfAircraft, "WettedAreaWing.vspscript", wing.id);
-
-        wettedAreaCalculatorWing.executeAndCaptureWettedArea("WettedAreaWing.vspscript");
-
-        // Access and display results
-        const auto &results = wettedAreaCalculatorWing.getWettedAreaResults();
+        const auto session = geometrySession();
 
         // OpenVsp gives us only the enatire half-wetted area of the wing
-        wettedAreaExposedWing = 2 * (results.WET_AREA - 0.5 * fus.diameter);
+        wettedAreaExposedWing = 2 * (session->getWettedArea(wing.id) - 0.5 * fus.diameter);
 
         // Contribution to the parasite drag due to flap deflecction
 
@@ -522,8 +425,9 @@ public:
                 etaInboardFlap = wing.mov.eta_inner[n];
                 etaOutboardFlap = wing.mov.eta_outer[n];
 
-                double inboardChord = ChordCalculator(wing).getChordAtEtaStation(etaInboardFlap, wing.typeOfWing);
-                double outboardChord = ChordCalculator(wing).getChordAtEtaStation(etaOutboardFlap, wing.typeOfWing);
+                const ChordCalculator chordCalculator(wing);
+                double inboardChord = chordCalculator.getChordAtEtaStation(etaInboardFlap, wing.typeOfWing);
+                double outboardChord = chordCalculator.getChordAtEtaStation(etaOutboardFlap, wing.typeOfWing);
 
                 // Half-flap-affected wing area.
                 wingAreaAffectedByFlap += 0.5 * (inboardChord + outboardChord) * segmentSpan;
@@ -544,59 +448,30 @@ public:
                     if (builder.getWingData().getTypeOfFlap() == TypeOfFlap::SLOTTED_FLAP)
                     {
                         // Contribution due to flap-chord-ratio
-                        Interpolant2D flapChordRatioEffectInterpolator(4, RegressionMethod::POLYNOMIAL);
-
-                        flapChordRatioEffectInterpolator.addCurve(0.12, x_delta1_slotted_tc012, y_delta1_slotted_tc012);
-                        flapChordRatioEffectInterpolator.addCurve(0.21, x_delta1_slotted_tc021, y_delta1_slotted_tc021);
-                        flapChordRatioEffectInterpolator.addCurve(0.30, x_delta1_slotted_tc021, y_delta1_slotted_tc021);
-
-                        contributionDueToFlapChordRatio = flapChordRatioEffectInterpolator.interpolate(averageChordRatio, wing.averageThicknessToChordRatio);
+                        contributionDueToFlapChordRatio = DIGITIZED_CHARTS::slottedFlapChordRatioDragFactor().interpolate(averageChordRatio, wing.averageThicknessToChordRatio);
 
                         // Contribution due to flap deflection
 
-                        Interpolant2D flapDeflectionEffectInterpolator(6, RegressionMethod::POLYNOMIAL);
-
-                        flapDeflectionEffectInterpolator.addCurve(0.12, x_delta2_slotted_tc012, y_delta2_slotted_tc012);
-                        flapDeflectionEffectInterpolator.addCurve(0.21, x_delta2_slotted_tc021, y_delta2_slotted_tc021);
-                        flapDeflectionEffectInterpolator.addCurve(0.30, x_delta2_slotted_tc030, y_delta2_slotted_tc030);
-
-                        contributionDueToFlapDeflection = flapDeflectionEffectInterpolator.interpolate(wing.mov.defl[i], wing.averageThicknessToChordRatio);
+                        contributionDueToFlapDeflection = DIGITIZED_CHARTS::slottedFlapDeflectionDragFactor().interpolate(wing.mov.defl[i], wing.averageThicknessToChordRatio);
                     }
                     else if (builder.getWingData().getTypeOfFlap() == TypeOfFlap::PLAIN_FLAP ||
                              builder.getWingData().getTypeOfFlap() == TypeOfFlap::SPLIT_FLAP)
                     {
                         // Contribution due to flap-chord-ratio
-                        Interpolant2D flapChordRatioEffectInterpolator(4, RegressionMethod::POLYNOMIAL);
-
-                        flapChordRatioEffectInterpolator.addCurve(0.12, x_delta1_plain_tc012, y_delta1_plain_tc012);
-                        flapChordRatioEffectInterpolator.addCurve(0.21, x_delta1_plain_tc021, y_delta1_plain_tc021);
-                        flapChordRatioEffectInterpolator.addCurve(0.30, x_delta1_plain_tc030, y_delta1_plain_tc030);
-
-                        contributionDueToFlapChordRatio = flapChordRatioEffectInterpolator.interpolate(averageChordRatio, wing.averageThicknessToChordRatio);
+                        contributionDueToFlapChordRatio = DIGITIZED_CHARTS::plainFlapChordRatioDragFactor().interpolate(averageChordRatio, wing.averageThicknessToChordRatio);
 
                         // Contribution due to flap deflection
 
                         if (builder.getWingData().getTypeOfFlap() == TypeOfFlap::PLAIN_FLAP)
                         {
 
-                            Interpolant2D flapDeflectionEffectInterpolator(3, RegressionMethod::POLYNOMIAL);
-
-                            flapDeflectionEffectInterpolator.addCurve(0.12, x_delta2_plain_all_tc, y_delta2_plain_all_tc);
-                            flapDeflectionEffectInterpolator.addCurve(0.21, x_delta2_plain_all_tc, y_delta2_plain_all_tc);
-                            flapDeflectionEffectInterpolator.addCurve(0.30, x_delta2_plain_all_tc, y_delta2_plain_all_tc);
-
-                            contributionDueToFlapDeflection = flapDeflectionEffectInterpolator.interpolate(wing.mov.defl[i], wing.averageThicknessToChordRatio);
+                            contributionDueToFlapDeflection = DIGITIZED_CHARTS::plainFlapDeflectionDragFactor().interpolate(wing.mov.defl[i], wing.averageThicknessToChordRatio);
                         }
 
                         else
                         {
 
-                            Interpolant2D flapDeflectionEffectInterpolator(3, RegressionMethod::POLYNOMIAL);
-                            flapDeflectionEffectInterpolator.addCurve(0.12, x_delta2_split_tc012, y_delta2_split_tc012);
-                            flapDeflectionEffectInterpolator.addCurve(0.21, x_delta2_split_tc021, y_delta2_split_tc021);
-                            flapDeflectionEffectInterpolator.addCurve(0.30, x_delta2_split_tc030, y_delta2_split_tc030);
-
-                            contributionDueToFlapDeflection = flapDeflectionEffectInterpolator.interpolate(wing.mov.defl[i], wing.averageThicknessToChordRatio);
+                            contributionDueToFlapDeflection = DIGITIZED_CHARTS::splitFlapDeflectionDragFactor().interpolate(wing.mov.defl[i], wing.averageThicknessToChordRatio);
                         }
                     }
                 }
@@ -774,33 +649,9 @@ public:
 
         // Swet wing calculation
 
-        WETTEDAREA::WettedArea wettedAreaCalculatorWing(nameOfAircraft + "_GetGeomOfAircraft.vspscript", aircraftData);
-
-        wettedAreaCalculatorWing.getAllGeoms(nameOfAircraft, false);
-
-        wettedAreaCalculatorWing.executeAndCaptureGeomIds();
-
-        wettedAreaCalculatorWing.CalculateWettedArea(nameOfAircraft, "WettedAreaCanard.vspscript", canard.id);
-
-        wettedAreaCalculatorWing.executeAndCaptureWettedArea("WettedAreaCanard.vspscript");
+        const auto session = geometrySession();
 
-        // Access and display results
-        const auto &results = wettedAreaCalculatorWing.getWettedAreaResults();
-
-        VSPGEOMTRYEXTRACTOR::GeometryExtractor geomExtractor;
-        geomExtractor.extractAllGeoms(builder.getCommonData().getNameOfAircraft(),
-                                      builder.getCommonData().getNameOfAircraft() + "_AllGeomsToCd0.vspscript");
-
-        VSPGEOMTRYEXTRACTOR::AircraftGeometryData allGeomData = geomExtractor.getGeometryData();
-
-        // VSPGEOMTRYEXTRACTOR::GeomInfo fuselageType;
-
-        VSPGEOMTRYEXTRACTOR::DiametersExtractor fuseExtractor;
-
-        VSPGEOMTRYEXTRACTOR::FuselageDiametersAndXStation fuseData = fuseExtractor.extractFuselageDiameters(
-            builder.getCommonData().getNameOfAircraft(),
-            allGeomData,
-            fus.length);
+        VSPGEOMTRYEXTRACTOR::FuselageDiametersAndXStation fuseData = session->getFuselageDiameters(fus.length);
 
         double diameterAtHorizontalLocation;
 
@@ -809,7 +660,7 @@ public:
         diameterAtHorizontalLocation = fusDiameterInterpolator.getYValueFromRegression(horizontal.xloc);
 
         // OpenVsp gives us only the enatire half-wetted area of the wing
-        wettedAreaExposedCanard = 2 * (results.WET_AREA - 0.5 * diameterAtHorizontalLocation);
+        wettedAreaExposedCanard = 2 * (session->getWettedArea(canard.id) - 0.5 * diameterAtHorizontalLocation);
 
         // Contribution to the parasite drag due to flap deflecction
 
@@ -831,8 +682,9 @@ public:
                 etaInboardFlap = canard.mov.eta_inner[n];
                 etaOutboardFlap = canard.mov.eta_outer[n];
 
-                double inboardChord = ChordCalculator(canard).getChordAtEtaStation(etaInboardFlap, canard.typeOfWing);
-                double outboardChord = ChordCalculator(canard).getChordAtEtaStation(etaOutboardFlap, canard.typeOfWing);
+                const ChordCalculator chordCalculator(canard);
+                double inboardChord = chordCalculator.getChordAtEtaStation(etaInboardFlap, canard.typeOfWing);
+                double outboardChord = chordCalculator.getChordAtEtaStation(etaOutboardFlap, canard.typeOfWing);
 
                 // Half-flap-affected wing area.
                 wingAreaAffectedByCanardFlap += 0.5 * (inboardChord + outboardChord) * segmentSpan;
@@ -1050,33 +902,9 @@ public:
         if (builder.getCommonData().getTypeOfTail() != TypeOfTail::V_TAIL ||
             builder.getCommonData().getTypeOfTail() != TypeOfTail::V_REV_TAIL)
         {
-            WETTEDAREA::WettedArea wettedAreaCalculatorWing(nameOfAircraft + "_GetGeomOfAircraft.vspscript", aircraftData);
-
-            wettedAreaCalculatorWing.getAllGeoms(nameOfAircraft, false);
-
-            wettedAreaCalculatorWing.executeAndCaptureGeomIds();
-
-            wettedAreaCalculatorWing.CalculateWettedArea(nameOfAircraft, "WettedAreaHorizontal.vspscript", horizontal.id);
-
-            wettedAreaCalculatorWing.executeAndCaptureWettedArea("WettedAreaHorizontal.vspscript");
+            const auto session = geometrySession();
 
-            // Access and display results
-            const auto &results = wettedAreaCalculatorWing.getWettedAreaResults();
-
-            VSPGEOMTRYEXTRACTOR::GeometryExtractor geomExtractor;
-            geomExtractor.extractAllGeoms(builder.getCommonData().getNameOfAircraft(),
-                                          builder.getCommonData().getNameOfAircraft() + "_AllGeomsToCd0.vspscript");
-
-            VSPGEOMTRYEXTRACTOR::AircraftGeometryData allGeomData = geomExtractor.getGeometryData();
-
-            // VSPGEOMTRYEXTRACTOR::GeomInfo fuselageType;
-
-            VSPGEOMTRYEXTRACTOR::DiametersExtractor fuseExtractor;
-
-            VSPGEOMTRYEXTRACTOR::FuselageDiametersAndXStation fuseData = fuseExtractor.extractFuselageDiameters(
-                builder.getCommonData().getNameOfAircraft(),
-                allGeomData,
-                fus.length);
+            VSPGEOMTRYEXTRACTOR::FuselageDiametersAndXStation fuseData = session->getFuselageDiameters(fus.length);
 
             double diameterAtHorizontalLocation;
 
@@ -1085,7 +913,7 @@ public:
             diameterAtHorizontalLocation = fusDiameterInterpolator.getYValueFromRegression(horizontal.xloc);
 
             // OpenVsp gives us only the enatire half-wetted area of the wing
-            wettedAreaExposedHorizontalTail = 2 * (results.WET_AREA - 0.5 * diameterAtHorizontalLocation);
+            wettedAreaExposedHorizontalTail = 2 * (session->getWettedArea(horizontal.id) - 0.5 * diameterAtHorizontalLocation);
         }
 
         else
@@ -1114,8 +942,9 @@ public:
                 etaInboardFlap = horizontal.mov.eta_inner[n];
                 etaOutboardFlap = horizontal.mov.eta_outer[n];
 
-                double inboardChord = ChordCalculator(horizontal).getChordAtEtaStation(etaInboardFlap, horizontal.typeOfWing);
-                double outboardChord = ChordCalculator(horizontal).getChordAtEtaStation(etaOutboardFlap, horizontal.typeOfWing);
+                const ChordCalculator chordCalculator(horizontal);
+                double inboardChord = chordCalculator.getChordAtEtaStation(etaInboardFlap, horizontal.typeOfWing);
+                double outboardChord = chordCalculator.getChordAtEtaStation(etaOutboardFlap, horizontal.typeOfWing);
 
                 // Half-flap-affected wing area.
                 wingAreaAffectedByElevator += 0.5 * (inboardChord + outboardChord) * segmentSpan;
@@ -1319,24 +1148,13 @@ public:
 
         // Swet wing calculation
 
-        WETTEDAREA::WettedArea wettedAreaCalculatorWing(nameOfAircraft + "_GetGeomOfAircraft.vspscript", aircraftData);
-
-        wettedAreaCalculatorWing.getAllGeoms(nameOfAircraft, false);
-
-        wettedAreaCalculatorWing.executeAndCaptureGeomIds();
-
-        wettedAreaCalculatorWing.CalculateWettedArea(nameOfAircraft, "WettedAreaVertical.vspscript", vertical.id);
-
-        wettedAreaCalculatorWing.executeAndCaptureWettedArea("WettedAreaVertical.vspscript");
-
-        // Access and display results
-        const auto &results = wettedAreaCalculatorWing.getWettedAreaResults();
+        const double wettedAreaVertical = geometrySession()->getWettedArea(vertical.id);
 
         if (builder.getCommonData().getTypeOfTail() == TypeOfTail::TRIPLE_TAIL)
         {
 
             // OpenVsp gives us only the enatire half-wetted area of the wing
-            wettedAreaExposedVerticalTail = 3 * (results.WET_AREA);
+            wettedAreaExposedVerticalTail = 3 * (wettedAreaVertical);
         }
 
         else if (builder.getCommonData().getTypeOfTail() == TypeOfTail::V_TAIL ||
@@ -1372,8 +1190,9 @@ public:
                 etaInboardFlap = vertical.mov.eta_inner[n];
                 etaOutboardFlap = vertical.mov.eta_outer[n];
 
-                double inboardChord = ChordCalculator(vertical).getChordAtEtaStation(etaInboardFlap, vertical.typeOfWing);
-                double outboardChord = ChordCalculator(vertical).getChordAtEtaStation(etaOutboardFlap, vertical.typeOfWing);
+                const ChordCalculator chordCalculator(vertical);
+                double inboardChord = chordCalculator.getChordAtEtaStation(etaInboardFlap, vertical.typeOfWing);
+                double outboardChord = chordCalculator.getChordAtEtaStation(etaOutboardFlap, vertical.typeOfWing);
 
                 // Half-flap-affected wing area.
                 wingAreaAffectedByRudder += 0.5 * (inboardChord + outboardChord) * segmentSpan;
@@ -1394,59 +1213,30 @@ public:
                     if (builder.getWingData().getTypeOfFlap() == TypeOfFlap::SLOTTED_FLAP)
                     {
                         // Contribution due to flap-chord-ratio
-                        Interpolant2D flapChordRatioEffectInterpolator(4, RegressionMethod::POLYNOMIAL);
-
-                        flapChordRatioEffectInterpolator.addCurve(0.12, x_delta1_slotted_tc012, y_delta1_slotted_tc012);
-                        flapChordRatioEffectInterpolator.addCurve(0.21, x_delta1_slotted_tc021, y_delta1_slotted_tc021);
-                        flapChordRatioEffectInterpolator.addCurve(0.30, x_delta1_slotted_tc021, y_delta1_slotted_tc021);
-
-                        contributionDueToFlapChordRatio = flapChordRatioEffectInterpolator.interpolate(averageChordRatio, vertical.averageThicknessToChordRatio);
+                        contributionDueToFlapChordRatio = DIGITIZED_CHARTS::slottedFlapChordRatioDragFactor().interpolate(averageChordRatio, vertical.averageThicknessToChordRatio);
 
                         // Contribution due to flap deflection
 
-                        Interpolant2D flapDeflectionEffectInterpolator(6, RegressionMethod::POLYNOMIAL);
-
-                        flapDeflectionEffectInterpolator.addCurve(0.12, x_delta2_slotted_tc012, y_delta2_slotted_tc012);
-                        flapDeflectionEffectInterpolator.addCurve(0.21, x_delta2_slotted_tc021, y_delta2_slotted_tc021);
-                        flapDeflectionEffectInterpolator.addCurve(0.30, x_delta2_slotted_tc030, y_delta2_slotted_tc030);
-
-                        contributionDueToFlapDeflection = flapDeflectionEffectInterpolator.interpolate(std::abs(vertical.mov.defl[i]), vertical.averageThicknessToChordRatio);
+                        contributionDueToFlapDeflection = DIGITIZED_CHARTS::slottedFlapDeflectionDragFactor().interpolate(std::abs(vertical.mov.defl[i]), vertical.averageThicknessToChordRatio);
                     }
                     else if (builder.getWingData().getTypeOfFlap() == TypeOfFlap::PLAIN_FLAP ||
                              builder.getWingData().getTypeOfFlap() == TypeOfFlap::SPLIT_FLAP)
                     {
                         // Contribution due to flap-chord-ratio
-                        Interpolant2D flapChordRatioEffectInterpolator(4, RegressionMethod::POLYNOMIAL);
-
-                        flapChordRatioEffectInterpolator.addCurve(0.12, x_delta1_plain_tc012, y_delta1_plain_tc012);
-                        flapChordRatioEffectInterpolator.addCurve(0.21, x_delta1_plain_tc021, y_delta1_plain_tc021);
-                        flapChordRatioEffectInterpolator.addCurve(0.30, x_delta1_plain_tc030, y_delta1_plain_tc030);
-
-                        contributionDueToFlapChordRatio = flapChordRatioEffectInterpolator.interpolate(averageChordRatio, vertical.averageThicknessToChordRatio);
+                        contributionDueToFlapChordRatio = DIGITIZED_CHARTS::plainFlapChordRatioDragFactor().interpolate(averageChordRatio, vertical.averageThicknessToChordRatio);
 
                         // Contribution due to flap deflection
 
                         if (builder.getWingData().getTypeOfFlap() == TypeOfFlap::PLAIN_FLAP)
                         {
 
-                            Interpolant2D flapDeflectionEffectInterpolator(3, RegressionMethod::POLYNOMIAL);
-
-                            flapDeflectionEffectInterpolator.addCurve(0.12, x_delta2_plain_all_tc, y_delta2_plain_all_tc);
-                            flapDeflectionEffectInterpolator.addCurve(0.21, x_delta2_plain_all_tc, y_delta2_plain_all_tc);
-                            flapDeflectionEffectInterpolator.addCurve(0.30, x_delta2_plain_all_tc, y_delta2_plain_all_tc);
-
-                            contributionDueToFlapDeflection = flapDeflectionEffectInterpolator.interpolate(std::abs(vertical.mov.defl[i]), vertical.averageThicknessToChordRatio);
+                            contributionDueToFlapDeflection = DIGITIZED_CHARTS::plainFlapDeflectionDragFactor().interpolate(std::abs(vertical.mov.defl[i]), vertical.averageThicknessToChordRatio);
                         }
 
                         else
                         {
 
-                            Interpolant2D flapDeflectionEffectInterpolator(3, RegressionMethod::POLYNOMIAL);
-                            flapDeflectionEffectInterpolator.addCurve(0.12, x_delta2_split_tc012, y_delta2_split_tc012);
-                            flapDeflectionEffectInterpolator.addCurve(0.21, x_delta2_split_tc021, y_delta2_split_tc021);
-                            flapDeflectionEffectInterpolator.addCurve(0.30, x_delta2_split_tc030, y_delta2_split_tc030);
-
-                            contributionDueToFlapDeflection = flapDeflectionEffectInterpolator.interpolate(std::abs(vertical.mov.defl[i]), vertical.averageThicknessToChordRatio);
+                            contributionDueToFlapDeflection = DIGITIZED_CHARTS::splitFlapDeflectionDragFactor().interpolate(std::abs(vertical.mov.defl[i]), vertical.averageThicknessToChordRatio);
                         }
                     }
 
@@ -1502,20 +1292,7 @@ public:
         if (typeOfBody == fus.id)
         {
 
-            VSPGEOMTRYEXTRACTOR::GeometryExtractor geomExtractor;
-            geomExtractor.extractAllGeoms(builder.getCommonData().getNameOfAircraft(),
-                                          builder.getCommonData().getNameOfAircraft() + "_AllGeomsToCd0.vspscript");
-
-            VSPGEOMTRYEXTRACTOR::AircraftGeometryData allGeomData = geomExtractor.getGeometryData();
-
-            // VSPGEOMTRYEXTRACTOR::GeomInfo fuselageType;
-
-            VSPGEOMTRYEXTRACTOR::DiametersExtractor fuseExtractor;
-
-            VSPGEOMTRYEXTRACTOR::FuselageDiametersAndXStation fuseData = fuseExtractor.extractFuselageDiameters(
-                builder.getCommonData().getNameOfAircraft(),
-                allGeomData,
-                fus.length);
+            VSPGEOMTRYEXTRACTOR::FuselageDiametersAndXStation fuseData = geometrySession()->getFuselageDiameters(fus.length);
 
             maximumExposedDiameterFusiFormBody = *std::max_element(fuseData.allFuselageWidth.begin(), fuseData.allFuselageWidth.end());
 
@@ -1593,18 +1370,7 @@ public:
             else
             {
 
-                VSPGEOMTRYEXTRACTOR::GeometryExtractor geomExtractor;
-                geomExtractor.extractAllGeoms(builder.getCommonData().getNameOfAircraft(),
-                                              builder.getCommonData().getNameOfAircraft() + "_AllGeomsToCd0.vspscript");
-
-                VSPGEOMTRYEXTRACTOR::AircraftGeometryData allGeomData = geomExtractor.getGeometryData();
-
-                VSPGEOMTRYEXTRACTOR::DiametersExtractor nacelleExtractor;
-
-                VSPGEOMTRYEXTRACTOR::NacelleDiametersAndXStation nacelleData = nacelleExtractor.extractNacelleDiameters(
-                    builder.getCommonData().getNameOfAircraft(),
-                    allGeomData,
-                    nac.length);
+                VSPGEOMTRYEXTRACTOR::NacelleDiametersAndXStation nacelleData = geometrySession()->getNacelleDiameters(nac.length);
 
                 maximumExposedDiameterFusiFormBody = *std::max_element(nacelleData.allNacelleWidth.begin(), nacelleData.allNacelleWidth.end());
             }
@@ -1795,45 +1561,21 @@ public:
 
         // Swet fusi-form body calculation
 
-        WETTEDAREA::WettedArea wettedAreaCalculatorWing(nameOfAircraft + "_GetGeomOfAircraft.vspscript", aircraftData);
-
-        wettedAreaCalculatorWing.getAllGeoms(nameOfAircraft, false);
-
-        wettedAreaCalculatorWing.executeAndCaptureGeomIds();
+        const auto session = geometrySession();
 
         if (typeOfBody == fus.id)
         {
-
-            wettedAreaCalculatorWing.CalculateWettedArea(nameOfAircraft, "WettedAreaFuselage.vspscript", fus.id);
-
-            wettedAreaCalculatorWing.executeAndCaptureWettedArea("WettedAreaFuselage.vspscript");
-
-            // Access and display results
-            const auto &results = wettedAreaCalculatorWing.getWettedAreaResults();
-            wettedAreaExposedFusiFormBodyFuselage = results.WET_AREA;
+            wettedAreaExposedFusiFormBodyFuselage = session->getWettedArea(fus.id);
         }
 
         else if (typeOfBody == boom.id)
         {
-
-            wettedAreaCalculatorWing.CalculateWettedArea(nameOfAircraft, "WettedAreaBoom.vspscript", boom.id);
-
-            wettedAreaCalculatorWing.executeAndCaptureWettedArea("WettedAreaBoom.vspscript");
-
-            // Access and display results
-            const auto &results = wettedAreaCalculatorWing.getWettedAreaResults();
-            wettedAreaExposedFusiFormBodyFuselage = builder.getCommonData().getNumberOfBooms() * results.WET_AREA;
+            wettedAreaExposedFusiFormBodyFuselage = builder.getCommonData().getNumberOfBooms() * session->getWettedArea(boom.id);
         }
         else if (typeOfBody == nac.id)
         {
-
-            wettedAreaCalculatorWing.CalculateWettedArea(nameOfAircraft, "WettedAreaNacelle.vspscript", nac.id + "_" + std::to_string(builder.getEngineData().getNumberOfEngines()));
-
-            wettedAreaCalculatorWing.executeAndCaptureWettedArea("WettedAreaNacelle.vspscript");
-
-            // Access and display results
-            const auto &results = wettedAreaCalculatorWing.getWettedAreaResults();
-            wettedAreaExposedFusiFormBodyFuselage = builder.getEngineData().getNumberOfEngines() * results.WET_AREA;
+            wettedAreaExposedFusiFormBodyFuselage = builder.getEngineData().getNumberOfEngines() *
+                                                    session->getWettedArea(nac.id + "_" + std::to_string(builder.getEngineData().getNumberOfEngines()));
         }
 
        
@@ -56,6 +56,17 @@
 #include "OswaldFactorCalculator.h"
 #include "CD0Calculator.h"
 
+/// @brief Drag polar of the aircraft at one Mach number, altitude and flight phase.
+struct DragPolar
+{
+    std::vector<double> angleOfAttack;   // [deg]
+    std::vector<double> liftCoefficient;
+    std::vector<double> dragCoefficient;
+    std::vector<double> efficiency;      // L/D
+    double CD0 = 0.0;
+    double oswaldFactor = 0.0;
+};
+
 /// @brief Constructor for the CDCalculator class. Initializes the calculator with the necessary aircraft data, settings, and geometric information for the various components of the aircraft. The constructor takes in references to the builder object, aircraft data, aerodynamic settings, and geometric data for the wing, horizontal tail, vertical tail, fuselage, nacelle, canard (optional), boom (optional), and EOIR (optional). This allows the calculator to have access to all relevant information needed for accurate CD calculations across different components of the aircraft.
 /// @param nameOfAircraft The name of the aircraft for which CD is being calculated.
 /// @param builder A reference to the BuildAircraft object that contains the aircraft's design.
@@ -90,6 +101,131 @@ private:
     double liftCoeffcient = 0.0;
     double dragCoefficient = 0.0;
 
+    /// @brief Silents the aircraft components, runs VSPAERO once with the current settings (all the AoA of settings.AoA) and returns the lift data.
+    SILENTORCOMPONENT::AerodynamicCoefficients solveLiftCoefficients()
+    {
+        VSPGEOMTRYEXTRACTOR::GeometryExtractor geomExtractor;
+        geomExtractor.extractAllGeoms(builder.getCommonData().getNameOfAircraft(),
+                                      builder.getCommonData().getNameOfAircraft() + "_AllGeoms.vspscript");
+
+        VSPGEOMTRYEXTRACTOR::AircraftGeometryData allGeomData = geomExtractor.getGeometryData();
+
+        SILENTORCOMPONENT::SilentorComponent silentorAnalysis(builder.getCommonData().getNameOfAircraft(),
+                                                              "SilentorComponentAnalysis.vspscript");
+
+        std::map<std::string, bool> componentDetected;
+
+        for (const auto &geom : allGeomData.nameOfComponentGeom)
+        {
+
+            if (geom == canard.id)
+            {
+
+                componentDetected[canard.id] = true;
+            }
+
+            else
+            {
+                componentDetected[canard.id] = false;
+            }
+
+            if (geom == boom.id)
+            {
+
+                componentDetected[boom.id] = true;
+            }
+
+            else
+            {
+                componentDetected[boom.id] = false;
+            }
+
+            if (geom == eoir.id)
+            {
+
+                componentDetected[eoir.id] = true;
+            }
+
+            else
+            {
+                componentDetected[eoir.id] = false;
+            }
+        }
+
+        std::vector<std::string> componentToSilentor{wing.id, horizontal.id, vertical.id, fus.id};
+
+        for (const auto &entry : componentDetected)
+        {
+
+            if (entry.second)
+            {
+                componentToSilentor.push_back(entry.first);
+            }
+        }
+
+        silentorAnalysis.GetGeometryWithThisComponent(aircraftData, allGeomData, componentToSilentor);
+
+        silentorAnalysis.executeAnalysis(settings);
+
+        return silentorAnalysis.getAerodynamicCoefficients();
+    }
+
+    /// @brief CD0 and Oswald factor of a flight phase, with the current settings.
+    /// @return false if the flight phase is not valid.
+    bool getPhaseDragParameters(const std::string &flightPhase, double &CD0, double &oswaldFactor)
+    {
+        CD0Calculator cd0Calc(nameOfAircraft, builder, aircraftData, settings, wing, horizontal, vertical, fus, nac);
+        OswaldFactorCalculator oswaldCalc(builder, wing, fus);
+
+        auto [oswaldTakeOff, oswaldClimb, oswaldCruise, oswaldDescent, oswaldLanding] = oswaldCalc.getOswaldFactor();
+
+        if (flightPhase == "TAKE_OFF")
+        {
+
+            // The boolan argument is needed to activate the landing-gear CD0 calculous.
+            CD0 = cd0Calc.getTotalCD0Aircraft(true);
+            oswaldFactor = oswaldTakeOff;
+        }
+
+        else if (flightPhase == "CLIMB")
+        {
+
+            CD0 = cd0Calc.getTotalCD0Aircraft();
+            oswaldFactor = oswaldClimb;
+        }
+
+        else if (flightPhase == "CRUISE")
+        {
+
+            CD0 = cd0Calc.getTotalCD0Aircraft();
+            oswaldFactor = oswaldCruise;
+        }
+
+        else if (flightPhase == "DESCENT")
+        {
+
+            CD0 = cd0Calc.getTotalCD0Aircraft();
+            oswaldFactor = oswaldDescent;
+        }
+
+        else if (flightPhase == "LANDING")
+        {
+
+            // The boolan argument is needed to activate the landing-gear CD0 calculous.
+            CD0 = cd0Calc.getTotalCD0Aircraft(true);
+            oswaldFactor = oswaldLanding;
+        }
+
+        else
+        {
+
+            std::cerr << "Invalid flight phase specified. Valid options are: TAKE_OFF, CLIMB, CRUISE, DESCENT, LANDING." << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
 public:
     /// @brief Constructor for the CDCalculator class. Initializes the calculator with the necessary aircraft data, settings, and geometric information for the various components of the aircraft. The constructor takes in references to the builder object, aircraft data, aerodynamic settings, and geometric data for the wing, horizontal tail, vertical tail, fuselage, nacelle, canard (optional), boom (optional), and EOIR (optional). This allows the calculator to have access to all relevant information needed for accurate CD calculations across different components of the aircraft.
     /// @param nameOfAircraft The name of the aircraft for which CD is being calculated.
@@ -148,134 +284,130 @@ public:
         settings.Mach = Mach;
         settings.altitude = altitude;
 
-        VSPGEOMTRYEXTRACTOR::GeometryExtractor geomExtractor;
-        geomExtractor.extractAllGeoms(builder.getCommonData().getNameOfAircraft(),
-                                      builder.getCommonData().getNameOfAircraft() + "_AllGeoms.vspscript");
-
-        VSPGEOMTRYEXTRACTOR::AircraftGeometryData allGeomData = geomExtractor.getGeometryData();
-
         try
         {
-            SILENTORCOMPONENT::SilentorComponent silentorAnalysis(builder.getCommonData().getNameOfAircraft(),
-                                                                  "SilentorComponentAnalysis.vspscript");
-
-            std::map<std::string, bool> componentDetected;
-
-            for (const auto &geom : allGeomData.nameOfComponentGeom)
-            {
-
-                if (geom == canard.id)
-                {
-
-                    componentDetected[canard.id] = true;
-                }
+            liftCoeffcient = solveLiftCoefficients().liftCoefficient.front();
+        }
 
-                else
-                {
-                    componentDetected[canard.id] = false;
-                }
+        catch (const std::exception &e)
+        {
+            std::cout << "[CATCH] " << e.what() << std::endl;
+            std::cout.flush();
+            return -1.0;
+        }
+        catch (...)
+        {
+            std::cout << "[CATCH] Unknown exception occurred!" << std::endl;
+            std::cout.flush();
+            return -1.0;
+        }
 
-                if (geom == boom.id)
-                {
+        double CD0 = 0.0;
+        double oswaldFactor = 0.0;
 
-                    componentDetected[boom.id] = true;
-                }
+        if (!getPhaseDragParameters(flightPhase, CD0, oswaldFactor))
+        {
+            return -1.0; // Return an error code or handle as appropriate
+        }
 
-                else
-                {
-                    componentDetected[boom.id] = false;
-                }
+        dragCoefficient = CD0 + std::pow(liftCoeffcient, 2) / (M_PI * oswaldFactor * wing.aspectRatio);
 
-                if (geom == eoir.id)
-                {
+        settings = settingsRestorer.getSettingsToRestore();
 
-                    componentDetected[eoir.id] = true;
-                }
+        return dragCoefficient;
+    }
 
-                else
-                {
-                    componentDetected[eoir.id] = false;
-                }
-            }
+    /// @brief Calculates the drag polar for a set of angles of attack with a single VSPAERO run.
+    /// @details VSPAERO solves all the angles of settings.AoA in one execution; CD0 and the Oswald factor do not depend on the angle of attack and are computed once. Replaces a loop over getCDTotalAircraft, which runs the whole pipeline for every angle.
+    /// @param AoA The angles of attack in degrees.
+    /// @param Mach The Mach number.
+    /// @param altitude The altitude in meters.
+    /// @param flightPhase The flight phase, which can be "TAKE_OFF", "CLIMB", "CRUISE", "DESCENT", or "LANDING".
+    /// @return The polar in the order of AoA; empty arrays if the analysis fails or the flight phase is not valid.
+    DragPolar getDragPolar(const std::vector<double> &AoA, double Mach, double altitude, const std::string &flightPhase)
+    {
+        DragPolar polar;
 
-            std::vector<std::string> componentToSilentor{wing.id, horizontal.id, vertical.id, fus.id};
+        if (AoA.empty())
+        {
+            return polar;
+        }
 
-            for (const auto &entry : componentDetected)
-            {
+        RestoreSettings settingsRestorer; // Create an instance of RestoreSettings to automatically restore settings when going out of scope
 
-                if (entry.second)
-                {
-                    componentToSilentor.push_back(entry.first);
-                }
-            }
+        settingsRestorer.setSavePrevoiusSettings(settings);
 
-            silentorAnalysis.GetGeometryWithThisComponent(aircraftData, allGeomData, componentToSilentor);
+        settings.AoA = AoA;
+        settings.Mach = Mach;
+        settings.altitude = altitude;
 
-            silentorAnalysis.executeAnalysis(settings);
+        SILENTORCOMPONENT::AerodynamicCoefficients coefficients;
 
-            liftCoeffcient = silentorAnalysis.getAerodynamicCoefficients().liftCoefficient.front();
+        try
+        {
+            coefficients = solveLiftCoefficients();
         }
 
         catch (const std::exception &e)
         {
             std::cout << "[CATCH] " << e.what() << std::endl;
             std::cout.flush();
-            return -1.0;
+            settings = settingsRestorer.getSettingsToRestore();
+            return polar;
         }
         catch (...)
         {
             std::cout << "[CATCH] Unknown exception occurred!" << std::endl;
             std::cout.flush();
-            return -1.0;
+            settings = settingsRestorer.getSettingsToRestore();
+            return polar;
         }
 
-        CD0Calculator cd0Calc(nameOfAircraft, builder, aircraftData, settings, wing, horizontal, vertical, fus, nac);
-        OswaldFactorCalculator oswaldCalc(builder, wing, fus);
-
-        auto [oswaldTakeOff, oswaldClimb, oswaldCruise, oswaldDescent, oswaldLanding] = oswaldCalc.getOswaldFactor();
-
-        if (flightPhase == "TAKE_OFF")
+        if (!getPhaseDragParameters(flightPhase, polar.CD0, polar.oswaldFactor))
         {
-
-            // The boolan argument is needed to activate the landing-gear CD0 calculous.
-            dragCoefficient = cd0Calc.getTotalCD0Aircraft(true) + std::pow(liftCoeffcient, 2) / (M_PI * oswaldTakeOff * wing.aspectRatio);
+            settings = settingsRestorer.getSettingsToRestore();
+            return DragPolar();
         }
 
-        else if (flightPhase == "CLIMB")
-        {
-
-            dragCoefficient = cd0Calc.getTotalCD0Aircraft() + std::pow(liftCoeffcient, 2) / (M_PI * oswaldClimb * wing.aspectRatio);
-        }
-
-        else if (flightPhase == "CRUISE")
-        {
+        settings = settingsRestorer.getSettingsToRestore();
 
-            dragCoefficient = cd0Calc.getTotalCD0Aircraft() + std::pow(liftCoeffcient, 2) / (M_PI * oswaldCruise * wing.aspectRatio);
-        }
+        const double inducedFactor = 1.0 / (M_PI * polar.oswaldFactor * wing.aspectRatio);
 
-        else if (flightPhase == "DESCENT")
+        // Righe del .polar abbinate agli angoli richiesti per posizione, nel primo blocco Beta/Mach:
+        // VSPAERO riscrive gli AoA arrotondati (il .vspaero li riporta a 6 cifre), un confronto per valore fallirebbe
+        std::vector<size_t> rows;
+        for (size_t k = 0; k < coefficients.angleOfAttack.size(); ++k)
         {
-
-            dragCoefficient = cd0Calc.getTotalCD0Aircraft() + std::pow(liftCoeffcient, 2) / (M_PI * oswaldDescent * wing.aspectRatio);
+            if (coefficients.sideslipAngle[k] == coefficients.sideslipAngle.front() &&
+                coefficients.machNumber[k] == coefficients.machNumber.front())
+            {
+                rows.push_back(k);
+            }
         }
 
-        else if (flightPhase == "LANDING")
+        if (rows.size() != AoA.size())
         {
-
-            // The boolan argument is needed to activate the landing-gear CD0 calculous.
-            dragCoefficient = cd0Calc.getTotalCD0Aircraft(true) + std::pow(liftCoeffcient, 2) / (M_PI * oswaldLanding * wing.aspectRatio);
+            std::cerr << "getDragPolar: VSPAERO returned " << rows.size() << " angles of attack, "
+                      << AoA.size() << " requested" << std::endl;
+            return DragPolar();
         }
 
-        else
+        for (size_t i = 0; i < AoA.size(); ++i)
         {
-
-            std::cerr << "Invalid flight phase specified. Valid options are: TAKE_OFF, CLIMB, CRUISE, DESCENT, LANDING." << std::endl;
-            return -1.0; // Return an error code or handle as appropriate
+            const double alpha = AoA[i];
+            const double CL = coefficients.liftCoefficient[rows[i]];
+            const double CD = polar.CD0 + CL * CL * inducedFactor;
+
+            polar.angleOfAttack.push_back(alpha);
+            polar.liftCoefficient.push_back(CL);
+            polar.dragCoefficient.push_back(CD);
+            polar.efficiency.push_back(CL / CD);
         }
 
-        settings = settingsRestorer.getSettingsToRestore();
+        liftCoeffcient = polar.liftCoefficient.back();
+        dragCoefficient = polar.dragCoefficient.back();
 
-        return dragCoefficient;
+        return polar;
     }
 
     double getLiftCoefficient() const
@@ -17,7 +17,7 @@
 #include "READPOLARFILE.h"
 #include "ControlSurfaceBuilder.h"
 #include "EQUALSIGNORECASE.h"
-#include "Interpolant.h"
+#include "TabulatedInterpolant.h"
 #include "EnumTypeOfWing.h"
 
 class ChordCalculator
@@ -27,21 +27,43 @@ protected:
    const VSP::Wing &wing;
 
 private:
-    inline static const VSP::Wing *wingPtr = nullptr; // Static pointer to hold the reference to the wing
     constexpr static double eps = 1e-9;
 
-public:
-    ChordCalculator(const VSP::Wing &wing) : wing(wing)
+    // Tratto della distribuzione di corda, interpolato linearmente tra le stazioni
+    struct ChordSegment
+    {
+        double etaMin;
+        double etaMax;
+        TabulatedInterpolant chordInterp;
+    };
+
+    // Tabelle di corda di un'ala per un tipo di ala, costruite una sola volta
+    struct ChordTables
     {
+        TypeOfWing typeOfWing = TypeOfWing::UNKNOWN;
+        std::vector<ChordSegment> segments;       // Ordine di ricerca: inboard, mid, outboard
+        const char *notFoundMessage = "";
+    };
 
-        wingPtr = &wing; // Initialize the static pointer with the reference to the wing
+    ChordTables tables;
+
+    static void addSegment(ChordTables &tables, const std::vector<double> &etaStations, const std::vector<double> &chords)
+    {
+        if (etaStations.empty())
+        {
+            return;
+        }
+        tables.segments.push_back({etaStations.front(), etaStations.back(),
+                                   TabulatedInterpolant(etaStations, chords, TabulatedMethod::LINEAR)});
     }
 
-    /// @brief Calculates the chord length at a given eta station using linear interpolation.
-    /// @param etaStation The dimensionless spanwise station (0 at root, 1 at tip) where the chord length is to be evaluated.
-    /// @return The chord length at the specified eta station.
-    double static getChordAtEtaStation(double etaStation, TypeOfWing typeOfWing = TypeOfWing::UNKNOWN)
+    /// @brief Builds the spanwise chord tables of a wing for the given type of wing.
+    static ChordTables buildTables(const VSP::Wing &wing, TypeOfWing typeOfWing)
     {
+        ChordTables tables;
+        tables.typeOfWing = typeOfWing;
+        tables.notFoundMessage = "Eta station not found in either inboard or outboard stations.";
+
         int j = 0;
 
         switch (typeOfWing)
@@ -51,138 +73,91 @@ public:
         case TypeOfWing::ELLIPTICAL:
         {
 
-            std::vector<double> etaStationInboard;
-            std::vector<double> etaStationMid;
-            std::vector<double> etaStationOutboard;
-            std::vector<double> chordInboard;
-            std::vector<double> chordMid;
-            std::vector<double> chordOutboard;
-
-            if (wingPtr->averageLeadingEdgeSweep == 0.0)
+            if (wing.averageLeadingEdgeSweep == 0.0)
             {
 
-                for (size_t i = 0; i < wingPtr->panelsYStation.size(); ++i)
+                std::vector<double> etaStationInboard;
+                std::vector<double> etaStationMid;
+                std::vector<double> etaStationOutboard;
+                std::vector<double> chordInboard;
+                std::vector<double> chordMid;
+                std::vector<double> chordOutboard;
+
+                for (size_t i = 0; i < wing.panelsYStation.size(); ++i)
                 {
 
                     if (i == 0) 
                     {
-                        etaStationInboard.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
+                        etaStationInboard.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
                         j += 1;
-                        chordInboard.push_back(wingPtr->croot[j - 1]);
+                        chordInboard.push_back(wing.croot[j - 1]);
                     }
 
-                    else if ((wingPtr->croot[j] == wingPtr->croot[j - 1]) && i <= wingPtr->croot.size() - 1)
+                    else if ((wing.croot[j] == wing.croot[j - 1]) && i <= wing.croot.size() - 1)
                     { 
 
-                        etaStationInboard.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
-                        chordInboard.push_back(wingPtr->croot[j]);
+                        etaStationInboard.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
+                        chordInboard.push_back(wing.croot[j]);
                         j += 1;
                     }
-                    else if ((wingPtr->croot[j] != wingPtr->croot[j - 1]) && i <= wingPtr->croot.size() - 1)  //Mid and Outboard region
+                    else if ((wing.croot[j] != wing.croot[j - 1]) && i <= wing.croot.size() - 1)  //Mid and Outboard region
                     {
-                        etaStationMid.push_back(2 * wingPtr->panelsYStation[i - 1] / wingPtr->totalProjectedSpan);
-                        chordMid.push_back(wingPtr->croot[j - 1]);
-                        etaStationMid.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
-                        chordMid.push_back(wingPtr->croot[j]);
-                        etaStationOutboard.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
-                        chordOutboard.push_back(wingPtr->croot[j]);
+                        etaStationMid.push_back(2 * wing.panelsYStation[i - 1] / wing.totalProjectedSpan);
+                        chordMid.push_back(wing.croot[j - 1]);
+                        etaStationMid.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
+                        chordMid.push_back(wing.croot[j]);
+                        etaStationOutboard.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
+                        chordOutboard.push_back(wing.croot[j]);
                     }
 
-                    else if (i > wingPtr->croot.size() - 1) // If we have reached the end of the croot vector, we are in the outboard region
+                    else if (i > wing.croot.size() - 1) // If we have reached the end of the croot vector, we are in the outboard region
                     {
-                        etaStationOutboard.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
-                        chordOutboard.push_back(wingPtr->ctip[i-1]);
+                        etaStationOutboard.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
+                        chordOutboard.push_back(wing.ctip[i-1]);
                     }
                 }
 
-                
-
-                double inboardMin = etaStationInboard.front();
-                double inboardMidMin = etaStationMid.front();
-                double inboardMax = etaStationInboard.back();
-
-                double outboardMin = etaStationOutboard.front();
-                double outboardMidMax = etaStationMid.back();
-                double outboardMax = etaStationOutboard.back();
-
-                bool foundInboard = (etaStation >= inboardMin - eps && etaStation <= inboardMax + eps);
-                bool foundMid     = (etaStation >= inboardMidMin - eps && etaStation <= outboardMidMax + eps);
-                bool foundOutboard = (etaStation >= outboardMin - eps && etaStation <= outboardMax + eps);
-
-                if (foundInboard)
-                {
-                    Interpolant chordInterp(etaStationInboard, chordInboard, 1, RegressionMethod::LINEAR);
-                    return chordInterp.getYValueFromRegression(etaStation);
-                }
-                else if (foundMid)
-                {
-                    Interpolant chordInterp(etaStationMid, chordMid, 1, RegressionMethod::LINEAR);
-                    return chordInterp.getYValueFromRegression(etaStation);
-                }
-                else if (foundOutboard)
-                {
-                    Interpolant chordInterp(etaStationOutboard, chordOutboard, 1, RegressionMethod::LINEAR);
-                    return chordInterp.getYValueFromRegression(etaStation);
-                }
-                else
-                {
-                    throw std::invalid_argument("Eta station not found in either inboard or outboard stations.");
-                }
+                addSegment(tables, etaStationInboard, chordInboard);
+                addSegment(tables, etaStationMid, chordMid);
+                addSegment(tables, etaStationOutboard, chordOutboard);
             }
 
-            else
+            else if (typeOfWing == TypeOfWing::STRAIGHT_TAPERED)
             {
 
                 std::vector<double> etaStationVec;
-                std::vector<double> etaStationMid;
                 std::vector<double> chords;
 
-                for (size_t i = 0; i < wingPtr->panelsYStation.size(); ++i)
+                for (size_t i = 0; i < wing.panelsYStation.size(); ++i)
                 {
 
                     if (i == 0) 
                     {
-                        etaStationVec.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
+                        etaStationVec.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
                         j += 1;
-                        chords.push_back(wingPtr->croot[j - 1]);
+                        chords.push_back(wing.croot[j - 1]);
                     }
 
-                    else if (i <= wingPtr->croot.size() - 1)
+                    else if (i <= wing.croot.size() - 1)
                     { 
 
-                        etaStationVec.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
-                        chords.push_back(wingPtr->croot[j]);
+                        etaStationVec.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
+                        chords.push_back(wing.croot[j]);
                         j += 1;
                     }
 
-                    else if (i > wingPtr->croot.size() - 1) 
+                    else if (i > wing.croot.size() - 1) 
                     {
-                        etaStationVec.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
-                        chords.push_back(wingPtr->ctip[i - 1]);
+                        etaStationVec.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
+                        chords.push_back(wing.ctip[i - 1]);
                     }
                 }
 
-                double etaStationVecMin = etaStationVec.front();
-                double etaStationVecMax = etaStationVec.back();
-
-                bool foundEta = (etaStation >= etaStationVecMin - eps && etaStation <= etaStationVecMax + eps);
-               
-                if (typeOfWing ==TypeOfWing::STRAIGHT_TAPERED) {
-
-                Interpolant chordInterp(etaStationVec, chords, 1, RegressionMethod::LINEAR);
-
-                 return foundEta ? chordInterp.getYValueFromRegression(etaStation) : throw std::invalid_argument("Eta station not found in the stations vector.");
-                }
-
-                else {
-
-                double kFactorToEllipticalApproximation = 1.0 - std::pow((wingPtr->ctip.back() / wingPtr->croot.front()), 2); // This factor can be adjusted based on the specific wing geometry
-                return wingPtr->croot.front() * std::sqrt(1 - kFactorToEllipticalApproximation * std::pow(etaStation, 2));
-
-                }
-
-               
+                addSegment(tables, etaStationVec, chords);
+                tables.notFoundMessage = "Eta station not found in the stations vector.";
             }
+
+            // Ala ellittica a freccia non nulla: approssimazione analitica, nessuna tabella
         }
 
         break;
@@ -199,22 +174,22 @@ public:
             bool addedKinkStation = false;
 
             
-                for (size_t i = 0; i < wingPtr->panelsYStation.size(); ++i)
+                for (size_t i = 0; i < wing.panelsYStation.size(); ++i)
                 {
 
-                    if (i == 0 || (2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan <= 2* wingPtr->kinkStation/ wingPtr->totalProjectedSpan)) 
+                    if (i == 0 || (2 * wing.panelsYStation[i] / wing.totalProjectedSpan <= 2* wing.kinkStation/ wing.totalProjectedSpan)) 
                     { 
-                        etaStationInboard.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
+                        etaStationInboard.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
                         j += 1;
-                        chordInboard.push_back(wingPtr->croot[j - 1]);
+                        chordInboard.push_back(wing.croot[j - 1]);
 
-                        if (2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan == 2* wingPtr->kinkStation/ wingPtr->totalProjectedSpan)
+                        if (2 * wing.panelsYStation[i] / wing.totalProjectedSpan == 2* wing.kinkStation/ wing.totalProjectedSpan)
                         {
                             addedKinkStation = true;
                         }
                     }
 
-                    else if ((2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan > 2* wingPtr->kinkStation/ wingPtr->totalProjectedSpan))
+                    else if ((2 * wing.panelsYStation[i] / wing.totalProjectedSpan > 2* wing.kinkStation/ wing.totalProjectedSpan))
                     {
 
                         etaStationOutboard.push_back(etaStationInboard.back());
@@ -222,53 +197,77 @@ public:
 
                         if (!addedKinkStation)
                         {
-                            etaStationOutboard.push_back(2 * wingPtr->kinkStation/ wingPtr->totalProjectedSpan);
-                            chordOutboard.push_back(wingPtr->taperInbord * wingPtr->croot.front());
+                            etaStationOutboard.push_back(2 * wing.kinkStation/ wing.totalProjectedSpan);
+                            chordOutboard.push_back(wing.taperInbord * wing.croot.front());
 
                             addedKinkStation = true;
                         }
 
-                        etaStationOutboard.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
-                        chordOutboard.push_back(wingPtr->croot[j]);
+                        etaStationOutboard.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
+                        chordOutboard.push_back(wing.croot[j]);
                         j += 1;
                     }
                    
-                    else if (i > wingPtr->croot.size() - 1) // If we have reached the end of the croot vector, we are in the outboard region
+                    else if (i > wing.croot.size() - 1) // If we have reached the end of the croot vector, we are in the outboard region
                     {
-                        etaStationOutboard.push_back(2 * wingPtr->panelsYStation[i] / wingPtr->totalProjectedSpan);
-                        chordOutboard.push_back(wingPtr->ctip[i - 1]);
+                        etaStationOutboard.push_back(2 * wing.panelsYStation[i] / wing.totalProjectedSpan);
+                        chordOutboard.push_back(wing.ctip[i - 1]);
                     }
                 }
 
-                // Dopo aver popolato etaStationInboard e etaStationOutboard:
+                addSegment(tables, etaStationInboard, chordInboard);
+                addSegment(tables, etaStationOutboard, chordOutboard);
+          
+        }
 
-                double inboardMin = etaStationInboard.front();
-                double inboardMax = etaStationInboard.back();
+        break;
 
-                double outboardMin = etaStationOutboard.front();
-                double outboardMax = etaStationOutboard.back();
+        default:
+            break;
+        }
 
-                bool foundInboard = (etaStation >= inboardMin - eps && etaStation <= inboardMax + eps);
-                bool foundOutboard = (etaStation >= outboardMin - eps && etaStation <= outboardMax + eps);
+        return tables;
+    }
 
-                if (foundInboard)
-                {
-                    Interpolant chordInterp(etaStationInboard, chordInboard, 1, RegressionMethod::LINEAR);
-                    return chordInterp.getYValueFromRegression(etaStation);
-                }
-                else if (foundOutboard)
-                {
-                    Interpolant chordInterp(etaStationOutboard, chordOutboard, 1, RegressionMethod::LINEAR);
-                    return chordInterp.getYValueFromRegression(etaStation);
-                }
-                else
-                {
-                    throw std::invalid_argument("Eta station not found in either inboard or outboard stations.");
-                }
-          
+public:
+    /// @brief Builds the chord tables of the wing once, for its own type of wing.
+    ChordCalculator(const VSP::Wing &wing) : wing(wing), tables(buildTables(wing, wing.typeOfWing))
+    {
+    }
+
+    /// @brief Calculates the chord length at a given eta station using linear interpolation.
+    /// @param etaStation The dimensionless spanwise station (0 at root, 1 at tip) where the chord length is to be evaluated.
+    /// @param typeOfWing Type of wing; the tables built by the constructor are reused when it matches wing.typeOfWing.
+    /// @return The chord length at the specified eta station.
+    double getChordAtEtaStation(double etaStation, TypeOfWing typeOfWing = TypeOfWing::UNKNOWN) const
+    {
+        if (typeOfWing == TypeOfWing::UNKNOWN)
+        {
+            return 0.0;
+        }
+
+        if (typeOfWing == TypeOfWing::ELLIPTICAL && wing.averageLeadingEdgeSweep != 0.0)
+        {
+            double kFactorToEllipticalApproximation = 1.0 - std::pow((wing.ctip.back() / wing.croot.front()), 2); // This factor can be adjusted based on the specific wing geometry
+            return wing.croot.front() * std::sqrt(1 - kFactorToEllipticalApproximation * std::pow(etaStation, 2));
+        }
+
+        // Tabelle del costruttore se il tipo coincide, altrimenti costruite per questa chiamata
+        ChordTables otherTables;
+        if (typeOfWing != tables.typeOfWing)
+        {
+            otherTables = buildTables(wing, typeOfWing);
         }
+        const ChordTables &current = (typeOfWing == tables.typeOfWing) ? tables : otherTables;
+
+        for (const ChordSegment &segment : current.segments)
+        {
+            if (etaStation >= segment.etaMin - eps && etaStation <= segment.etaMax + eps)
+            {
+                return segment.chordInterp.evaluate(etaStation);
+            }
         }
 
-        return 0.0;
+        throw std::invalid_argument(current.notFoundMessage);
     }
-};
\ No newline at end of file
+};
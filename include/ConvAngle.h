@@ -1,10 +1,12 @@
 #ifndef CONVANGLE_H
 #define CONVANGLE_H
 
-#include "EnumANGLE.h"
+#include "EnumAngle.h"
 #include <vector>
 #include <iostream>
 #include <type_traits>
+#include <cstddef>
+#include "Units.h"
 
 template <typename T = std::vector<double>>
 /**
@@ -26,7 +28,7 @@ class ConvAngle {
      */
     typename std::enable_if<std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputAngle, outputAngle);
         for (auto& value : valueToConvertAngle)
         {
             value *= conversionFactor;
@@ -40,7 +42,7 @@ class ConvAngle {
      */
     typename std::enable_if<!std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputAngle, outputAngle);
         valueToConvertAngle *= conversionFactor;
     }
 
@@ -48,7 +50,7 @@ class ConvAngle {
      * @brief Returns the multiplicative conversion factor for selected angle units.
      * @return Conversion factor.
      */
-    double getConversionFactor() {
+    static double getConversionFactor(Angle inputAngle, Angle outputAngle) {
         double conversionFactor = 1.0;
 
         if (inputAngle == Angle::DEG && outputAngle == Angle::RAD) {
@@ -85,6 +87,40 @@ class ConvAngle {
     const T& getConvertedValues() const {
         return valueToConvertAngle;
     }
+
+    /**
+     * @brief Converts n contiguous angle values in place, without allocating.
+     * @param inputAngle Source angle unit.
+     * @param outputAngle Target angle unit.
+     * @param data Values to convert.
+     * @param n Number of values.
+     */
+    static void convertInPlace(Angle inputAngle, Angle outputAngle, double* data, size_t n) {
+        UNITS::scale(data, n, getConversionFactor(inputAngle, outputAngle));
+    }
+
+    /**
+     * @brief Converts any contiguous container (std::vector, std::array, Eigen::Map, ...) in place.
+     * @param inputAngle Source angle unit.
+     * @param outputAngle Target angle unit.
+     * @param values Container exposing data() and size().
+     */
+    template <typename Container>
+    static void convertInPlace(Angle inputAngle, Angle outputAngle, Container& values) {
+        convertInPlace(inputAngle, outputAngle, values.data(), static_cast<size_t>(values.size()));
+    }
+
+    /**
+     * @brief Converts n contiguous angle values into a caller-provided buffer, without allocating.
+     * @param inputAngle Source angle unit.
+     * @param outputAngle Target angle unit.
+     * @param src Values to convert.
+     * @param dst Output buffer with room for n values (may be src).
+     * @param n Number of values.
+     */
+    static void convert(Angle inputAngle, Angle outputAngle, const double* src, double* dst, size_t n) {
+        UNITS::scale(src, dst, n, getConversionFactor(inputAngle, outputAngle));
+    }
 };
 
 /**
@@ -6,6 +6,8 @@
 #include <iostream>
 #include <cmath>
 #include <type_traits>
+#include <cstddef>
+#include "Units.h"
 
 template <typename T = std::vector<double>>
 /**
@@ -27,7 +29,7 @@ class ConvArea {
      */
     typename std::enable_if<std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputArea, outputArea);
         for (auto& value : valueToConvertArea)
         {
             value *= conversionFactor;
@@ -41,7 +43,7 @@ class ConvArea {
      */
     typename std::enable_if<!std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputArea, outputArea);
         valueToConvertArea *= conversionFactor;
     }
 
@@ -49,7 +51,7 @@ class ConvArea {
      * @brief Returns the multiplicative conversion factor for selected area units.
      * @return Conversion factor.
      */
-    double getConversionFactor() {
+    static double getConversionFactor(Area inputArea, Area outputArea) {
         double conversionFactor = 1.0;
 
         if (inputArea == Area::SQUARE_METER && outputArea == Area::SQUARE_FEET) {
@@ -86,6 +88,40 @@ class ConvArea {
     const T& getConvertedValues() const {
         return valueToConvertArea;
     }
+
+    /**
+     * @brief Converts n contiguous area values in place, without allocating.
+     * @param inputArea Source area unit.
+     * @param outputArea Target area unit.
+     * @param data Values to convert.
+     * @param n Number of values.
+     */
+    static void convertInPlace(Area inputArea, Area outputArea, double* data, size_t n) {
+        UNITS::scale(data, n, getConversionFactor(inputArea, outputArea));
+    }
+
+    /**
+     * @brief Converts any contiguous container (std::vector, std::array, Eigen::Map, ...) in place.
+     * @param inputArea Source area unit.
+     * @param outputArea Target area unit.
+     * @param values Container exposing data() and size().
+     */
+    template <typename Container>
+    static void convertInPlace(Area inputArea, Area outputArea, Container& values) {
+        convertInPlace(inputArea, outputArea, values.data(), static_cast<size_t>(values.size()));
+    }
+
+    /**
+     * @brief Converts n contiguous area values into a caller-provided buffer, without allocating.
+     * @param inputArea Source area unit.
+     * @param outputArea Target area unit.
+     * @param src Values to convert.
+     * @param dst Output buffer with room for n values (may be src).
+     * @param n Number of values.
+     */
+    static void convert(Area inputArea, Area outputArea, const double* src, double* dst, size_t n) {
+        UNITS::scale(src, dst, n, getConversionFactor(inputArea, outputArea));
+    }
 };
 
 /**
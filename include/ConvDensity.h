@@ -5,6 +5,8 @@
 #include <vector>
 #include <iostream>
 #include <type_traits>
+#include <cstddef>
+#include "Units.h"
 
 template <typename T = std::vector<double>>
 class ConvDensity {
@@ -18,7 +20,7 @@ class ConvDensity {
     template<typename U = T>
     typename std::enable_if<std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputDensity, outputDensity);
         for (auto& value : valueToConvertDensity)
         {
             value *= conversionFactor;
@@ -29,11 +31,11 @@ class ConvDensity {
     template<typename U = T>
     typename std::enable_if<!std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputDensity, outputDensity);
         valueToConvertDensity *= conversionFactor;
     }
 
-    double getConversionFactor() {
+    static double getConversionFactor(Density inputDensity, Density outputDensity) {
         double conversionFactor = 1.0;
 
         if (inputDensity == Density::KG_TO_M3 && outputDensity == Density::SLUGS_TO_FT3) {
@@ -60,6 +62,19 @@ class ConvDensity {
     const T& getConvertedValues() const {
         return valueToConvertDensity;
     }
+
+    static void convertInPlace(Density inputDensity, Density outputDensity, double* data, size_t n) {
+        UNITS::scale(data, n, getConversionFactor(inputDensity, outputDensity));
+    }
+
+    template <typename Container>
+    static void convertInPlace(Density inputDensity, Density outputDensity, Container& values) {
+        convertInPlace(inputDensity, outputDensity, values.data(), static_cast<size_t>(values.size()));
+    }
+
+    static void convert(Density inputDensity, Density outputDensity, const double* src, double* dst, size_t n) {
+        UNITS::scale(src, dst, n, getConversionFactor(inputDensity, outputDensity));
+    }
 };
 
 template<typename T>
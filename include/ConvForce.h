@@ -5,6 +5,8 @@
 #include <vector>
 #include <iostream>
 #include <type_traits>
+#include <cstddef>
+#include "Units.h"
 
 template <typename T = std::vector<double>>
 /**
@@ -26,7 +28,7 @@ class ConvForce {
      */
     typename std::enable_if<std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputForce, outputForce);
 
         for (auto& value : valueToConvertForce)
         {
@@ -41,7 +43,7 @@ class ConvForce {
      */
     typename std::enable_if<!std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputForce, outputForce);
         valueToConvertForce *= conversionFactor;
     }
 
@@ -49,7 +51,7 @@ class ConvForce {
      * @brief Returns the multiplicative conversion factor for selected force units.
      * @return Conversion factor.
      */
-    double getConversionFactor() {
+    static double getConversionFactor(Force inputForce, Force outputForce) {
         double conversionFactor = 1.0;
 
         if (inputForce == Force::NEWTON && outputForce == Force::POUND_FORCE) {
@@ -86,6 +88,40 @@ class ConvForce {
     const T& getConvertedValues() const {
         return valueToConvertForce;
     }
+
+    /**
+     * @brief Converts n contiguous force values in place, without allocating.
+     * @param inputForce Source force unit.
+     * @param outputForce Target force unit.
+     * @param data Values to convert.
+     * @param n Number of values.
+     */
+    static void convertInPlace(Force inputForce, Force outputForce, double* data, size_t n) {
+        UNITS::scale(data, n, getConversionFactor(inputForce, outputForce));
+    }
+
+    /**
+     * @brief Converts any contiguous container (std::vector, std::array, Eigen::Map, ...) in place.
+     * @param inputForce Source force unit.
+     * @param outputForce Target force unit.
+     * @param values Container exposing data() and size().
+     */
+    template <typename Container>
+    static void convertInPlace(Force inputForce, Force outputForce, Container& values) {
+        convertInPlace(inputForce, outputForce, values.data(), static_cast<size_t>(values.size()));
+    }
+
+    /**
+     * @brief Converts n contiguous force values into a caller-provided buffer, without allocating.
+     * @param inputForce Source force unit.
+     * @param outputForce Target force unit.
+     * @param src Values to convert.
+     * @param dst Output buffer with room for n values (may be src).
+     * @param n Number of values.
+     */
+    static void convert(Force inputForce, Force outputForce, const double* src, double* dst, size_t n) {
+        UNITS::scale(src, dst, n, getConversionFactor(inputForce, outputForce));
+    }
 };
 
 /**
@@ -5,6 +5,8 @@
 #include <vector>
 #include <iostream>
 #include <type_traits>
+#include <cstddef>
+#include "Units.h"
 
 template <typename T = std::vector<double>>
 /**
@@ -26,7 +28,7 @@ class ConvLength {
      */
     typename std::enable_if<std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputLength, outputLength);
         for (auto& value : valueToConvertLength)
         {
             value *= conversionFactor;
@@ -40,7 +42,7 @@ class ConvLength {
      */
     typename std::enable_if<!std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputLength, outputLength);
         valueToConvertLength *= conversionFactor;
     }
 
@@ -48,7 +50,7 @@ class ConvLength {
      * @brief Returns the multiplicative conversion factor for selected length units.
      * @return Conversion factor.
      */
-    double getConversionFactor() {
+    static double getConversionFactor(Length inputLength, Length outputLength) {
         double conversionFactor = 1.0;
 
         if (inputLength == Length::M && outputLength == Length::FT) {
@@ -97,6 +99,40 @@ class ConvLength {
     const T& getConvertedValues() const {
         return valueToConvertLength;
     }
+
+    /**
+     * @brief Converts n contiguous length values in place, without allocating.
+     * @param inputLength Source length unit.
+     * @param outputLength Target length unit.
+     * @param data Values to convert.
+     * @param n Number of values.
+     */
+    static void convertInPlace(Length inputLength, Length outputLength, double* data, size_t n) {
+        UNITS::scale(data, n, getConversionFactor(inputLength, outputLength));
+    }
+
+    /**
+     * @brief Converts any contiguous container (std::vector, std::array, Eigen::Map, ...) in place.
+     * @param inputLength Source length unit.
+     * @param outputLength Target length unit.
+     * @param values Container exposing data() and size().
+     */
+    template <typename Container>
+    static void convertInPlace(Length inputLength, Length outputLength, Container& values) {
+        convertInPlace(inputLength, outputLength, values.data(), static_cast<size_t>(values.size()));
+    }
+
+    /**
+     * @brief Converts n contiguous length values into a caller-provided buffer, without allocating.
+     * @param inputLength Source length unit.
+     * @param outputLength Target length unit.
+     * @param src Values to convert.
+     * @param dst Output buffer with room for n values (may be src).
+     * @param n Number of values.
+     */
+    static void convert(Length inputLength, Length outputLength, const double* src, double* dst, size_t n) {
+        UNITS::scale(src, dst, n, getConversionFactor(inputLength, outputLength));
+    }
 };
 
 /**
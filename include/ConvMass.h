@@ -5,6 +5,8 @@
 #include <vector>
 #include <iostream>
 #include <type_traits>
+#include <cstddef>
+#include "Units.h"
 
 template <typename T = std::vector<double>>
 /**
@@ -26,7 +28,7 @@ class ConvMass {
      */
     typename std::enable_if<std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputMass, outputMass);
 
         for (auto& value : valueToConvertMass)
         {
@@ -41,7 +43,7 @@ class ConvMass {
      */
     typename std::enable_if<!std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputMass, outputMass);
         valueToConvertMass *= conversionFactor;
     }
 
@@ -49,7 +51,7 @@ class ConvMass {
      * @brief Returns the multiplicative conversion factor for selected mass units.
      * @return Conversion factor.
      */
-    double getConversionFactor() {
+    static double getConversionFactor(Mass inputMass, Mass outputMass) {
         double conversionFactor = 1.0;
 
         if (inputMass == Mass::KG && outputMass == Mass::LB) {
@@ -101,6 +103,40 @@ class ConvMass {
     const T& getConvertedValues() const {
         return valueToConvertMass;
     }
+
+    /**
+     * @brief Converts n contiguous mass values in place, without allocating.
+     * @param inputMass Source mass unit.
+     * @param outputMass Target mass unit.
+     * @param data Values to convert.
+     * @param n Number of values.
+     */
+    static void convertInPlace(Mass inputMass, Mass outputMass, double* data, size_t n) {
+        UNITS::scale(data, n, getConversionFactor(inputMass, outputMass));
+    }
+
+    /**
+     * @brief Converts any contiguous container (std::vector, std::array, Eigen::Map, ...) in place.
+     * @param inputMass Source mass unit.
+     * @param outputMass Target mass unit.
+     * @param values Container exposing data() and size().
+     */
+    template <typename Container>
+    static void convertInPlace(Mass inputMass, Mass outputMass, Container& values) {
+        convertInPlace(inputMass, outputMass, values.data(), static_cast<size_t>(values.size()));
+    }
+
+    /**
+     * @brief Converts n contiguous mass values into a caller-provided buffer, without allocating.
+     * @param inputMass Source mass unit.
+     * @param outputMass Target mass unit.
+     * @param src Values to convert.
+     * @param dst Output buffer with room for n values (may be src).
+     * @param n Number of values.
+     */
+    static void convert(Mass inputMass, Mass outputMass, const double* src, double* dst, size_t n) {
+        UNITS::scale(src, dst, n, getConversionFactor(inputMass, outputMass));
+    }
 };
 
 /**
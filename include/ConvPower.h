@@ -4,6 +4,8 @@
 #include "EnumPOWER.h"
 #include <vector>
 #include <iostream>
+#include <cstddef>
+#include "Units.h"
 
 template <typename Container = std::vector<double>>
 /**
@@ -24,21 +26,9 @@ private:
      */
     Container convertedValues()
     {
-        double conversionFactor = 1.0;
-
         // Determina il fattore di conversione
-        if (inputPower == Power::HP && outputPower == Power::WATT)
-        {
-
-            conversionFactor = 745.7;
-        }
-        else if (inputPower == Power::WATT && outputPower == Power::HP)
-        {
-
-            conversionFactor = 1.0 / 745.7;
-        }
-
-        else
+        double conversionFactor = getConversionFactor(inputPower, outputPower);
+        if (conversionFactor == 0.0)
         {
             std::cerr << "Conversion not implemented yet!" << std::endl;
             return Container{};
@@ -60,6 +50,23 @@ private:
         return valueToConvertPower;
     }
 
+    /**
+     * @brief Returns the multiplicative factor for the selected power units (0 if not implemented).
+     * @return Conversion factor.
+     */
+    static double getConversionFactor(Power inputPower, Power outputPower)
+    {
+        if (inputPower == Power::HP && outputPower == Power::WATT)
+        {
+            return 745.7;
+        }
+        else if (inputPower == Power::WATT && outputPower == Power::HP)
+        {
+            return 1.0 / 745.7;
+        }
+        return 0.0;
+    }
+
 public:
     /**
      * @brief Constructs the converter and immediately converts the provided value.
@@ -86,6 +93,56 @@ public:
 
         return valueToConvertPower;
     }
+
+    /**
+     * @brief Converts n contiguous power values in place, without allocating.
+     * @param inputPower Source power unit.
+     * @param outputPower Target power unit.
+     * @param data Values to convert.
+     * @param n Number of values.
+     */
+    static void convertInPlace(Power inputPower, Power outputPower, double *data, size_t n)
+    {
+        UNITS::scale(data, n, checkedFactor(inputPower, outputPower));
+    }
+
+    /**
+     * @brief Converts any contiguous container (std::vector, std::array, Eigen::Map, ...) in place.
+     * @param inputPower Source power unit.
+     * @param outputPower Target power unit.
+     * @param values Container exposing data() and size().
+     */
+    template <typename Values>
+    static void convertInPlace(Power inputPower, Power outputPower, Values &values)
+    {
+        convertInPlace(inputPower, outputPower, values.data(), static_cast<size_t>(values.size()));
+    }
+
+    /**
+     * @brief Converts n contiguous power values into a caller-provided buffer, without allocating.
+     * @param inputPower Source power unit.
+     * @param outputPower Target power unit.
+     * @param src Values to convert.
+     * @param dst Output buffer with room for n values (may be src).
+     * @param n Number of values.
+     */
+    static void convert(Power inputPower, Power outputPower, const double *src, double *dst, size_t n)
+    {
+        UNITS::scale(src, dst, n, checkedFactor(inputPower, outputPower));
+    }
+
+private:
+    // Le conversioni bulk lasciano i dati invariati se la coppia non è implementata
+    static double checkedFactor(Power inputPower, Power outputPower)
+    {
+        const double conversionFactor = getConversionFactor(inputPower, outputPower);
+        if (conversionFactor == 0.0)
+        {
+            std::cerr << "Conversion not implemented yet!" << std::endl;
+            return 1.0;
+        }
+        return conversionFactor;
+    }
 };
 
 /**
@@ -5,6 +5,8 @@
 #include <vector>
 #include <iostream>
 #include <type_traits>
+#include <cstddef>
+#include "Units.h"
 
 template <typename T = std::vector<double>>
 /**
@@ -26,7 +28,7 @@ class ConvPressure {
      */
     typename std::enable_if<std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputPressure, outputPressure);
         for (auto& value : valueToConvertPressure)
         {
             value *= conversionFactor;
@@ -40,7 +42,7 @@ class ConvPressure {
      */
     typename std::enable_if<!std::is_class<U>::value>::type
     convertedValues() {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputPressure, outputPressure);
         valueToConvertPressure *= conversionFactor;
     }
 
@@ -48,7 +50,7 @@ class ConvPressure {
      * @brief Returns the multiplicative conversion factor for selected pressure units.
      * @return Conversion factor.
      */
-    double getConversionFactor() {
+    static double getConversionFactor(Pressure inputPressure, Pressure outputPressure) {
         double conversionFactor = 1.0;
 
         if (inputPressure == Pressure::PASCALS && outputPressure == Pressure::PSF) {
@@ -85,6 +87,40 @@ class ConvPressure {
     const T& getConvertedValues() const {
         return valueToConvertPressure;
     }
+
+    /**
+     * @brief Converts n contiguous pressure values in place, without allocating.
+     * @param inputPressure Source pressure unit.
+     * @param outputPressure Target pressure unit.
+     * @param data Values to convert.
+     * @param n Number of values.
+     */
+    static void convertInPlace(Pressure inputPressure, Pressure outputPressure, double* data, size_t n) {
+        UNITS::scale(data, n, getConversionFactor(inputPressure, outputPressure));
+    }
+
+    /**
+     * @brief Converts any contiguous container (std::vector, std::array, Eigen::Map, ...) in place.
+     * @param inputPressure Source pressure unit.
+     * @param outputPressure Target pressure unit.
+     * @param values Container exposing data() and size().
+     */
+    template <typename Container>
+    static void convertInPlace(Pressure inputPressure, Pressure outputPressure, Container& values) {
+        convertInPlace(inputPressure, outputPressure, values.data(), static_cast<size_t>(values.size()));
+    }
+
+    /**
+     * @brief Converts n contiguous pressure values into a caller-provided buffer, without allocating.
+     * @param inputPressure Source pressure unit.
+     * @param outputPressure Target pressure unit.
+     * @param src Values to convert.
+     * @param dst Output buffer with room for n values (may be src).
+     * @param n Number of values.
+     */
+    static void convert(Pressure inputPressure, Pressure outputPressure, const double* src, double* dst, size_t n) {
+        UNITS::scale(src, dst, n, getConversionFactor(inputPressure, outputPressure));
+    }
 };
 
 /**
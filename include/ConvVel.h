@@ -5,6 +5,8 @@
 #include <vector>
 #include <iostream>
 #include <type_traits>
+#include <cstddef>
+#include "Units.h"
 
 template <typename T = std::vector<double>>
 /**
@@ -27,7 +29,7 @@ private:
     typename std::enable_if<std::is_class<U>::value>::type
     convertedValues()
     {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputSpeed, outputSpeed);
         for (auto &value : valueToConvertSpeed)
         {
             value *= conversionFactor;
@@ -42,7 +44,7 @@ private:
     typename std::enable_if<!std::is_class<U>::value>::type
     convertedValues()
     {
-        double conversionFactor = getConversionFactor();
+        double conversionFactor = getConversionFactor(inputSpeed, outputSpeed);
         valueToConvertSpeed *= conversionFactor;
     }
 
@@ -50,7 +52,7 @@ private:
      * @brief Returns the multiplicative factor for the selected speed-unit conversion.
      * @return Conversion factor.
      */
-    double getConversionFactor()
+    static double getConversionFactor(Speed inputSpeed, Speed outputSpeed)
     {
         double conversionFactor = 1.0;
 
@@ -151,6 +153,43 @@ public:
     {
         return valueToConvertSpeed;
     }
+
+    /**
+     * @brief Converts n contiguous speed values in place, without allocating.
+     * @param inputSpeed Source speed unit.
+     * @param outputSpeed Target speed unit.
+     * @param data Values to convert.
+     * @param n Number of values.
+     */
+    static void convertInPlace(Speed inputSpeed, Speed outputSpeed, double* data, size_t n)
+    {
+        UNITS::scale(data, n, getConversionFactor(inputSpeed, outputSpeed));
+    }
+
+    /**
+     * @brief Converts any contiguous container (std::vector, std::array, Eigen::Map, ...) in place.
+     * @param inputSpeed Source speed unit.
+     * @param outputSpeed Target speed unit.
+     * @param values Container exposing data() and size().
+     */
+    template <typename Container>
+    static void convertInPlace(Speed inputSpeed, Speed outputSpeed, Container& values)
+    {
+        convertInPlace(inputSpeed, outputSpeed, values.data(), static_cast<size_t>(values.size()));
+    }
+
+    /**
+     * @brief Converts n contiguous speed values into a caller-provided buffer, without allocating.
+     * @param inputSpeed Source speed unit.
+     * @param outputSpeed Target speed unit.
+     * @param src Values to convert.
+     * @param dst Output buffer with room for n values (may be src).
+     * @param n Number of values.
+     */
+    static void convert(Speed inputSpeed, Speed outputSpeed, const double* src, double* dst, size_t n)
+    {
+        UNITS::scale(src, dst, n, getConversionFactor(inputSpeed, outputSpeed));
+    }
 };
 
 /**
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <numeric>
 #include "VSPGEOMETRYEXTRACTOR.h"
+#include "PROCESSRUNNER.h"
 
 namespace VSPGEOMTRYEXTRACTOR
 {
@@ -27,8 +28,12 @@ namespace VSPGEOMTRYEXTRACTOR
         std::vector<double> xStation;
     };
 
+    class GeometrySession;
+
     class DiametersExtractor
     {
+        friend class GeometrySession; // Riusa gli script delle sezioni e i parser nella sessione unica
+
     private:
         std::ofstream file;
         std::string parentFolder;
@@ -62,32 +67,8 @@ namespace VSPGEOMTRYEXTRACTOR
 
         inline std::string executeCommand(const std::string &command)
         {
-            std::string result;
-
-#ifdef _WIN32
-            FILE *pipe = _popen(command.c_str(), "r");
-#else
-            FILE *pipe = popen(command.c_str(), "r");
-#endif
-
-            if (!pipe)
-            {
-                throw std::runtime_error("Failed to execute command: " + command);
-            }
-
-            char buffer[256];
-            while (fgets(buffer, sizeof(buffer), pipe) != nullptr)
-            {
-                result += buffer;
-            }
-
-#ifdef _WIN32
-            _pclose(pipe);
-#else
-            pclose(pipe);
-#endif
-
-            return result;
+            // posix_spawn/CreateProcess con pipe a blocchi grandi; timeout da PROCESS::defaults()
+            return PROCESS::captureOutput(command);
         }
 
         inline void createDiametersScript(
@@ -138,11 +119,14 @@ namespace VSPGEOMTRYEXTRACTOR
             scriptFile.close();
         }
 
-        inline void writeFuselageTypeScript(const std::string &fuselageID)
+        /// @param fuselageID Component ID, or the name of a script variable holding it when idIsScriptVariable is true.
+        inline void writeFuselageTypeScript(const std::string &fuselageID, bool idIsScriptVariable = false)
         {
+            const std::string idExpression = idIsScriptVariable ? fuselageID : "\"" + fuselageID + "\"";
+
             writeComment("Fuselage type - using XLocPercent");
 
-            writeCommand("string xsec_surf = GetXSecSurf(\"" + fuselageID + "\", 0);");
+            writeCommand("string xsec_surf = GetXSecSurf(" + idExpression + ", 0);");
             file << "\r\n";
 
             writeCommand("int num_xsecs = GetNumXSec(xsec_surf);");
@@ -209,11 +193,14 @@ namespace VSPGEOMTRYEXTRACTOR
             file << "\r\n";
         }
 
-        inline void writeStackTypeScript(const std::string &componentID)
+        /// @param componentID Component ID, or the name of a script variable holding it when idIsScriptVariable is true.
+        inline void writeStackTypeScript(const std::string &componentID, bool idIsScriptVariable = false)
         {
+            const std::string idExpression = idIsScriptVariable ? componentID : "\"" + componentID + "\"";
+
             writeComment("Stack type - using XDelta cumulative");
 
-            writeCommand("string xsec_surf = GetXSecSurf(\"" + componentID + "\", 0);");
+            writeCommand("string xsec_surf = GetXSecSurf(" + idExpression + ", 0);");
             file << "\r\n";
 
             writeCommand("int num_xsecs = GetNumXSec(xsec_surf);");
@@ -295,26 +282,29 @@ namespace VSPGEOMTRYEXTRACTOR
             file << "\r\n";
         }
 
-        inline void writeCustomFuselageScript(const std::string &fuselageID)
+        /// @param fuselageID Component ID, or the name of a script variable holding it when idIsScriptVariable is true.
+        inline void writeCustomFuselageScript(const std::string &fuselageID, bool idIsScriptVariable = false)
         {
+            const std::string idExpression = idIsScriptVariable ? fuselageID : "\"" + fuselageID + "\"";
+
             writeComment("Custom fuselage type");
 
-            writeCommand("string xsec_surf = GetXSecSurf(\"" + fuselageID + "\", 0);");
+            writeCommand("string xsec_surf = GetXSecSurf(" + idExpression + ", 0);");
             file << "\r\n";
 
-            writeCommand("string fuseLengthID = FindParm(\"" + fuselageID + "\",\"Length\",\"Design\");");
+            writeCommand("string fuseLengthID = FindParm(" + idExpression + ",\"Length\",\"Design\");");
             file << "\r\n";
 
-            writeCommand("string fuseDiamID = FindParm(\"" + fuselageID + "\",\"Diameter\",\"Design\");");
+            writeCommand("string fuseDiamID = FindParm(" + idExpression + ",\"Diameter\",\"Design\");");
             file << "\r\n";
 
-            writeCommand("string noseMultID = FindParm(\"" + fuselageID + "\",\"NoseMult\",\"Design\");");
+            writeCommand("string noseMultID = FindParm(" + idExpression + ",\"NoseMult\",\"Design\");");
             file << "\r\n";
 
-            writeCommand("string aftMultID = FindParm(\"" + fuselageID + "\",\"AftMult\",\"Design\");");
+            writeCommand("string aftMultID = FindParm(" + idExpression + ",\"AftMult\",\"Design\");");
             file << "\r\n";
 
-            writeCommand("string aftWidthtID = FindParm(\"" + fuselageID + "\",\"AftWidth\",\"Design\");");
+            writeCommand("string aftWidthtID = FindParm(" + idExpression + ",\"AftWidth\",\"Design\");");
             file << "\r\n";
 
             writeCommand("double fuselageLength =  GetParmVal( fuseLengthID );");
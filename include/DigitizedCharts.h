@@ -0,0 +1,2218 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include "Interpolant.h"
+#include "Interpolant2D.h"
+#include "Interpolant3D.h"
+#include "RegressionMethod.h"
+#include "RegressionModel.h"
+
+/**
+ * @brief Registry of the digitized DATCOM / Roskam / NACA charts used by the calculators
+ *
+ * Every chart is stored once as constexpr tables and fitted once, the first time
+ * it is requested, into an immutable chart object (RegressionModel, Interpolant2D
+ * or Interpolant3D). The accessors return a const reference to a function-local
+ * static, so initialization is thread-safe and all calculators share the same
+ * fitted coefficients instead of refitting the data inside their methods.
+ *
+ * Example:
+ * @code
+ * double Kb = DIGITIZED_CHARTS::flapSpanFactorKb().interpolate(eta, taperRatio);
+ * double R  = DIGITIZED_CHARTS::endplateFactorR().evaluate(hv / bh);
+ * @endcode
+ */
+namespace DIGITIZED_CHARTS
+{
+    // ============================================================
+    // Raw digitized tables
+    // ============================================================
+
+    /// Longitudinal stability charts (Roskam / Perkins & Hage / NACA TN-775)
+    namespace LONGITUDINAL
+    {
+        //  Define endplate effect data for H-tail and U-tail configurations
+        // These vectors represent the relationship between vertical tail height ratio
+        // and the efficiency factor for the horizontal tail
+        inline constexpr double endplateHeighToHorizontalSpanRatio[] = {
+            4.06276e-05, 0.00813568, 0.0169297, 0.0281854, 0.0436553,
+            0.0573680, 0.0752977, 0.0907630, 0.109042, 0.122046,
+            0.139617, 0.158946, 0.179324, 0.198296, 0.220077,
+            0.240100, 0.259770, 0.288572, 0.319826, 0.348973,
+            0.379170, 0.400238};
+
+        inline constexpr double factorRToHorizontalTailContribution[] = {
+            0.997912, 0.979178, 0.962534, 0.941731, 0.918168,
+            0.896681, 0.870349, 0.850263, 0.825324, 0.808702,
+            0.788627, 0.765084, 0.745023, 0.726346, 0.706293,
+            0.689012, 0.673120, 0.650322, 0.631014, 0.613085,
+            0.596553, 0.584841};
+
+        // AR = 4.0
+        inline constexpr double x_AR4[] = {
+            1.987690, 1.882740, 1.774640, 1.618870, 1.488560, 1.392180,
+            1.254540, 1.178300, 1.091490, 1.023750, 0.960280, 0.882022,
+            0.805917, 0.738358, 0.668714, 0.618095, 0.563305, 0.516943,
+            0.464390, 0.422469, 0.387092, 0.355955, 0.331126, 0.302226,
+            0.283739, 0.271578, 0.261451};
+        inline constexpr double y_AR4[] = {
+            0.050866, 0.048525, 0.049383, 0.053791, 0.061171, 0.069339,
+            0.087354, 0.096420, 0.109800, 0.120915, 0.136225, 0.157999,
+            0.183987, 0.218368, 0.256997, 0.289128, 0.329754, 0.363968,
+            0.419383, 0.478945, 0.561724, 0.644469, 0.720818, 0.818352,
+            0.892536, 0.962438, 1.021750};
+
+        // AR = 6.0
+        inline constexpr double x_AR6[] = {
+            1.990130, 1.913810, 1.848090, 1.792470, 1.708250, 1.624030,
+            1.538210, 1.474690, 1.400020, 1.326960, 1.255480, 1.191990,
+            1.112620, 1.036470, 0.949220, 0.874730, 0.816087, 0.762289,
+            0.721171, 0.664194, 0.610485, 0.577303, 0.539452, 0.492178,
+            0.444966, 0.410536, 0.377657, 0.343454, 0.318751, 0.291008,
+            0.271138, 0.254182};
+        inline constexpr double y_AR6[] = {
+            0.092095, 0.090585, 0.088992, 0.092077, 0.097504, 0.102932,
+            0.106786, 0.115222, 0.122160, 0.130673, 0.139172, 0.152368,
+            0.167276, 0.186918, 0.211407, 0.240555, 0.263232, 0.295388,
+            0.322685, 0.354867, 0.398129, 0.423776, 0.462152, 0.514882,
+            0.575543, 0.644036, 0.707757, 0.804805, 0.897018, 1.006710,
+            1.106810, 1.173580};
+
+        // AR = 9.0
+        inline constexpr double x_AR9[] = {
+            1.978750, 1.913580, 1.842040, 1.762560, 1.662440, 1.551230,
+            1.447980, 1.351100, 1.247900, 1.166990, 1.094010, 1.011530,
+            0.929097, 0.851491, 0.778604, 0.701086, 0.639517, 0.577934,
+            0.525979, 0.482010, 0.434975, 0.403750, 0.370997, 0.347771,
+            0.318248, 0.295022, 0.275038, 0.256643};
+        inline constexpr double y_AR9[] = {
+            0.127089, 0.127606, 0.128173, 0.130390, 0.134357, 0.144758,
+            0.155097, 0.168557, 0.185241, 0.206507, 0.226124, 0.250576,
+            0.279787, 0.316892, 0.347613, 0.395823, 0.450253, 0.503096,
+            0.566968, 0.635536, 0.718408, 0.790048, 0.869633, 0.947555,
+            1.033460, 1.111380, 1.197210, 1.283030};
+
+        // AR = 12.0
+        inline constexpr double x_AR12[] = {
+            1.985290, 1.910570, 1.808870, 1.689720, 1.592820, 1.473690,
+            1.384750, 1.295880, 1.199070, 1.116580, 1.051570, 0.988131,
+            0.919988, 0.851845, 0.780598, 0.723658, 0.668384, 0.613199,
+            0.554859, 0.502967, 0.462216, 0.426157, 0.396660, 0.367087,
+            0.336013, 0.314452, 0.285081, 0.272894, 0.254563};
+        inline constexpr double y_AR12[] = {
+            0.149248, 0.149840, 0.155407, 0.165871, 0.176159, 0.189796,
+            0.201607, 0.221350, 0.242742, 0.265607, 0.286748, 0.306289,
+            0.333800, 0.361311, 0.398366, 0.435307, 0.481754, 0.539306,
+            0.600056, 0.671860, 0.745162, 0.808908, 0.897986, 0.977546,
+            1.068220, 1.155650, 1.260590, 1.327320, 1.421070};
+
+        // A_curve - Fuselage contribution to longitudinal stability (segments 1-5)
+        inline constexpr double x_A_curve[] = {
+            0.605743, 0.671295, 0.748693, 0.825047, 0.917079,
+            1.019570, 1.125180, 1.233930, 1.329070, 1.425260,
+            1.513080, 1.599860, 1.684540, 1.758770, 1.839270,
+            1.919760, 1.993980};
+        inline constexpr double y_A_curve[] = {
+            1.319030, 1.290740, 1.262570, 1.234400, 1.206390,
+            1.175850, 1.153250, 1.133320, 1.118510, 1.106350,
+            1.096740, 1.081850, 1.074840, 1.070350, 1.063290,
+            1.058870, 1.057020};
+
+        // B_curve - Fuselage contribution to longitudinal stability (segments 7-14)
+        inline constexpr double x_B_curve[] = {
+            0.151462, 0.157874, 0.168501, 0.179112, 0.190771,
+            0.202427, 0.218281, 0.232049, 0.252097, 0.271095,
+            0.294279, 0.316374, 0.333221, 0.352154, 0.375281,
+            0.400495, 0.421518, 0.449872, 0.478221, 0.505508,
+            0.535926, 0.571579, 0.606174, 0.648094, 0.682662,
+            0.724561, 0.764343, 0.804133, 0.848092, 0.893087,
+            0.931801, 0.951670};
+        inline constexpr double y_B_curve[] = {
+            4.004220, 3.919980, 3.814710, 3.719970, 3.622610,
+            3.527890, 3.422670, 3.314790, 3.201720, 3.091260,
+            2.978210, 2.891500, 2.817910, 2.746970, 2.668180,
+            2.592040, 2.521130, 2.442380, 2.366280, 2.300700,
+            2.237790, 2.169660, 2.109430, 2.044010, 1.999580,
+            1.947330, 1.910860, 1.869130, 1.835340, 1.806830,
+            1.783530, 1.778470};
+
+        // Kf factor - fuselage longitudinal
+        // X = Position of 1/4 root chord on body or on nacelle  [% body length -  % nacelle length]
+        // Y = Kf
+
+        inline constexpr double Kf_x[] = {
+            9.94695, 11.9966, 14.1773, 16.358, 18.6262,
+            20.1093, 21.3744, 23.25, 24.9951, 26.4349,
+            27.7438, 28.9363, 29.9544, 31.4091, 32.4273,
+            33.6491, 34.6965, 36.1803, 37.5479, 38.8572,
+            39.9923, 41.5055, 42.4369, 43.6592, 44.6781,
+            45.7549, 46.6283, 47.5889, 48.6371, 49.4525,
+            50.1803, 51.0538, 52.044, 53.005, 53.7916,
+            54.578, 55.4227, 56.093, 56.8213, 57.521,
+            58.1622, 58.8616, 59.5025, 60.0272};
+
+        inline constexpr double Kf_y[] = {
+            0.00430785, 0.00454115, 0.00493495, 0.00532875, 0.00596375,
+            0.00644088, 0.00683837, 0.00739444, 0.00819258, 0.00885775,
+            0.00949661, 0.0100823, 0.0106149, 0.011629, 0.012269,
+            0.0130156, 0.0137628, 0.0148304, 0.0159521, 0.0169667,
+            0.0180894, 0.0194253, 0.0203877, 0.0216174, 0.0228479,
+            0.0238634, 0.0249334, 0.0260568, 0.0274482, 0.0286795,
+            0.0296428, 0.0307665, 0.0323192, 0.0338183, 0.0352644,
+            0.0364958, 0.0379417, 0.0393346, 0.0407273, 0.0424422,
+            0.0437816, 0.0452817, 0.04646, 0.0476925};
+
+        // Vee Tail solope of normal force - NACA report TN-775
+
+        inline constexpr double aspectRatioOfVeeTail[] = {
+            0.285597, 0.406789, 0.552166, 0.687835, 0.817453,
+            1.04627, 1.22066, 1.43492, 1.62732, 1.83428,
+            2.07749, 2.34244, 2.59284, 2.93755, 3.20605,
+            3.47816, 3.76110, 3.93884, 4.11292, 4.27614,
+            4.44658, 4.68954, 4.85634, 5.07031, 5.29874,
+            5.56709, 5.78101, 5.90791, 5.99851};
+
+        inline constexpr double slopeOfNormalForce[] = {
+            // Values in 1/deg
+            0.0232337, 0.0255985, 0.0281375, 0.0304137, 0.0326242,
+            0.0357734, 0.0384645, 0.0412192, 0.0433162, 0.0458078,
+            0.0483631, 0.0509830, 0.0532085, 0.0560873, 0.0582458,
+            0.0603383, 0.0622324, 0.0633420, 0.0643201, 0.0652989,
+            0.0661454, 0.0673171, 0.0680980, 0.0692055, 0.0701804,
+            0.0714824, 0.0723264, 0.0728461, 0.0729726};
+
+    } // namespace LONGITUDINAL
+
+    /// Control surface effectiveness charts shared by longitudinal, lateral and directional analyses
+    namespace FLAP_EFFECTIVENESS
+    {
+        // K_b chart - taper_ratio = 0.0
+        inline constexpr double x_Kb_taper0[] = {
+            0.00E+00, 6.08E-02, 1.22E-01, 1.84E-01, 2.43E-01, 3.24E-01,
+            4.07E-01, 5.08E-01, 5.53E-01, 6.34E-01, 6.99E-01, 7.60E-01,
+            8.18E-01, 8.83E-01, 9.21E-01};
+
+        inline constexpr double y_Kb_taper0[] = {
+            2.18E-03, 9.83E-02, 1.92E-01, 2.77E-01, 3.65E-01, 4.72E-01,
+            5.70E-01, 6.88E-01, 7.34E-01, 8.08E-01, 8.62E-01, 9.08E-01,
+            9.41E-01, 9.74E-01, 9.89E-01};
+
+        // K_b chart - taper_ratio = 0.5
+        inline constexpr double x_Kb_taper05[] = {
+            0.00E+00, 5.85E-02, 1.21E-01, 1.62E-01, 2.65E-01, 3.46E-01,
+            4.29E-01, 5.13E-01, 5.76E-01, 6.54E-01, 7.15E-01, 7.78E-01,
+            9.19E-01, 9.39E-01, 9.62E-01, 9.84E-01};
+
+        inline constexpr double y_Kb_taper05[] = {
+            -2.18E-03, 8.52E-02, 1.68E-01, 2.21E-01, 3.52E-01, 4.52E-01,
+            5.50E-01, 6.44E-01, 7.07E-01, 7.88E-01, 8.41E-01, 8.89E-01,
+            9.72E-01, 9.80E-01, 9.91E-01, 9.98E-01};
+
+        // K_b chart - taper_ratio = 1.0
+        inline constexpr double x_Kb_taper1[] = {
+            0.00E+00, 4.05E-02, 1.03E-01, 1.84E-01, 2.65E-01, 3.48E-01,
+            4.50E-01, 5.31E-01, 6.11E-01, 7.17E-01, 7.98E-01, 8.41E-01,
+            9.01E-01, 9.42E-01, 9.64E-01, 9.84E-01};
+
+        inline constexpr double y_Kb_taper1[] = {
+            0.00E+00, 5.24E-02, 1.29E-01, 2.31E-01, 3.30E-01, 4.26E-01,
+            5.46E-01, 6.35E-01, 7.18E-01, 8.19E-01, 8.84E-01, 9.19E-01,
+            9.54E-01, 9.78E-01, 9.87E-01, 9.93E-01};
+
+        // Ratio flap effectiveness alphaCL/alphaCl - cf/c = 0.1
+        inline constexpr double x_RatioFlapEff_cf01[] = {
+            1.35949, 1.46280, 1.52965, 1.64724, 1.81544, 1.98381, 2.16047,
+            2.39659, 2.58204, 2.77607, 3.05486, 3.34220, 3.62134, 4.01930,
+            4.34114, 4.73078, 5.17996, 5.55287, 5.95130, 6.45159, 7.01142,
+            7.54586, 8.04649, 8.64891, 9.15807, 9.70132, 9.99854};
+
+        inline constexpr double y_RatioFlapEff_cf01[] = {
+            1.99953, 1.95765, 1.92582, 1.88727, 1.83867, 1.79509, 1.74564,
+            1.69618, 1.65510, 1.61653, 1.57291, 1.53096, 1.49739, 1.46126,
+            1.43437, 1.40327, 1.37466, 1.35109, 1.32836, 1.30392, 1.28197,
+            1.26254, 1.24814, 1.22952, 1.21596, 1.20573, 1.20396};
+
+        // Ratio flap effectiveness alphaCL/alphaCl - cf/c = 0.2
+        inline constexpr double x_RatioFlapEff_cf02[] = {
+            0.546869, 0.587865, 0.637211, 0.720417, 0.837250, 0.970985,
+            1.11385, 1.28219, 1.45042, 1.67805, 1.91446, 2.19328,
+            2.48940, 2.73476, 3.05640, 3.36133, 3.61548, 3.91201,
+            4.25947, 4.64088, 5.05646, 5.57385, 6.10820, 6.74468,
+            7.25390, 8.04338, 8.70557, 9.35091, 10.0557};
+
+        inline constexpr double y_RatioFlapEff_cf02[] = {
+            1.99813, 1.95543, 1.90854, 1.85829, 1.79798, 1.73516,
+            1.69075, 1.64633, 1.59856, 1.54910, 1.50800, 1.46522,
+            1.43164, 1.40393, 1.37118, 1.34681, 1.32747, 1.30561,
+            1.28289, 1.25932, 1.24161, 1.22051, 1.19857, 1.18245,
+            1.17056, 1.15774, 1.14831, 1.14307, 1.13865};
+
+        // Ratio flap effectiveness alphaCL/alphaCl - cf/c = 0.3
+        inline constexpr double x_RatioFlapEff_cf03[] = {
+            0.215702, 0.231391, 0.263519, 0.295733, 0.353169, 0.436114,
+            0.527929, 0.619772, 0.711933, 0.846244, 0.964030, 1.08185,
+            1.25909, 1.41946, 1.65592, 1.82493, 2.03646, 2.28186,
+            2.51047, 2.78998, 3.06955, 3.37460, 3.68829, 4.04436,
+            4.39208, 4.82479, 5.47820, 6.16564, 6.79380, 7.33716,
+            8.05875, 8.83136, 9.46827, 10.0118};
+
+        inline constexpr double y_RatioFlapEff_cf03[] = {
+            2.00075, 1.96308, 1.90950, 1.85843, 1.79982, 1.74203,
+            1.69513, 1.64906, 1.61220, 1.56612, 1.53343, 1.50159,
+            1.46888, 1.43953, 1.40011, 1.37494, 1.35143, 1.32457,
+            1.30356, 1.28087, 1.25985, 1.23882, 1.22198, 1.20261,
+            1.18742, 1.17388, 1.15609, 1.13995, 1.12886, 1.12198,
+            1.11086, 1.10139, 1.09783, 1.09598};
+
+        // Ratio flap effectiveness alphaCL/alphaCl - cf/c = 0.4
+        inline constexpr double x_RatioFlapEff_cf04[] = {
+            0.0188759, 0.0336701, 0.0494166, 0.0989646, 0.115000, 0.147301,
+            0.204563, 0.246050, 0.329429, 0.413038, 0.505026, 0.647946,
+            0.774111, 0.951295, 1.09465, 1.23806, 1.39860, 1.61005,
+            1.84678, 2.28712, 2.72769, 3.30431, 3.94050, 4.44111,
+            5.12008, 5.76528, 6.59720, 7.48872, 8.00669, 9.03422,
+            10.0278};
+
+        inline constexpr double y_RatioFlapEff_cf04[] = {
+            1.95813, 1.89451, 1.85851, 1.81748, 1.78985, 1.74129,
+            1.67766, 1.64918, 1.60396, 1.56542, 1.52354, 1.48080,
+            1.44477, 1.41039, 1.38021, 1.35170, 1.32737, 1.30135,
+            1.26947, 1.23082, 1.19886, 1.17105, 1.14656, 1.13132,
+            1.11603, 1.10661, 1.09294, 1.08343, 1.07907, 1.07287,
+            1.06584};
+
+        // Ratio flap effectiveness alphaCL/alphaCl - cf/c = 0.5
+        inline constexpr double x_RatioFlapEff_cf05[] = {
+            0.0344589, 0.0504073, 0.0835163, 0.133122, 0.191135, 0.266049,
+            0.366559, 0.500870, 0.635442, 0.795494, 0.998188, 1.24321,
+            1.55643, 1.96297, 2.29351, 2.64108, 3.03124, 3.58273,
+            4.09191, 5.02561, 6.05289, 7.02934, 8.02290, 8.99941,
+            10.0186};
+
+        inline constexpr double y_RatioFlapEff_cf05[] = {
+            1.67102, 1.64088, 1.61576, 1.57640, 1.53453, 1.49014,
+            1.44909, 1.40301, 1.36446, 1.32590, 1.29235, 1.25460,
+            1.22436, 1.19075, 1.16971, 1.15034, 1.13431, 1.11654,
+            1.10382, 1.08593, 1.07219, 1.06266, 1.05646, 1.04860,
+            1.04659};
+
+        // Ratio flap effectiveness alphaCL/alphaCl - cf/c = 0.6
+        inline constexpr double x_RatioFlapEff_cf06[] = {
+            0.0117000, 0.0614212, 0.127899, 0.202726, 0.295089, 0.429631,
+            0.564289, 0.724774, 0.936106, 1.17312, 1.49496, 1.79154,
+            2.19011, 2.63115, 3.01293, 3.40326, 4.02295, 4.52385,
+            5.01625, 5.69546, 6.32379, 7.07958, 8.03070, 9.02446,
+            10.0011};
+
+        inline constexpr double y_RatioFlapEff_cf06[] = {
+            1.50362, 1.46761, 1.42490, 1.37800, 1.34700, 1.30761,
+            1.27157, 1.24557, 1.21620, 1.19269, 1.16579, 1.14560,
+            1.12706, 1.10849, 1.09581, 1.08480, 1.07455, 1.06768,
+            1.06082, 1.05222, 1.04615, 1.04171, 1.03637, 1.03604,
+            1.03153};
+
+        // Ratio flap effectiveness alphaCL/alphaCl - cf/c = 0.7
+        inline constexpr double x_RatioFlapEff_cf07[] = {
+            0.0152880, 0.0564866, 0.148561, 0.240952, 0.426341, 0.578448,
+            0.781460, 1.02717, 1.38310, 1.75615, 2.23119, 2.66397,
+            3.20722, 3.86085, 5.02405, 6.05999, 7.00265, 8.02180,
+            8.98999, 10.0093};
+
+        inline constexpr double y_RatioFlapEff_cf07[] = {
+            1.36132, 1.32448, 1.28510, 1.25494, 1.21219, 1.18954,
+            1.16519, 1.14753, 1.12398, 1.10460, 1.08686, 1.07500,
+            1.06477, 1.05367, 1.04073, 1.03201, 1.02751, 1.02466,
+            1.02182, 1.02316};
+
+        // Ratio flap effectiveness alphaCL/alphaCl - cf/c = 0.8
+        inline constexpr double x_RatioFlapEff_cf08[] = {
+            0.0180679, 0.161537, 0.364548, 0.609999, 0.915252, 1.29677,
+            1.78037, 2.34046, 2.94313, 3.41861, 4.06387, 5.04046,
+            5.96610, 7.03619, 7.99603, 8.99829, 10.0090};
+
+        inline constexpr double y_RatioFlapEff_cf08[] = {
+            1.19558, 1.16875, 1.14441, 1.11921, 1.10405, 1.08383,
+            1.06776, 1.05335, 1.04226, 1.03708, 1.02933, 1.02398,
+            1.01865, 1.01494, 1.01630, 1.01596, 1.01395};
+
+        // Ratio flap effectiveness alphaCL/alphaCl - cf/c = 0.9
+        inline constexpr double x_RatioFlapEff_cf09[] = {
+            0.0152399, 0.133488, 0.277303, 0.540058, 0.904940,
+            1.25298, 1.66888, 2.04243, 2.54324};
+
+        inline constexpr double y_RatioFlapEff_cf09[] = {
+            1.11355, 1.09426, 1.07747, 1.06148, 1.05131,
+            1.04534, 1.03683, 1.03168, 1.02231};
+
+    } // namespace FLAP_EFFECTIVENESS
+
+    /// Lateral stability charts (DATCOM)
+    namespace LATERAL
+    {
+        // Chart - Taper Ratio lambda = 1.0
+        // X axis: Sweep at half-chord Lambda_c/2 [deg]
+        // Y axis: (Cl_beta / CL)_Lambda_c/2 [per deg]
+        // Parameter: Aspect Ratio A = 1, 2, 4, 6, 8
+        // Source: Plot Digitizer 2.6.8
+
+        // A = 1
+        inline constexpr double x_lambda1_A1[] = {
+            -19.8331, -15.0708, -8.47677, -0.931558, 5.66082,
+            9.90917, 14.8179, 20.3132, 30.0581, 35.4805,
+            39.8774, 49.9913, 59.8875};
+
+        inline constexpr double y_lambda1_A1[] = {
+            0.000993957, 0.000731142, 0.000366107, 1.66e-05, -0.000259685,
+            -0.000434101, -0.000696807, -0.00101827, -0.00158812, -0.00192443,
+            -0.00221711, -0.00294945, -0.00378553};
+
+        // A = 2
+        inline constexpr double x_lambda1_A2[] = {
+            10.0582, 15.4811, 20.1716, 27.7214, 30.0667,
+            39.9653, 47.8859, 53.0975, 55.3005, 57.6510,
+            59.8556};
+
+        inline constexpr double y_lambda1_A2[] = {
+            -0.000581956, -0.000947857, -0.00128471, -0.00188578, -0.0020616,
+            -0.00303085, -0.00389799, -0.00472274, -0.00512062, -0.00557757,
+            -0.00606423};
+
+        // A = 4
+        inline constexpr double x_lambda1_A4[] = {
+            20.1032, 24.7945, 29.7809, 33.3003, 37.0403,
+            40.5613, 44.7440, 47.3864, 50.2500, 53.3348,
+            55.7603, 57.5265, 59.8829};
+
+        inline constexpr double y_lambda1_A4[] = {
+            -0.0015511, -0.00193234, -0.00244653, -0.00278424, -0.00318098,
+            -0.00360748, -0.00419624, -0.00460859, -0.00510956, -0.00569914,
+            -0.00625961, -0.00679098, -0.00757345};
+
+        // A = 6
+        inline constexpr double x_lambda1_A6[] = {
+            30.1522, 33.5995, 37.8545, 41.3766, 45.1209,
+            48.9403, 51.0717, 53.0575, 55.3380, 57.3262,
+            59.9791};
+
+        inline constexpr double y_lambda1_A6[] = {
+            -0.00274218, -0.00313914, -0.00368346, -0.00416914, -0.00480262,
+            -0.00553963, -0.00602633, -0.00655754, -0.00719211, -0.00785648,
+            -0.00884589};
+
+        // A = 8
+        inline constexpr double x_lambda1_A8[] = {
+            -19.9942, -16.4019, -12.1492, -6.06465, 0.31351,
+            7.86408, 15.4889, 20.3282, 25.6082, 30.1557,
+            35.5848, 39.9141, 42.5579, 45.8617, 48.8741,
+            50.9339, 53.2154, 55.2790, 56.9731, 58.3037,
+            59.7067};
+
+        inline constexpr double y_lambda1_A8[] = {
+            0.00180765, 0.00148478, 0.00107362, 0.00054545, -2.69e-05,
+            -0.000672358, -0.00137695, -0.00184686, -0.00240522, -0.00293453,
+            -0.00364075, -0.00424421, -0.00473054, -0.00529036, -0.00592438,
+            -0.00649993, -0.00719368, -0.00797637, -0.00856697, -0.00929102,
+            -0.00997062};
+
+        // Chart - Taper Ratio lambda = 0.5
+        // X axis: Sweep at half-chord Lambda_c/2 [deg]
+        // Y axis: (Cl_beta / CL)_Lambda_c/2 [per deg]
+        // Parameter: Aspect Ratio A = 1, 2, 4, 6, 8
+        // Source: Plot Digitizer 2.6.8
+
+        // A = 1
+        inline constexpr double x_lambda05_A1[] = {
+            -19.2529, -9.56041, 0.348910, 10.6227, 13.8293,
+            20.2425, 25.1251, 30.0811, 36.2044, 40.2133,
+            46.9931, 50.1276, 56.1075, 59.8999};
+
+        inline constexpr double y_lambda05_A1[] = {
+            0.00114099, 0.000525965, -1.34797e-08, -0.000555351, -0.000760378,
+            -0.00117043, -0.00147792, -0.00181498, -0.00229932, -0.00259264,
+            -0.00315056, -0.00340009, -0.00400305, -0.00440023};
+
+        // A = 2
+        inline constexpr double x_lambda05_A2[] = {
+            20.3171, 28.3367, 30.3050, 34.9712, 40.5863,
+            45.4004, 50.1435, 53.6479, 56.7896, 60.2980};
+
+        inline constexpr double y_lambda05_A2[] = {
+            -0.00127408, -0.00196441, -0.00212591, -0.00253726, -0.00309605,
+            -0.00364062, -0.00428894, -0.00486410, -0.00551361, -0.00631099};
+
+        // A = 4
+        inline constexpr double x_lambda05_A4[] = {
+            30.3831, 35.6348, 40.0852, 43.7330, 47.1633,
+            50.2301, 53.3713, 55.7094, 57.4652, 60.2459};
+
+        inline constexpr double y_lambda05_A4[] = {
+            -0.00242214, -0.00301083, -0.00357048, -0.00402703, -0.00452818,
+            -0.00505922, -0.00567910, -0.00616625, -0.00665382, -0.00746655};
+
+        // A = 6
+        inline constexpr double x_lambda05_A6[] = {
+            40.3809, 43.6645, 46.7318, 50.0181, 52.7207,
+            55.4995, 57.4763, 59.8194};
+
+        inline constexpr double y_lambda05_A6[] = {
+            -0.00382211, -0.00426411, -0.00482478, -0.00541493, -0.00593143,
+            -0.00664046, -0.00727602, -0.00804463};
+
+        // A = 8
+        inline constexpr double x_lambda05_A8[] = {
+            -19.4811, -13.1381, 0.0572107, 10.3368, 20.3986,
+            24.4811, 27.9812, 30.5335, 34.2546, 36.8087,
+            40.0196, 44.0353, 47.3936, 48.9286, 50.8283,
+            52.9483, 54.7772, 56.7529, 58.0727, 59.5370,
+            60.1249};
+
+        inline constexpr double y_lambda05_A8[] = {
+            0.00168896, 0.00113071, 2.93993e-05, -0.000851851, -0.00176289,
+            -0.00210060, -0.00243874, -0.00268869, -0.00317481, -0.00352847,
+            -0.00397052, -0.00464901, -0.00519465, -0.00554906, -0.00594764,
+            -0.00644976, -0.00695210, -0.00752840, -0.00806074, -0.00853372,
+            -0.00884438};
+
+        // Chart - Taper Ratio lambda = 0.0
+        // X axis: Sweep at half-chord Lambda_c/2 [deg]
+        // Y axis: (Cl_beta / CL)_Lambda_c/2 [per deg]
+        // Parameter: Aspect Ratio A = 1, 1.5, 2, 3, 6
+        // Source: Plot Digitizer 2.6.8
+
+        // A = 1
+        inline constexpr double x_lambda0_A1[] = {
+            -19.3443, -13.5883, -6.08379, 0.546448, 10.7468,
+            20.3643, 26.3388, 30.4918, 36.3206, 40.4007,
+            47.1767, 50.1639, 53.2240, 56.6485, 60.1457};
+
+        inline constexpr double y_lambda0_A1[] = {
+            0.00126108, 0.000862069, 0.000374384, 4.92611e-06, -0.000660099,
+            -0.00128079, -0.00167980, -0.00193103, -0.00240394, -0.00269951,
+            -0.00323153, -0.00351232, -0.00374877, -0.00405911, -0.00436946};
+
+        // A = 1.5
+        inline constexpr double x_lambda0_A1_5[] = {
+            45.5738, 50.2368, 53.5155, 56.7213, 58.8342, 60.1457};
+
+        inline constexpr double y_lambda0_A1_5[] = {
+            -0.00329064, -0.00382266, -0.00426601, -0.00475369, -0.00509360, -0.00534483};
+
+        // A = 2
+        inline constexpr double x_lambda0_A2[] = {
+            30.4918, 35.6648, 40.4007, 44.8452, 48.4153,
+            50.8197, 53.3698, 55.9199, 57.8871, 60.0729};
+
+        inline constexpr double y_lambda0_A2[] = {
+            -0.00219704, -0.00262562, -0.00303941, -0.00346798, -0.00383744,
+            -0.00419212, -0.00457635, -0.00504926, -0.00546305, -0.00593596};
+
+        // A = 3
+        inline constexpr double x_lambda0_A3[] = {
+            40.6193, 43.6794, 46.9581, 49.5082, 51.6211,
+            54.0255, 56.1384, 57.8871, 60.0729};
+
+        inline constexpr double y_lambda0_A3[] = {
+            -0.00326108, -0.00367488, -0.00413300, -0.00447291, -0.00485714,
+            -0.00531527, -0.00577340, -0.00621675, -0.00674877};
+
+        // A = 6
+        inline constexpr double x_lambda0_A6[] = {
+            -19.3443, -12.3497, 0.546448, 7.46812, 10.4554,
+            20.2914, 25.0273, 28.3789, 31.3661, 36.1749,
+            40.1093, 44.1894, 47.3953, 49.9454, 52.2040,
+            53.8798, 55.3370, 57.0856, 58.6157, 60.0000};
+
+        inline constexpr double y_lambda0_A6[] = {
+            0.00158621, 0.000980296, -5.41872e-05, -0.000571429, -0.000793103,
+            -0.00156158, -0.00194581, -0.00225616, -0.00253695, -0.00300985,
+            -0.00343842, -0.00394089, -0.00442857, -0.00482759, -0.00521182,
+            -0.00555172, -0.00595074, -0.00637931, -0.00683744, -0.00731034};
+
+        // K factor vs Mach number
+        // X axis: Mach number [-]
+        // Y axis: K factor [-]
+        // Parameter: AspectRatio/ cos(sweepC2) = 2, 3, 4, 5, 6, 8, 10
+        // Source: Plot Digitizer 2.6.8
+
+        // lambda ratio = 2
+        inline constexpr double x_K_Mach_lambda2[] = {
+            0.803256, 0.848372, 0.877194, 0.903097, 0.924824, 0.951568};
+
+        inline constexpr double y_K_Mach_lambda2[] = {
+            1.00075, 0.999623, 0.999694, 0.997684, 0.995248, 0.991166};
+
+        // lambda ratio = 3
+        inline constexpr double x_K_Mach_lambda3[] = {
+            0.803584, 0.836153, 0.868732, 0.900486, 0.928057, 0.951457};
+
+        inline constexpr double y_K_Mach_lambda3[] = {
+            1.03644, 1.04150, 1.04241, 1.03917, 1.03841, 1.03515};
+
+        // lambda ratio = 4
+        inline constexpr double x_K_Mach_lambda4[] = {
+            0.400951, 0.454399, 0.505336, 0.561278, 0.633925, 0.704069,
+            0.801762, 0.866066, 0.903654, 0.947931};
+
+        inline constexpr double y_K_Mach_lambda4[] = {
+            1.02050, 1.02810, 1.03736, 1.04995, 1.06340, 1.07603,
+            1.09619, 1.10548, 1.10806, 1.10817};
+
+        // lambda ratio = 5
+        inline constexpr double x_K_Mach_lambda5[] = {
+            0.799918, 0.829120, 0.869178, 0.902578, 0.930967, 0.950182};
+
+        inline constexpr double y_K_Mach_lambda5[] = {
+            1.16506, 1.18008, 1.19677, 1.20349, 1.20937, 1.20942};
+
+        // lambda ratio = 6
+        inline constexpr double x_K_Mach_lambda6[] = {
+            0.399219, 0.437630, 0.478529, 0.521927, 0.567821, 0.613701,
+            0.669595, 0.711303, 0.758840, 0.799698, 0.846393, 0.892247,
+            0.925601, 0.953113};
+
+        inline constexpr double y_K_Mach_lambda6[] = {
+            1.04456, 1.05213, 1.06634, 1.08387, 1.10556, 1.13224,
+            1.16391, 1.18891, 1.22139, 1.25220, 1.28717, 1.32463,
+            1.34961, 1.37209};
+
+        // lambda ratio = 8
+        inline constexpr double x_K_Mach_lambda8[] = {
+            0.400821, 0.440871, 0.495939, 0.543492, 0.588532, 0.626063,
+            0.666063, 0.703565, 0.737309, 0.773524, 0.799729, 0.827198,
+            0.859628, 0.885802, 0.914489, 0.930660, 0.946838};
+
+        inline constexpr double y_K_Mach_lambda8[] = {
+            1.07195, 1.09197, 1.11949, 1.14575, 1.17450, 1.19949,
+            1.23942, 1.27561, 1.31180, 1.36168, 1.40532, 1.44522,
+            1.50505, 1.56113, 1.61473, 1.66208, 1.70693};
+
+        // lambda ratio = 10
+        inline constexpr double x_K_Mach_lambda10[] = {
+            0.0977469, 0.164119, 0.221721, 0.294352, 0.350690, 0.398256,
+            0.457487, 0.500862, 0.555069, 0.598409, 0.645060, 0.673370,
+            0.704988, 0.735767, 0.764883, 0.791465, 0.813892, 0.836308,
+            0.855373, 0.873606, 0.889328, 0.905890, 0.918262, 0.928974,
+            0.935555, 0.941287};
+
+        inline constexpr double y_K_Mach_lambda10[] = {
+            0.998999, 1.01659, 1.03292, 1.05302, 1.07432, 1.09518,
+            1.12853, 1.15519, 1.19267, 1.23344, 1.28584, 1.32326,
+            1.37396, 1.42632, 1.47535, 1.53517, 1.58668, 1.64234,
+            1.70131, 1.75945, 1.81924, 1.87737, 1.94047, 1.99942,
+            2.04010, 2.08576};
+
+        // Kf factor
+        // X axis: ratio [-]
+        // Y axis: Kf [-]
+        // Parameter: AspectRatio/cos(sweepC2) = 4, 4.5, 5, 5.5, 6, 7, 8
+        // Source: Plot Digitizer 2.6.8
+
+        // ratio = 4
+        inline constexpr double x_Kf_ratio4[] = {
+            1.29769, 1.36656, 1.42117, 1.48290, 1.54345, 1.60280};
+
+        inline constexpr double y_Kf_ratio4[] = {
+            0.996912, 0.992673, 0.987273, 0.981272, 0.975272, 0.968683};
+
+        // ratio = 4.5
+        inline constexpr double x_Kf_ratio4_5[] = {
+            1.03637, 1.08978, 1.15745, 1.20612, 1.27020, 1.33785,
+            1.40786, 1.48261, 1.53837, 1.60124};
+
+        inline constexpr double y_Kf_ratio4_5[] = {
+            0.996116, 0.990127, 0.982934, 0.977543, 0.967401, 0.958436,
+            0.946512, 0.931625, 0.921495, 0.907218};
+
+        // ratio = 5
+        inline constexpr double x_Kf_ratio5[] = {
+            0.807117, 0.875968, 0.940053, 1.00295, 1.08245, 1.14651,
+            1.22600, 1.28294, 1.34699, 1.40392, 1.46557, 1.51776,
+            1.55807, 1.60194};
+
+        inline constexpr double y_Kf_ratio5[] = {
+            0.995864, 0.988670, 0.979118, 0.969569, 0.955858, 0.942169,
+            0.924912, 0.912416, 0.898137, 0.883277, 0.864273, 0.850602,
+            0.838722, 0.825655};
+
+        // ratio = 5.5
+        inline constexpr double x_Kf_ratio5_5[] = {
+            0.554123, 0.594484, 0.644326, 0.701303, 0.757080, 0.805731,
+            0.857935, 0.916064, 0.970629, 1.01453, 1.05840, 1.11414,
+            1.16513, 1.20664, 1.26356, 1.32048, 1.37620, 1.43666,
+            1.50069, 1.56115, 1.59789};
+
+        inline constexpr double y_Kf_ratio5_5[] = {
+            0.998011, 0.993814, 0.986057, 0.979471, 0.971114, 0.962768,
+            0.952643, 0.940146, 0.927654, 0.918723, 0.906247, 0.891980,
+            0.877129, 0.865838, 0.850978, 0.833754, 0.815941, 0.796938,
+            0.777340, 0.757747, 0.744099};
+
+        // ratio = 6
+        inline constexpr double x_Kf_ratio6[] = {
+            0.387829, 0.412752, 0.455488, 0.504150, 0.558747, 0.607409,
+            0.651308, 0.709448, 0.773519, 0.823333, 0.902818, 0.953824,
+            1.00719, 1.05343, 1.10560, 1.15659, 1.21469, 1.28109,
+            1.34985, 1.42453, 1.47432, 1.53834, 1.59405};
+
+        inline constexpr double y_Kf_ratio6[] = {
+            0.998256, 0.994673, 0.990473, 0.983900, 0.976727, 0.970153,
+            0.961814, 0.951090, 0.939174, 0.926689, 0.910023, 0.898127,
+            0.883272, 0.869610, 0.854167, 0.838724, 0.821499, 0.802488,
+            0.779336, 0.753811, 0.737780, 0.716999, 0.696822};
+
+        // ratio = 7
+        inline constexpr double x_Kf_ratio7[] = {
+            0.232229, 0.269019, 0.311756, 0.355677, 0.406714, 0.451812,
+            0.517068, 0.563347, 0.614363, 0.678427, 0.734184, 0.788739,
+            0.848038, 0.921566, 1.00220, 1.05199, 1.12788, 1.19426,
+            1.25115, 1.32822, 1.40288, 1.47756, 1.54039, 1.59609};
+
+        inline constexpr double y_Kf_ratio7[] = {
+            0.999077, 0.993704, 0.989503, 0.984710, 0.978133, 0.971565,
+            0.959057, 0.951306, 0.941183, 0.928085, 0.916182, 0.901917,
+            0.886463, 0.866850, 0.843090, 0.827649, 0.804487, 0.781930,
+            0.761751, 0.737405, 0.709516, 0.683991, 0.662030, 0.641262};
+
+        // ratio = 8
+        inline constexpr double x_Kf_ratio8[] = {
+            0.00891963, 0.0492983, 0.108668, 0.163283, 0.211951, 0.289106,
+            0.362698, 0.419649, 0.482537, 0.543045, 0.607105, 0.659306,
+            0.726912, 0.773152, 0.834820, 0.890549, 0.947468, 1.00556,
+            1.04824, 1.10987, 1.16913, 1.25923, 1.32086, 1.37775,
+            1.44412, 1.50457, 1.56145, 1.59818};
+
+        inline constexpr double y_Kf_ratio8[] = {
+            0.999407, 0.998165, 0.994532, 0.990314, 0.984923, 0.975943,
+            0.966969, 0.956246, 0.944924, 0.933014, 0.919325, 0.908610,
+            0.891961, 0.877708, 0.861068, 0.844437, 0.828395, 0.809396,
+            0.796330, 0.773780, 0.751233, 0.721549, 0.698999, 0.677046,
+            0.652716, 0.630759, 0.609398, 0.593385};
+
+        // (Cl_beta / CL) ratio vs Aspect Ratio
+        // X axis: Aspect Ratio A [-]
+        // Y axis: (Cl_beta / CL) [per deg]
+        // Parameter: Taper Ratio lambda = 0, 0.5, 1.0
+        // Source: Plot Digitizer 2.6.8
+
+        // lambda = 0
+        inline constexpr double x_ClbetaCL_lambda0[] = {
+            0.991005, 1.18139, 1.32407, 1.52342, 1.71463,
+            2.01885, 2.30712, 2.65202, 3.04511, 3.44673,
+            3.84859, 4.26670, 4.70900, 5.22364, 5.74637,
+            6.30934, 6.84031, 7.34709, 7.99874};
+
+        inline constexpr double y_ClbetaCL_lambda0[] = {
+            -0.00558507, -0.00468163, -0.00396848, -0.00336532, -0.00273065,
+            -0.00220530, -0.00172758, -0.00134404, -0.000928316, -0.000670590,
+            -0.000491912, -0.000360473, -0.000244556, -9.61621e-05, 3.65181e-05,
+            0.000169675, 0.000239212, 0.000324273, 0.000411051};
+
+        // lambda = 0.5
+        inline constexpr double x_ClbetaCL_lambda05[] = {
+            0.974050, 1.13278, 1.27497, 1.50583, 1.74460,
+            2.05604, 2.29569, 2.62415, 2.96061, 3.45023,
+            3.96413, 4.58295, 5.25816, 5.98975, 6.68939,
+            7.36499, 7.97639};
+
+        inline constexpr double y_ClbetaCL_lambda05[] = {
+            -0.00792518, -0.00719603, -0.00632478, -0.00549991, -0.00462752,
+            -0.00383331, -0.00324549, -0.00275148, -0.00224157, -0.00180888,
+            -0.00142335, -0.00113142, -0.000854643, -0.000593005, -0.000410796,
+            -0.000260493, -0.000174192};
+
+        // lambda = 1.0
+        inline constexpr double x_ClbetaCL_lambda1[] = {
+            1.00054, 1.19756, 1.37902, 1.51312, 1.71945,
+            1.92618, 2.18133, 2.46092, 2.71676, 3.00488,
+            3.42987, 3.87110, 4.24039, 4.73044, 5.14826,
+            5.63041, 6.23338, 6.80425, 7.18216, 7.51999,
+            7.95448};
+
+        inline constexpr double y_ClbetaCL_lambda1[] = {
+            -0.0113083, -0.00994624, -0.00875832, -0.00787136, -0.00692030,
+            -0.00609572, -0.00531799, -0.00463484, -0.00407844, -0.00355329,
+            -0.00304232, -0.00257859, -0.00227382, -0.00198343, -0.00175713,
+            -0.00151426, -0.00130158, -0.00112089, -0.00100574, -0.000938495,
+            -0.000901723};
+
+        // (Cl_beta / Gamma) ratio vs Aspect Ratio
+        // X axis: Aspect Ratio A [-]
+        // Y axis: (Cl_beta / Gamma) [per deg^2]
+        // Parameter: Taper Ratio lambda = 1.0, Sweep c/2 = 0, 40, 60 [deg]
+        // Source: Plot Digitizer 2.6.8
+
+        // lambda = 1.0, sweepC2 = 0 deg
+        inline constexpr double x_ClbetaGamma_lambda1_sweep0[] = {
+            0.00794907, 0.278637, 0.597095, 0.979273, 1.37737,
+            1.71178, 2.02232, 2.50011, 2.96199, 3.37610,
+            3.90972, 4.40351, 4.86549, 5.35135, 5.81335,
+            6.33907, 6.80906, 7.31091, 7.74106, 7.98003};
+
+        inline constexpr double y_ClbetaGamma_lambda1_sweep0[] = {
+            -1.20e-06, -1.56e-05, -3.24e-05, -5.08e-05, -7.04e-05,
+            -8.60e-05, -9.99e-05, -0.000118342, -0.000135538, -0.000149935,
+            -0.000165536, -0.000179936, -0.000191140, -0.000203543, -0.000213148,
+            -0.000223955, -0.000232363, -0.000241171, -0.000249178, -0.000253581};
+
+        // lambda = 1.0, sweepC2 = 40 deg
+        inline constexpr double x_ClbetaGamma_lambda1_sweep40[] = {
+            2.98598, 3.24880, 3.50366, 3.88599, 4.24440,
+            4.73028, 5.16042, 5.67820, 6.18006, 6.65804,
+            7.07229, 7.47857, 7.98842};
+
+        inline constexpr double y_ClbetaGamma_lambda1_sweep40[] = {
+            -0.000130346, -0.000137946, -0.000145546, -0.000154749, -0.000164351,
+            -0.000175156, -0.000183961, -0.000193170, -0.000201978, -0.000208389,
+            -0.000214397, -0.000220405, -0.000227217};
+
+        // lambda = 1.0, sweepC2 = 60 deg
+        inline constexpr double x_ClbetaGamma_lambda1_sweep60[] = {
+            0.0318471, 0.238834, 0.509534, 0.875763, 1.09872,
+            1.48892, 1.99064, 2.40478, 2.86675, 3.33670,
+            3.83058, 4.36432, 4.80247, 5.24062, 5.71065,
+            6.10899, 6.57109, 7.00132, 7.40765, 7.71837,
+            7.96536};
+
+        inline constexpr double y_ClbetaGamma_lambda1_sweep60[] = {
+            -1.59914e-06, -1.31920e-05, -2.67847e-05, -4.59738e-05, -5.51704e-05,
+            -7.07653e-05, -8.75629e-05, -0.000100362, -0.000111965, -0.000122370,
+            -0.000131178, -0.000139189, -0.000145199, -0.000151208, -0.000156819,
+            -0.000161229, -0.000164444, -0.000167657, -0.000170469, -0.000172878,
+            -0.000174087};
+
+        // (Cl_beta / Gamma) ratio vs Aspect Ratio
+        // X axis: Aspect Ratio A [-]
+        // Y axis: (Cl_beta / Gamma) [per deg^2]
+        // Parameter: Taper Ratio lambda = 0.5, Sweep c/2 = 0, 40, 60 [deg]
+        // Source: Plot Digitizer 2.6.8
+
+        // lambda = 0.5, sweepC2 = 0 deg
+        inline constexpr double x_ClbetaGamma_lambda05_sweep0[] = {
+            0.0396564, 0.285582, 0.571265, 0.920489, 1.20625,
+            1.61115, 1.98424, 2.24629, 2.54021, 2.90559,
+            3.31876, 3.77975, 4.21691, 4.63029, 4.99604,
+            5.49695, 5.99788, 6.49094, 6.98406, 7.47718,
+            7.97821};
+
+        inline constexpr double y_ClbetaGamma_lambda05_sweep0[] = {
+            -2.38093e-06, -1.62720e-05, -3.09609e-05, -4.80346e-05, -6.15362e-05,
+            -7.94102e-05, -9.68834e-05, -0.000107611, -0.000117948, -0.000131462,
+            -0.000144588, -0.000156930, -0.000168476, -0.000178436, -0.000186014,
+            -0.000196779, -0.000207149, -0.000215934, -0.000223927, -0.000231921,
+            -0.000240707};
+
+        // lambda = 0.5, sweepC2 = 40 deg
+        inline constexpr double x_ClbetaGamma_lambda05_sweep40[] = {
+            2.00838, 2.30230, 2.65987, 2.97770, 3.35124,
+            3.74874, 4.14622, 4.60742, 4.99701, 5.54578,
+            6.01499, 6.54001, 6.99342, 7.49450, 7.99570};
+
+        inline constexpr double y_ClbetaGamma_lambda05_sweep40[] = {
+            -9.29295e-05, -0.000103266, -0.000114404, -0.000124349, -0.000134699,
+            -0.000143864, -0.000153426, -0.000162602, -0.000170975, -0.000180164,
+            -0.000188550, -0.000195757, -0.000202161, -0.000210156, -0.000216172};
+
+        // lambda = 0.5, sweepC2 = 60 deg
+        inline constexpr double x_ClbetaGamma_lambda05_sweep60[] = {
+            0.0476434, 0.333301, 0.634933, 0.944501, 1.25420,
+            1.65139, 1.97714, 2.44604, 2.96272, 3.40794,
+            3.92489, 4.36235, 4.78397, 5.30110, 5.91377,
+            6.39119, 6.90853, 7.37806, 7.70437, 7.98298};
+
+        inline constexpr double y_ClbetaGamma_lambda05_sweep60[] = {
+            -1.98642e-06, -1.70711e-05, -3.13668e-05, -4.60595e-05, -5.87734e-05,
+            -7.26884e-05, -8.34259e-05, -9.65607e-05, -0.000109703, -0.000119668,
+            -0.000128457, -0.000135254, -0.000140862, -0.000146880, -0.000152914,
+            -0.000157343, -0.000160196, -0.000163436, -0.000165467, -0.000166302};
+
+        // (Cl_beta / Gamma) ratio vs Aspect Ratio
+        // X axis: Aspect Ratio A [-]
+        // Y axis: (Cl_beta / Gamma) [per deg^2]
+        // Parameter: Taper Ratio lambda = 0.0, Sweep c/2 = 0, 40, 60 [deg]
+        // Source: Plot Digitizer 2.6.8
+
+        // lambda = 0.0, sweepC2 = 0 deg
+        inline constexpr double x_ClbetaGamma_lambda0_sweep0[] = {
+            0.0316943, 0.189823, 0.467072, 0.728550, 1.02187,
+            1.41055, 1.85499, 2.28366, 2.78395, 3.36381,
+            3.89633, 4.30950, 4.69901, 5.02498, 5.42245,
+            5.84392, 6.27331, 6.61528, 7.00498, 7.40260,
+            7.74461, 7.96734};
+
+        inline constexpr double y_ClbetaGamma_lambda0_sweep0[] = {
+            -1.57815e-06, -1.30029e-05, -2.75971e-05, -4.06168e-05, -5.36441e-05,
+            -6.86572e-05, -8.32908e-05, -9.63499e-05, -0.000109819, -0.000123699,
+            -0.000133248, -0.000141984, -0.000148359, -0.000153148, -0.000159524,
+            -0.000164728, -0.000170327, -0.000174334, -0.000178745, -0.000183551,
+            -0.000187166, -0.000189182};
+
+        // lambda = 0.0, sweepC2 = 40 deg
+        inline constexpr double x_ClbetaGamma_lambda0_sweep40[] = {
+            2.97510, 3.43604, 3.91290, 4.48534, 4.98623,
+            5.55874, 5.99618, 6.45757, 6.99843, 7.49959,
+            7.98487};
+
+        inline constexpr double y_ClbetaGamma_lambda0_sweep40[] = {
+            -0.000109078, -0.000117826, -0.000126577, -0.000134958, -0.000142144,
+            -0.000149740, -0.000154555, -0.000158590, -0.000164215, -0.000168652,
+            -0.000172693};
+
+        // lambda = 0.0, sweepC2 = 60 deg
+        inline constexpr double x_ClbetaGamma_lambda0_sweep60[] = {
+            0.0236946, 0.309095, 0.491375, 0.673808, 0.951475,
+            1.21329, 1.62608, 2.12633, 2.64285, 3.15944,
+            3.66826, 4.20908, 4.93293, 5.56141, 6.27746,
+            7.00954, 7.51090, 7.96456};
+
+        inline constexpr double y_ClbetaGamma_lambda0_sweep60[] = {
+            -1.96894e-06, -1.46017e-05, -2.32834e-05, -3.03945e-05, -4.06694e-05,
+            -5.01552e-05, -6.28179e-05, -7.66793e-05, -8.70104e-05, -9.65563e-05,
+            -0.000104137, -0.000110154, -0.000117000, -0.000122253, -0.000127527,
+            -0.000131626, -0.000134100, -0.000135778};
+
+        // Kmd factor vs Mach number
+        // X axis: Mach * cos(sweepC2) [-]
+        // Y axis: Kmd factor [-]
+        // Parameter: A / tan(sweepC2) ratio = 2, 4, 6, 8, 10
+        // Source: Plot Digitizer 2.6.8
+
+        // A / tan(sweepC2) = 2
+        inline constexpr double x_Kmd_ratio2[] = {
+            0.402359, 0.442914, 0.485606, 0.540037, 0.600873,
+            0.697733, 0.799398, 0.898664, 0.951501};
+
+        inline constexpr double y_Kmd_ratio2[] = {
+            1.01018, 1.01014, 1.01248, 1.01481, 1.01793,
+            1.02578, 1.03602, 1.04785, 1.05655};
+
+        // A / tan(sweepC2) = 4
+        inline constexpr double x_Kmd_ratio4[] = {
+            0.399975, 0.440802, 0.496842, 0.552882, 0.599318,
+            0.671373, 0.700197, 0.745836, 0.799484, 0.857138,
+            0.901183, 0.950837};
+
+        inline constexpr double y_Kmd_ratio4[] = {
+            1.02610, 1.03163, 1.04032, 1.04981, 1.06090,
+            1.07595, 1.08387, 1.09735, 1.11560, 1.13702,
+            1.15766, 1.18308};
+
+        // A / tan(sweepC2) = 6
+        inline constexpr double x_Kmd_ratio6[] = {
+            0.600959, 0.639397, 0.675431, 0.706662, 0.752312,
+            0.790755, 0.833213, 0.876472, 0.906117, 0.927754,
+            0.947789};
+
+        inline constexpr double y_Kmd_ratio6[] = {
+            1.09830, 1.11418, 1.12766, 1.14116, 1.16498,
+            1.18643, 1.21901, 1.25318, 1.28020, 1.30405,
+            1.32631};
+
+        // A / tan(sweepC2) = 8
+        inline constexpr double x_Kmd_ratio8[] = {
+            0.798837, 0.818871, 0.838909, 0.857343, 0.876583,
+            0.895020, 0.913465, 0.930307, 0.943944, 0.947959};
+
+        inline constexpr double y_Kmd_ratio8[] = {
+            1.25883, 1.28030, 1.30574, 1.32880, 1.35663,
+            1.38128, 1.41388, 1.44490, 1.47274, 1.48467};
+
+        // A / tan(sweepC2) = 10
+        inline constexpr double x_Kmd_ratio10[] = {
+            0.00934030, 0.0445573, 0.0973889, 0.155026, 0.199854,
+            0.246287, 0.296725, 0.349565, 0.397604, 0.441643,
+            0.482483, 0.501702, 0.542543, 0.572976, 0.602611,
+            0.633046, 0.666692, 0.698736, 0.731584, 0.760435,
+            0.790090, 0.819746, 0.842999, 0.863849, 0.892725,
+            0.919207, 0.941681, 0.952121};
+
+        inline constexpr double y_Kmd_ratio10[] = {
+            1.00185, 1.00022, 1.00334, 1.00885, 1.01358,
+            1.02069, 1.03098, 1.04207, 1.05475, 1.06903,
+            1.08569, 1.09443, 1.11189, 1.12777, 1.14525,
+            1.16352, 1.18895, 1.21438, 1.24299, 1.27638,
+            1.31216, 1.35032, 1.38770, 1.42428, 1.48075,
+            1.54358, 1.60165, 1.63347};
+
+        // Twist correction factor vs Aspect Ratio
+        // X axis: Aspect Ratio A [-]
+        // Y axis: Twist correction factor [per deg^2]
+        // Parameter: Taper Ratio lambda = 0, 0.4, 1.0
+        // Source: Plot Digitizer 2.6.8
+
+        // lambda = 0
+        inline constexpr double x_TwistCorr_lambda0[] = {
+            3.00369, 3.38835, 3.84773, 4.27503, 4.74502,
+            5.00135, 5.34307, 5.71678, 6.04778, 6.57102,
+            7.15839, 7.86329, 8.45079, 8.94215, 9.41219,
+            9.78609, 10.0853, 10.4592, 10.7691, 11.0898,
+            11.3036, 11.4748};
+
+        inline constexpr double y_TwistCorr_lambda0[] = {
+            -1.90e-05, -2.05e-05, -2.17e-05, -2.26e-05, -2.34e-05,
+            -2.36e-05, -2.36e-05, -2.33e-05, -2.30e-05, -2.28e-05,
+            -2.30e-05, -2.36e-05, -2.47e-05, -2.56e-05, -2.67e-05,
+            -2.76e-05, -2.86e-05, -2.99e-05, -3.13e-05, -3.31e-05,
+            -3.49e-05, -3.72e-05};
+
+        // lambda = 0.4
+        inline constexpr double x_TwistCorr_lambda04[] = {
+            2.99348, 3.22871, 3.48528, 3.76320, 4.00903,
+            4.35097, 4.63945, 4.98131, 5.30175, 5.62219,
+            5.99601, 6.39117, 6.81833, 7.26684, 7.72607,
+            8.01441, 8.34549, 8.66589, 8.97562, 9.39220,
+            9.76607, 10.0438, 10.2682, 10.5781, 10.7491,
+            10.8774, 10.9843};
+
+        inline constexpr double y_TwistCorr_lambda04[] = {
+            -2.21e-05, -2.40e-05, -2.58e-05, -2.76e-05, -2.89e-05,
+            -3.03e-05, -3.13e-05, -3.22e-05, -3.27e-05, -3.32e-05,
+            -3.35e-05, -3.38e-05, -3.38e-05, -3.38e-05, -3.40e-05,
+            -3.41e-05, -3.44e-05, -3.46e-05, -3.49e-05, -3.55e-05,
+            -3.63e-05, -3.70e-05, -3.76e-05, -3.88e-05, -3.99e-05,
+            -4.08e-05, -4.15e-05};
+
+        // lambda = 1.0
+        inline constexpr double x_TwistCorr_lambda1[] = {
+            2.98299, 3.16474, 3.37858, 3.56031, 3.77409,
+            3.99850, 4.29773, 4.59691, 4.88537, 5.16311,
+            5.49422, 5.87874, 6.10304, 6.32736, 6.51965,
+            6.69057, 7.03232, 7.36337, 7.91868, 8.43131,
+            8.73034, 8.97599, 9.22167, 9.58486, 9.83059,
+            10.0550, 10.2794, 10.4505};
+
+        inline constexpr double y_TwistCorr_lambda1[] = {
+            -2.33e-05, -2.46e-05, -2.63e-05, -2.76e-05, -2.89e-05,
+            -2.99e-05, -3.14e-05, -3.24e-05, -3.33e-05, -3.39e-05,
+            -3.43e-05, -3.48e-05, -3.51e-05, -3.55e-05, -3.60e-05,
+            -3.63e-05, -3.65e-05, -3.66e-05, -3.66e-05, -3.69e-05,
+            -3.71e-05, -3.73e-05, -3.77e-05, -3.84e-05, -3.92e-05,
+            -4.02e-05, -4.12e-05, -4.23e-05};
+
+    } // namespace LATERAL
+
+    /// Propeller installation charts (blockage, blade camber, compressibility)
+    namespace PROPELLER
+    {
+        // --- 116: Blockage factor - Scoop inlet vs J ---
+        inline constexpr double scoop_J[] = {
+            0.0101796, 0.111802, 0.241481, 0.417075, 0.597827,
+            0.768534, 0.954598, 1.04912, 1.13607, 1.21805,
+            1.33328, 1.43823, 1.56105, 1.67106, 1.78614,
+            1.90892, 2.01626, 2.14656, 2.28959, 2.37900,
+            2.49125, 2.59578, 2.71045, 2.82508, 2.99569};
+
+        inline constexpr double scoop_BF[] = {
+            1.00005, 1.00009, 1.00042, 1.00127, 1.00232,
+            1.00368, 1.00535, 1.00677, 1.00830, 1.01013,
+            1.01258, 1.01472, 1.01706, 1.01915, 1.02119,
+            1.02343, 1.02516, 1.02714, 1.02922, 1.03055,
+            1.03181, 1.03282, 1.03378, 1.03464, 1.03574};
+
+        // --- 117: Blockage factor - Annular inlet vs J ---
+        inline constexpr double annular_J[] = {
+            0.0126810, 0.109242, 0.203283, 0.292244, 0.386401,
+            0.528858, 0.666293, 0.834402, 1.00005, 1.26249,
+            1.39502, 1.56082, 1.72158, 1.92325, 2.06109,
+            2.23720, 2.38841, 2.49562, 2.59504, 2.69627,
+            2.82419, 2.99603};
+
+        inline constexpr double annular_BF[] = {
+            0.999947, 1.00003, 1.00017, 1.00031, 1.00076,
+            1.00130, 1.00200, 1.00321, 1.00462, 1.00674,
+            1.00790, 1.00972, 1.01165, 1.01429, 1.01606,
+            1.01827, 1.02013, 1.02150, 1.02245, 1.02313,
+            1.02384, 1.02485};
+
+        // --- 118: Delta Mach - Effect of blade camber ---
+        inline constexpr double integratedLiftCoeffcientValues[] = {
+            0.201428, 0.232620, 0.269341, 0.319669, 0.371002,
+            0.412282, 0.463630, 0.501402, 0.537167, 0.570410,
+            0.601147, 0.635925, 0.666671, 0.700439};
+
+        inline constexpr double deltaMachValues[] = {
+            -0.0158481, -0.0100277, -0.00298277, 0.00549675, 0.0141804,
+            0.0206193, 0.0285914, 0.0337059, 0.0382088, 0.0425062,
+            0.0458867, 0.0492705, 0.0522444, 0.0556274};
+
+        // --- 120: Compressibility factor - M_eff = 0.3 --- (11 punti)
+        inline constexpr double mach03_x[] = {
+            0.496008, 0.518514, 0.549096, 0.588666, 0.644956,
+            0.716279, 0.764321, 0.795918, 0.825501, 0.885217,
+            0.955506};
+        inline constexpr double compressibilityFactorAtMach03[] = {
+            0.850324, 0.865093, 0.886593, 0.903328, 0.926368,
+            0.949853, 0.968331, 0.977033, 0.983999, 0.990988,
+            1.00037};
+
+        // --- 121: Compressibility factor - M_eff = 0.4 --- (12 punti)
+        inline constexpr double mach04_x[] = {
+            0.795241, 0.841268, 0.900279, 0.952763, 1.00962,
+            1.07893, 1.13145, 1.16728, 1.22240, 1.29908,
+            1.36079, 1.41185};
+        inline constexpr double compressibilityFactorAtMach04[] = {
+            0.849914, 0.866654, 0.882537, 0.899283, 0.915165,
+            0.936913, 0.953225, 0.962798, 0.973472, 0.983729,
+            0.992673, 1.00031};
+
+        // --- 122: Compressibility factor - M_eff = 0.5 --- (12 punti)
+        inline constexpr double mach05_x[] = {
+            1.24941, 1.30403, 1.38396, 1.44282, 1.50379,
+            1.57121, 1.61546, 1.65784, 1.74305, 1.81332,
+            1.86867, 1.90691};
+        inline constexpr double compressibilityFactorAtMach05[] = {
+            0.850063, 0.867027, 0.890520, 0.908355, 0.926626,
+            0.945119, 0.957086, 0.965580, 0.976712, 0.986313,
+            0.994167, 1.00049};
+
+        // --- 123: Compressibility factor - M_eff = 0.6 --- (10 punti)
+        inline constexpr double mach06_x[] = {
+            1.79391, 1.87824, 1.97955, 2.09547, 2.16077,
+            2.20714, 2.27511, 2.33890, 2.40483, 2.45582};
+        inline constexpr double compressibilityFactorAtMach06[] = {
+            0.851152, 0.873564, 0.898809, 0.929923, 0.947980,
+            0.960382, 0.971934, 0.981747, 0.991779, 1.00028};
+
+        // --- 124: Compressibility factor - M_eff = 0.7 --- (13 punti)
+        inline constexpr double mach07_x[] = {
+            2.57964, 2.66902, 2.79660, 2.95600, 3.06446,
+            3.17716, 3.28786, 3.34536, 3.44580, 3.52481,
+            3.61459, 3.72187, 3.81623};
+        inline constexpr double compressibilityFactorAtMach07[] = {
+            0.850484, 0.863355, 0.883198, 0.908923, 0.925497,
+            0.942942, 0.958433, 0.966289, 0.975480, 0.983353,
+            0.991235, 0.995660, 1.00007};
+
+    } // namespace PROPELLER
+
+    /// Directional stability charts (Perkins & Hage / Roskam Part VI / NACA Report 823)
+    namespace DIRECTIONAL
+    {
+        /**
+         * Kbeta empirical factor data from Perkins charts
+         * Used for fuselage and nacelle directional stability calculations
+         *
+         * X-axis: b_f / d_f (body width to diameter ratio at specific station)
+         * Y-axis: Kbeta (empirical factor)
+         *
+         * Multiple curves are provided for different fineness ratios (l_f/d_f)
+         * where l_f is body length and d_f is maximum body diameter
+         */
+
+        // Fineness ratio l_f/d_f = 2.5
+        inline constexpr double Kbeta_x_2_5[] = {
+            0.104036, 0.14054, 0.186464, 0.309212, 0.406106,
+            0.504954, 0.608771, 0.709419, 0.805717};
+        inline constexpr double Kbeta_y_2_5[] = {
+            0.172295, 0.183396, 0.196881, 0.234701, 0.263481,
+            0.294412, 0.325292, 0.354655, 0.384061};
+
+        // l_f/d_f = 3.0
+        inline constexpr double Kbeta_x_3[] = {
+            0.10265, 0.142953, 0.203788, 0.30698, 0.405159,
+            0.50546, 0.609455, 0.708074, 0.80584};
+        inline constexpr double Kbeta_y_3[] = {
+            0.148636, 0.161456, 0.179854, 0.210637, 0.240438,
+            0.271458, 0.301613, 0.332029, 0.361834};
+
+        // l_f/d_f = 4.0
+        inline constexpr double Kbeta_x_4[] = {
+            0.101248, 0.203189, 0.305544, 0.40456, 0.504819,
+            0.60676, 0.707425, 0.805207};
+        inline constexpr double Kbeta_y_4[] = {
+            0.114537, 0.145126, 0.175711, 0.20571, 0.235697,
+            0.266286, 0.296062, 0.32628};
+
+        // l_f/d_f = 5.0
+        inline constexpr double Kbeta_x_5[] = {
+            0.1007, 0.202244, 0.304582, 0.403607, 0.50472,
+            0.607489, 0.706953, 0.804288};
+        inline constexpr double Kbeta_y_5[] = {
+            0.0810489, 0.112056, 0.142228, 0.172433, 0.203031,
+            0.233612, 0.264434, 0.29383};
+
+        // l_f/d_f = 6.0
+        inline constexpr double Kbeta_x_6[] = {
+            0.099545, 0.201909, 0.304669, 0.402866, 0.503133,
+            0.605919, 0.706195, 0.805634};
+        inline constexpr double Kbeta_y_6[] = {
+            0.0529428, 0.0837347, 0.114109, 0.144323, 0.174516,
+            0.20551, 0.23591, 0.266112};
+
+        // l_f/d_f = 7.0
+        inline constexpr double Kbeta_x_7[] = {
+            0.0996513, 0.200755, 0.303542, 0.402152, 0.502428,
+            0.605646, 0.705896, 0.802833};
+        inline constexpr double Kbeta_y_7[] = {
+            0.0353681, 0.0657593, 0.0967535, 0.126963, 0.157363,
+            0.188766, 0.218546, 0.24836};
+
+        // l_f/d_f = 8.0
+        inline constexpr double Kbeta_x_8[] = {
+            0.0990992, 0.200609, 0.303404, 0.40198, 0.503093,
+            0.60631, 0.705335, 0.803075};
+        inline constexpr double Kbeta_y_8[] = {
+            0.021935, 0.0521153, 0.0833162, 0.1127, 0.143297,
+            0.174701, 0.204906, 0.234092};
+
+        // l_f/d_f = 10.0
+        inline constexpr double Kbeta_x_10[] = {
+            0.0970668, 0.201112, 0.303053, 0.401647, 0.502743,
+            0.60596, 0.754502, 0.802319};
+        inline constexpr double Kbeta_y_10[] = {
+            0.0027281, 0.0341229, 0.0647123, 0.094509, 0.124694,
+            0.156097, 0.201509, 0.215699};
+
+        // Vertical tail lift slope data for various aspect ratios
+        inline constexpr double equivalentAspectRatioVerticalTail[] = {
+            0.00941024, 0.128102, 0.229043, 0.349922, 0.527122,
+            0.739681, 0.893405, 1.08975, 1.26472, 1.48846,
+            1.76238, 1.99185, 2.25655, 2.49888, 2.80578,
+            3.04811, 3.38953, 3.68078, 3.95009, 4.19103,
+            4.50953, 4.8483, 5.10196, 5.34891, 5.64435,
+            5.9472, 6.25704, 6.47479};
+
+        inline constexpr double liftSlopeVerticalTail[] = {
+            -9.66e-07, 0.00355346, 0.00757104, 0.0122616, 0.0171581,
+            0.022265, 0.0258605, 0.0298099, 0.0335462, 0.0371997,
+            0.0414958, 0.0444953, 0.0476325, 0.0500489, 0.0533225,
+            0.0557389, 0.0587877, 0.061194, 0.0630969, 0.0647881,
+            0.066826, 0.0684969, 0.0695326, 0.0707147, 0.0716691,
+            0.0728397, 0.0740088, 0.074544};
+
+        inline constexpr double x_lambda1[] = {
+            0.00492954, 0.0294306, 0.0588647, 0.108073, 0.167129,
+            0.265724, 0.384109, 0.487752, 0.601274, 0.714835,
+            0.843219, 0.941981, 1.07534, 1.21369, 1.34215,
+            1.50029, 1.68315, 1.85614, 2.01433, 2.14781,
+            2.3308, 2.49894, 2.67205, 2.81055, 2.97376,
+            3.1172, 3.31996, 3.58699, 3.81938, 4.09626,
+            4.47695, 4.80325, 5.17897, 5.52997, 5.9996,
+            6.51373, 7.00809};
+
+        inline constexpr double y_lambda1[] = {
+            0.00803152, 0.132505, 0.263003, 0.393506, 0.546095,
+            0.704718, 0.853309, 0.951708, 1.05412, 1.13446,
+            1.21881, 1.28107, 1.34535, 1.38755, 1.42573,
+            1.45589, 1.48806, 1.50417, 1.50823, 1.50024,
+            1.45813, 1.42205, 1.37191, 1.32577, 1.28366,
+            1.23552, 1.19543, 1.14532, 1.11929, 1.09327,
+            1.06929, 1.05734, 1.0454, 1.03948, 1.04162,
+            1.03976, 1.03388};
+
+        inline constexpr double x_lambda06[] = {
+            -0.00495048, -0.0100685, -0.000377047, 0.00437793, 0.00422083,
+            0.0386508, 0.0730633, 0.132176, 0.196281, 0.275188,
+            0.383764, 0.502244, 0.640463, 0.80835, 1.08993,
+            1.35675, 1.53465, 1.70763, 1.90535, 2.04871,
+            2.18221, 2.28112, 2.39488, 2.51853, 2.71144,
+            2.85985, 3.02803, 3.17148, 3.3149, 3.47316,
+            3.63141, 3.84403, 4.05664, 4.30385, 4.556,
+            4.86253, 5.20861, 5.51018, 5.85623, 6.17263,
+            6.50879, 6.98833};
+
+        inline constexpr double y_lambda06[] = {
+            0.00401364, 0.104389, 0.216813, 0.325221, 0.415559,
+            0.515946, 0.62637, 0.746838, 0.839203, 0.947632,
+            1.05205, 1.14644, 1.26091, 1.37137, 1.48388,
+            1.56225, 1.59843, 1.62458, 1.63467, 1.63471,
+            1.61869, 1.59865, 1.56254, 1.52644, 1.46226,
+            1.40408, 1.3419, 1.29376, 1.25967, 1.21957,
+            1.18548, 1.16145, 1.13742, 1.1134, 1.09541,
+            1.08144, 1.06147, 1.05152, 1.0476, 1.03966,
+            1.03574, 1.02785};
+
+        inline constexpr double x_xcv05[] = {
+            -0.0030876, -0.0324491, -0.0819857, -0.137944, -0.205824,
+            -0.275518, -0.34152, -0.424909, -0.486273, -0.53939,
+            -0.593406, -0.634554, -0.691217, -0.728667, -0.755105,
+            -0.788846, -0.812525, -0.842538, -0.87163, -0.89798,
+            -0.922475, -0.943284, -0.962233, -0.98033, -0.99113,
+            -1.00196};
+
+        inline constexpr double y_xcv05[] = {
+            1.04822, 1.03008, 1.00295, 0.972191, 0.936033,
+            0.905454, 0.884086, 0.866648, 0.86374, 0.862577,
+            0.866981, 0.886033, 0.921954, 0.95207, 0.989451,
+            1.03433, 1.07538, 1.14059, 1.20764, 1.27279,
+            1.34534, 1.42524, 1.51438, 1.58313, 1.64253,
+            1.69267};
+
+        inline constexpr double x_xcv06[] = {
+            0.00271779, -0.0284928, -0.0697879, -0.105595, -0.149637,
+            -0.20195, -0.275342, -0.325777, -0.383531, -0.44128,
+            -0.492589, -0.549369, -0.595149, -0.624423, -0.653667,
+            -0.688393, -0.713047, -0.736785, -0.765965, -0.796964,
+            -0.820649, -0.846143, -0.86613, -0.887919, -0.906985,
+            -0.921501, -0.935049, -0.957684, -0.976638, -0.999213};
+
+        inline constexpr double y_xcv06[] = {
+            1.1463, 1.12263, 1.09539, 1.06622, 1.03901,
+            1.00265, 0.961009, 0.93944, 0.919818, 0.902047,
+            0.893453, 0.892337, 0.894782, 0.904421, 0.923319,
+            0.945993, 0.968535, 0.991066, 1.03033, 1.07333,
+            1.11253, 1.15916, 1.20942, 1.26896, 1.32106,
+            1.36384, 1.42328, 1.50506, 1.59234, 1.69264};
+
+        inline constexpr double x_xcv07[] = {
+            0.000199579, -0.0310169, -0.067751, -0.105395, -0.148539,
+            -0.199942, -0.243081, -0.292617, -0.349503, -0.399938,
+            -0.430197, -0.466861, -0.49526, -0.528243, -0.567619,
+            -0.594157, -0.622509, -0.65359, -0.683738, -0.714802,
+            -0.750386, -0.777775, -0.798737, -0.821495, -0.845145,
+            -0.865144, -0.885107, -0.90962, -0.924119, -0.942234,
+            -0.958529, -0.977524, -1.00103};
+
+        inline constexpr double y_xcv07[] = {
+            1.21856, 1.19303, 1.16018, 1.12918, 1.09641,
+            1.05818, 1.02726, 1.00012, 0.965674, 0.944105,
+            0.931534, 0.920898, 0.917562, 0.912434, 0.912944,
+            0.918844, 0.930323, 0.947393, 0.970007, 0.992633,
+            1.03384, 1.06012, 1.09187, 1.13476, 1.18507,
+            1.23163, 1.28929, 1.35628, 1.40462, 1.46782,
+            1.52729, 1.60161, 1.69637};
+
+        inline constexpr double x_xcv08[] = {
+            0.000434377, -0.031733, -0.0629612, -0.0896108, -0.130935,
+            -0.163091, -0.194301, -0.231945, -0.263156, -0.300794,
+            -0.351258, -0.394373, -0.437459, -0.474134, -0.507106,
+            -0.534589, -0.559313, -0.588604, -0.620625, -0.659026,
+            -0.688247, -0.71654, -0.745755, -0.775856, -0.802312,
+            -0.825956, -0.845966, -0.86323, -0.884121, -0.909562,
+            -0.925862, -0.943983, -0.962104, -0.982924, -0.998286};
+
+        inline constexpr double y_xcv08[] = {
+            1.29263, 1.25601, 1.22678, 1.1975, 1.161,
+            1.12808, 1.10441, 1.07341, 1.04974, 1.0206,
+            0.989772, 0.966256, 0.951999, 0.937659, 0.936235,
+            0.932887, 0.933208, 0.937291, 0.946966, 0.965983,
+            0.992288, 1.02229, 1.05044, 1.08787, 1.1197,
+            1.17186, 1.21471, 1.25753, 1.3115, 1.3748,
+            1.43242, 1.49377, 1.55512, 1.63132, 1.69633};
+
+        inline constexpr double x_Kvh[] = {
+            0.00528463, 0.047778, 0.0867195, 0.116767, 0.161036,
+            0.207125, 0.254975, 0.304644, 0.361432, 0.418234,
+            0.471542, 0.540863, 0.615612, 0.699255, 0.788415,
+            0.89002, 1.01494, 1.11134, 1.21313, 1.32743,
+            1.42032, 1.54721, 1.65983, 1.75282, 1.83688,
+            1.95317};
+
+        inline constexpr double y_Kvh[] = {
+            0.0112236, 0.0730661, 0.131152, 0.181711, 0.245432,
+            0.305441, 0.369192, 0.429231, 0.49492, 0.558746,
+            0.611363, 0.677157, 0.735543, 0.801457, 0.848785,
+            0.907397, 0.960614, 0.998687, 1.03308, 1.0713,
+            1.09817, 1.12904, 1.15234, 1.16803, 1.17991,
+            1.19207};
+
+        // K factor vs Aspect Ratio (lift slope, Vee tail, directional)
+        // Data digitized from plots via Plot Digitizer 2.6.8
+        // X = Aspect Ratio, Y = K factor
+
+        // Lambda = 0.25
+        inline constexpr double K_factor_x_lambda_025[] = {
+            3.00067, 3.14328, 3.33173, 3.52008, 3.72369,
+            4.00365, 4.50730, 4.98551, 5.49917, 5.99747,
+            6.48557, 7.00409, 7.48697, 7.98509, 8.48829,
+            8.98634, 9.47928, 9.98240};
+
+        inline constexpr double K_factor_y_lambda_025[] = {
+            0.607499, 0.612965, 0.620051, 0.626121, 0.632392,
+            0.641090, 0.653618, 0.665540, 0.676441, 0.685921,
+            0.694794, 0.703255, 0.710502, 0.717950, 0.725398,
+            0.732033, 0.738263, 0.744898};
+
+        // Lambda = 0.5
+        inline constexpr double K_factor_x_lambda_05[] = {
+            2.99893, 3.22805, 3.49782, 3.99651, 4.51027,
+            4.99340, 5.50191, 5.99001, 6.49837, 7.00669,
+            7.50985, 7.98763, 8.48570, 8.98879, 9.48684,
+            9.99496};
+
+        inline constexpr double K_factor_y_lambda_05[] = {
+            0.645094, 0.652987, 0.661281, 0.675029, 0.687149,
+            0.697241, 0.707330, 0.716202, 0.724665, 0.732518,
+            0.739559, 0.746604, 0.753443, 0.759671, 0.766306,
+            0.771924};
+
+        // Lambda = 1.0
+        inline constexpr double K_factor_x_lambda_1[] = {
+            2.80820, 3.05270, 3.34285, 3.63291, 3.99410,
+            4.48751, 4.99101, 5.49441, 5.98753, 6.48574,
+            6.99913, 7.47695, 7.99019, 8.34091, 8.62551,
+            8.97618, 9.47921, 9.95181};
+
+        inline constexpr double K_factor_y_lambda_1[] = {
+            0.669508,
+            0.679024,
+            0.688128,
+            0.696215,
+            0.705106,
+            0.716619,
+            0.727521,
+            0.737204,
+            0.745466,
+            0.753930,
+            0.761783,
+            0.769234,
+            0.775461,
+            0.780694,
+            0.784515,
+            0.789139,
+            0.794758,
+            0.800584};
+
+        // LOW WING  Ki factor Roskam Part VI - zw/df positive
+        inline constexpr double Ki_x_low_wing[] = {
+            -1.19e-05, 0.0992818, 0.195163, 0.301377, 0.40243,
+            0.503448, 0.602778, 0.702131, 0.803172, 0.904166,
+            1.00526};
+        inline constexpr double Ki_y_low_wing[] = {
+            1.00086, 1.05216, 1.10085, 1.15044, 1.19914,
+            1.25044, 1.29915, 1.34612, 1.39569, 1.44872,
+            1.49484};
+
+        // HIGH WING Ki factor Roskam Part VI - zw/df negative
+        inline constexpr double Ki_x_high_wing[] = {
+            -0.00183138, -0.0964458, -0.22968, -0.305029, -0.408353,
+            -0.524064, -0.609925, -0.697616, -0.795729, -0.893843,
+            -0.962269, -1.00948};
+        inline constexpr double Ki_y_high_wing[] = {
+            1.00602, 1.08398, 1.19795, 1.26050, 1.34273,
+            1.44213, 1.51325, 1.59038, 1.67091, 1.75144,
+            1.81316, 1.84654};
+
+        // Kv factor - side force vertical tail (CSV 31)
+        inline constexpr double Kv[] = {
+            2.01132, 2.51182, 3.01659, 3.49571};
+        inline constexpr double verticalTailSpanToFuselageDepthInRegionOfVerticalRatio[] = {
+            0.751998, 0.835855, 0.912854, 0.995003};
+
+        // Vertical twins side force evaluation
+        //  bh/lf = 1.0
+        inline constexpr double ratio_WHF_x_bh_lf_1[] = {
+            0.00632926, 0.0386912, 0.0861026, 0.1448, 0.205755,
+            0.305086, 0.402155, 0.505995, 0.603816, 0.703893,
+            0.80397, 0.899531, 1.00036};
+
+        inline constexpr double ratio_WHF_y_bh_lf_1[] = {
+            1.0, 0.990821, 0.980883, 0.97172, 0.96256,
+            0.951895, 0.946598, 0.942842, 0.93908, 0.936855,
+            0.93463, 0.933169, 0.932479};
+
+        //  bh/lf = 0.8
+        inline constexpr double ratio_WHF_x_bh_lf_08[] = {
+            0.00482493, 0.0326728, 0.0672937, 0.102667, 0.20276,
+            0.303602, 0.402937, 0.503019, 0.6031, 0.701674,
+            0.801751, 0.902581, 1.0019};
+
+        inline constexpr double ratio_WHF_y_bh_lf_08[] = {
+            0.999234, 0.989281, 0.977799, 0.967085, 0.942609,
+            0.922738, 0.906701, 0.896804, 0.889975, 0.88468,
+            0.881688, 0.879463, 0.878772};
+
+        //  bh/lf = 0.6
+        inline constexpr double ratio_WHF_x_bh_lf_06[] = {
+            0.000309697, 0.0341816, 0.0733229, 0.101925, 0.205792,
+            0.303632, 0.401467, 0.504564, 0.601637, 0.700968,
+            0.802553, 0.902635, 1.00271};
+
+        inline constexpr double ratio_WHF_y_bh_lf_06[] = {
+            0.999998, 0.983912, 0.96476, 0.951739, 0.911921,
+            0.88284, 0.85913, 0.842329, 0.83243, 0.821764,
+            0.814937, 0.806574, 0.802814};
+
+        //  bh/lf = 0.4
+        inline constexpr double ratio_WHF_x_bh_lf_04[] = {
+            0.00106271, 0.0168754, 0.0409644, 0.0733348, 0.103447,
+            0.149367, 0.205069, 0.300664, 0.356361, 0.405285,
+            0.505382, 0.601713, 0.702554, 0.801135, 0.900465,
+            1.00356};
+
+        inline constexpr double ratio_WHF_y_bh_lf_04[] = {
+            0.999232, 0.983899, 0.969339, 0.948648, 0.928722,
+            0.901136, 0.872023, 0.82606, 0.803853, 0.783941,
+            0.754095, 0.729617, 0.712047, 0.697545, 0.686879,
+            0.680053};
+
+        // C bh/lf = 0.2
+        inline constexpr double ratio_WHF_x_bh_lf_02[] = {
+            0.00482493, 0.0183848, 0.0432308, 0.0786223, 0.103469,
+            0.205864, 0.303735, 0.370732, 0.401598, 0.503215,
+            0.580739, 0.60106, 0.70266, 0.801247, 0.900582,
+            1.00067};
+
+        inline constexpr double ratio_WHF_y_bh_lf_02[] = {
+            0.999234, 0.977762, 0.957065, 0.92103, 0.898799,
+            0.815246, 0.742431, 0.702585, 0.681893, 0.631332,
+            0.602235, 0.594578, 0.567802, 0.545627, 0.529591,
+            0.517391};
+
+        // dCy/dBeta effective Vertical twin
+        // gammaLE = 0°
+        inline constexpr double effectiveAspectRatioVerticalTwin_0[] = {
+            0.489604, 0.590556, 0.740132, 0.942137, 1.10675,
+            1.24145, 1.45847, 1.70175, 1.9675, 2.22958,
+            2.51044, 2.80628, 3.01228, 3.24823, 3.51417,
+            3.79138, 4.00115, 4.24842, 4.50691, 4.63431};
+
+        inline constexpr double sideForceWRTBetaEffective_0[] = {
+            0.955684, 1.12458, 1.36259, 1.63135, 1.8387,
+            1.99614, 2.25342, 2.48774, 2.73742, 2.93342,
+            3.11026, 3.28713, 3.38332, 3.51024, 3.62953,
+            3.73734, 3.8182, 3.89528, 3.98005, 4.00709};
+
+        // gammaLE = 20°
+        inline constexpr double effectiveAspectRaticoVerticalTwin_20[] = {
+            0.508384, 0.60189, 0.788937, 0.931073, 1.11815,
+            1.30521, 1.51477, 1.7169, 1.96023, 2.18488,
+            2.45448, 2.75033, 3.01626, 3.28969, 3.50695,
+            3.88157, 4.27119, 4.6084, 4.85944, 5.01309};
+
+        inline constexpr double sideForceWRTBetaEffective_20[] = {
+            0.928866, 1.06324, 1.30897, 1.50861, 1.73517,
+            1.96939, 2.19982, 2.38038, 2.58784, 2.74926,
+            2.92609, 3.09912, 3.22608, 3.35306, 3.4416,
+            3.5764, 3.69972, 3.78078, 3.83869, 3.85426};
+
+        // DeltaCn_beta versus wing position to maximum fuselage diameter ratio
+
+        // Wing position to maximum fuselage diameter ratio
+        inline constexpr double wingToMaximumFuselageDiameterRatio[] = {
+            0.146854, 0.172482, 0.206499, 0.243947, 0.289077,
+            0.344711, 0.389921, 0.443541, 0.477663, 0.523627,
+            0.575922, 0.621210, 0.681228, 0.746795, 0.814521,
+            0.875968, 0.927614, 0.972332, 1.00028};
+
+        // DeltaCn_beta
+        inline constexpr double deltaCnBetaDueToVerticalTailSurface[] = {
+            -0.000286658, -0.000248600, -0.000206470, -0.000155759, -0.000100533,
+            -4.20949e-05, 4.68170e-06, 5.31830e-05, 8.40474e-05, 0.000125218,
+            0.000165217, 0.000203544, 0.000243834, 0.000291375, 0.000333363,
+            0.000370888, 0.000405228, 0.000429447, 0.000444584};
+
+        // ============================================================
+        // Rudder Effectiveness Data
+        // Source: Plot Digitizer 2.6.8 - 17/03/2026
+        // x = deflection angle [deg]
+        // y = rudder effectiveness [-]
+        // ============================================================
+
+        // --- AR = 1.5 | cr/c = 0.30 ---
+        inline constexpr double x_rudder_AR1_5_cr_c_0_30[] = {
+            4.77487, 9.54973, 14.2305, 18.9113, 24.0625, 28.4375};
+        inline constexpr double y_rudder_AR1_5_cr_c_0_30[] = {
+            0.548023, 0.559322, 0.566586, 0.527845, 0.462470, 0.404358};
+
+        // --- AR = 1.5 | cr/c = 0.37 ---
+        inline constexpr double x_rudder_AR1_5_cr_c_0_37[] = {
+            4.51613, 9.73790, 14.7715, 20.3461, 25.3091, 30.8367};
+        inline constexpr double y_rudder_AR1_5_cr_c_0_37[] = {
+            0.598870, 0.619855, 0.610977, 0.598870, 0.556901, 0.488297};
+
+        // --- AR = 1.5 | cr/c = 0.45 ---
+        inline constexpr double x_rudder_AR1_5_cr_c_0_45[] = {
+            5.17473, 9.97312, 14.7480, 21.0282, 25.4973, 30.6956};
+        inline constexpr double y_rudder_AR1_5_cr_c_0_45[] = {
+            0.621469, 0.636804, 0.645682, 0.661017, 0.635997, 0.535109};
+
+        // --- AR = 2.0 | cr/c = 0.30 ---
+        inline constexpr double x_rudder_AR2_0_cr_c_0_30[] = {
+            4.79312, 9.54171, 14.3840, 18.9431, 24.0875, 28.4107};
+        inline constexpr double y_rudder_AR2_0_cr_c_0_30[] = {
+            0.547725, 0.558788, 0.561788, 0.535793, 0.450946, 0.402399};
+
+        // --- AR = 2.0 | cr/c = 0.37 ---
+        inline constexpr double x_rudder_AR2_0_cr_c_0_37[] = {
+            4.48941, 9.70801, 14.8555, 20.2604, 25.3363, 30.8098};
+        inline constexpr double y_rudder_AR2_0_cr_c_0_37[] = {
+            0.595282, 0.603905, 0.596416, 0.560712, 0.525829, 0.441773};
+
+        // --- AR = 2.0 | cr/c = 0.45 ---
+        inline constexpr double x_rudder_AR2_0_cr_c_0_45[] = {
+            5.19597, 10.0869, 14.7397, 20.9693, 25.4786, 30.7888};
+        inline constexpr double y_rudder_AR2_0_cr_c_0_45[] = {
+            0.630705, 0.674799, 0.641546, 0.655764, 0.560472, 0.506238};
+
+    } // namespace DIRECTIONAL
+
+    /// Flap contribution to the parasite drag (DATCOM / Roskam Part VI)
+    namespace CD0_FLAP
+    {
+        // ============================================================
+        // DELTA 1 — Dipendenza dal Flap Chord Ratio (cf/c)
+        // ============================================================
+
+        // Slotted Flap, t/c = 0.12
+        inline constexpr double x_delta1_slotted_tc012[] = {
+            0.00159403, 0.0430673, 0.0877139, 0.130226, 0.165823, 0.218411,
+            0.269378, 0.319278, 0.339972, 0.358527, 0.372816, 0.380750, 0.388679};
+        inline constexpr double y_delta1_slotted_tc012[] = {
+            0.00901016, 0.168349, 0.384670, 0.612953, 0.823170, 1.15947,
+            1.55868, 1.96388, 2.15593, 2.37194, 2.60588, 2.74683, 2.89978};
+
+        // Slotted Flap, t/c = 0.21
+        inline constexpr double x_delta1_slotted_tc021[] = {
+            0.00213218, 0.0505095, 0.0919714, 0.137138, 0.178577, 0.231162,
+            0.252926, 0.283184, 0.315027, 0.345282, 0.367564, 0.398341};
+        inline constexpr double y_delta1_slotted_tc021[] = {
+            -0.00596847, 0.201406, 0.390715, 0.640009, 0.889258, 1.23454,
+            1.41463, 1.66075, 1.93985, 2.19496, 2.41401, 2.69610};
+
+        // Plain Flap, t/c = 0.30
+        inline constexpr double x_delta1_plain_tc030[] = {
+            0.00212651, 0.0446647, 0.0930330, 0.168485, 0.223197,
+            0.261431, 0.295424, 0.324621, 0.364455, 0.401097};
+        inline constexpr double y_delta1_plain_tc030[] = {
+            0.00901654, 0.168368, 0.399718, 0.823202, 1.17751,
+            1.45369, 1.67887, 1.91599, 2.18620, 2.44738};
+
+        // Plain Flap, t/c = 0.12
+        inline constexpr double x_delta1_plain_tc012[] = {
+            0.00159744, 0.0499850, 0.103127, 0.160515, 0.225852, 0.275260,
+            0.303410, 0.325195, 0.346450, 0.370365, 0.399600};
+        inline constexpr double y_delta1_plain_tc012[] = {
+            1.91502e-05, 0.180420, 0.459780, 0.778152, 1.19552, 1.49282,
+            1.68197, 1.80511, 1.92224, 2.04541, 2.18362};
+
+        // Plain Flap, t/c = 0.21
+        inline constexpr double x_delta1_plain_tc021[] = {
+            0.00478891, 0.0382920, 0.0728475, 0.121201, 0.163705, 0.208865,
+            0.255085, 0.291208, 0.324690, 0.353920, 0.382090, 0.401764};
+        inline constexpr double y_delta1_plain_tc021[] = {
+            0.00904846, 0.123337, 0.270605, 0.540916, 0.790178, 1.05745,
+            1.33673, 1.56494, 1.73317, 1.88337, 2.01858, 2.09374};
+
+        // ============================================================
+        // DELTA 2 — Dipendenza dalla Deflessione del Flap (gradi)
+        // ============================================================
+
+        // Split Flap, t/c = 0.12
+        inline constexpr double x_delta2_split_tc012[] = {
+            0.343643, 5.26919, 10.3093, 17.1821, 22.6804, 30.0115, 38.9462,
+            47.6518, 54.7537, 63.2302, 71.3631, 77.0905, 81.4433, 83.8488, 86.8270, 89.6907};
+        inline constexpr double y_delta2_split_tc012[] = {
+            0.000994036, 0.00646123, 0.0156561, 0.0315606, 0.0467197, 0.0708250, 0.0979125,
+            0.129722, 0.153579, 0.180417, 0.204026, 0.218439, 0.227386, 0.230865, 0.234095, 0.234841};
+
+        // Split Flap, t/c = 0.30
+        inline constexpr double x_delta2_split_tc030[] = {
+            0.458190, 5.26919, 9.85109, 16.2658, 21.5349, 32.4170, 38.9462,
+            45.0172, 53.7228, 61.8557, 69.4158, 75.1432, 79.8396, 83.6197, 87.1707, 89.3471};
+        inline constexpr double y_delta2_split_tc030[] = {
+            0.000994036, 0.00149105, 0.00397614, 0.0124254, 0.0216203, 0.0424950, 0.0581511,
+            0.0770378, 0.104622, 0.130716, 0.152087, 0.169483, 0.182406, 0.190855, 0.197565, 0.200547};
+
+        // Split Flap, t/c = 0.21
+        inline constexpr double x_delta2_split_tc021[] = {
+            0.343643, 5.95647, 11.4548, 16.8385, 24.1695, 30.1260, 37.4570,
+            44.6735, 52.9210, 59.6793, 63.5739, 68.6140, 73.3104, 77.0905,
+            80.6415, 83.2761, 86.1397, 90.1489};
+        inline constexpr double y_delta2_split_tc021[] = {
+            -0.000497018, 0.00273360, 0.00869781, 0.0191352, 0.0333002, 0.0509443, 0.0745527,
+            0.0999006, 0.128976, 0.153579, 0.164761, 0.179175, 0.194085, 0.204026,
+            0.211233, 0.216203, 0.219433, 0.223658};
+
+        // Slotted Flap, t/c = 0.30
+        inline constexpr double x_delta2_slotted_tc030[] = {
+            0.458190, 6.41466, 13.1730, 20.8477, 27.9496, 34.1352, 42.2680,
+            48.1100, 55.4410, 61.9702, 67.4685, 72.1649, 77.0905, 82.8179, 87.7434, 92.7835};
+        inline constexpr double y_delta2_slotted_tc030[] = {
+            0.000248509, 0.000994036, 0.00521869, 0.0109344, 0.0206262, 0.0333002, 0.0506958,
+            0.0636183, 0.0792744, 0.0926938, 0.102634, 0.109841, 0.116551, 0.123012, 0.126243, 0.127237};
+
+        // Slotted Flap, t/c = 0.21
+        inline constexpr double x_delta2_slotted_tc021[] = {
+            0.229095, 7.21650, 13.2875, 20.2749, 29.2096, 38.0298, 46.9645,
+            55.6701, 60.7102, 67.4685, 73.5395, 77.8923, 82.5888, 85.6816,
+            88.0871, 90.1489, 93.3562};
+        inline constexpr double y_delta2_slotted_tc021[] = {
+            0.000248509, 0.00149105, 0.00472167, 0.0106859, 0.0218688, 0.0357853, 0.0497018,
+            0.0636183, 0.0705765, 0.0805169, 0.0889662, 0.0959245, 0.102137, 0.104125,
+            0.104871, 0.104871, 0.103877};
+
+        // Slotted Flap, t/c = 0.12
+        inline constexpr double x_delta2_slotted_tc012[] = {
+            0.229095, 7.21650, 11.6838, 15.5785, 19.8167, 25.0859, 29.6678,
+            33.2188, 37.6861, 42.0389, 47.3081, 54.7537, 60.2520, 64.7194,
+            71.0195, 77.4341, 82.9324, 86.9416, 89.6907, 92.6690};
+        inline constexpr double y_delta2_slotted_tc012[] = {
+            0.000248509, 0.000248509, 0.00149105, 0.00298211, 0.00571571, 0.0109344, 0.0168986,
+            0.0246024, 0.0328032, 0.0424950, 0.0534294, 0.0666004, 0.0765408, 0.0844930,
+            0.0934394, 0.101640, 0.108101, 0.112326, 0.114314, 0.114066};
+
+        // Plain Flap, tutti i t/c
+        inline constexpr double x_delta2_plain_all_tc[] = {
+            0.114548, 3.78007, 8.59107, 14.7766, 21.3440, 30.1260,
+            39.5189, 46.7736, 51.8137, 57.6174, 62.0466, 64.1848};
+        inline constexpr double y_delta2_plain_all_tc[] = {
+            0.000248509, 0.00132538, 0.00712392, 0.0188867, 0.0324718, 0.0569914,
+            0.0849901, 0.108516, 0.127402, 0.145129, 0.156395, 0.162856};
+
+    } // namespace CD0_FLAP
+
+    // ============================================================
+    // Chart construction helpers
+    // ============================================================
+
+    namespace detail
+    {
+        template <size_t N>
+        inline std::vector<double> toVector(const double (&table)[N])
+        {
+            return std::vector<double>(table, table + N);
+        }
+
+        template <size_t NX, size_t NY>
+        inline RegressionModel fitChart(const double (&x)[NX], const double (&y)[NY], int degree, RegressionMethod method)
+        {
+            static_assert(NX == NY, "Digitized chart x and y tables must have the same length");
+            return Interpolant(toVector(x), toVector(y), degree, method).getModel();
+        }
+
+        template <size_t NX, size_t NY>
+        inline void addCurve(Interpolant2D &chart, double parameter, const double (&x)[NX], const double (&y)[NY])
+        {
+            static_assert(NX == NY, "Digitized chart x and y tables must have the same length");
+            chart.addCurve(parameter, toVector(x), toVector(y));
+        }
+
+        template <size_t NX, size_t NY>
+        inline void addCurve(Interpolant3D &chart, double param2, double param1, const double (&x)[NX], const double (&y)[NY])
+        {
+            static_assert(NX == NY, "Digitized chart x and y tables must have the same length");
+            chart.addCurve(param2, param1, toVector(x), toVector(y));
+        }
+    } // namespace detail
+
+    // ============================================================
+    // Fitted charts - longitudinal
+    // ============================================================
+
+    /// Endplate factor R vs vertical tail height / horizontal tail span (H and U tails)
+    inline const RegressionModel &endplateFactorR()
+    {
+        static const RegressionModel chart = detail::fitChart(LONGITUDINAL::endplateHeighToHorizontalSpanRatio,
+                                                              LONGITUDINAL::factorRToHorizontalTailContribution,
+                                                              2, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Slope of normal force [1/deg] vs aspect ratio of a vee tail (NACA TN-775)
+    inline const RegressionModel &veeTailNormalForceSlope()
+    {
+        static const RegressionModel chart = detail::fitChart(LONGITUDINAL::aspectRatioOfVeeTail,
+                                                              LONGITUDINAL::slopeOfNormalForce,
+                                                              1, RegressionMethod::POWER);
+        return chart;
+    }
+
+    /// Upwash gradient on the wing due to the canard: x = distance ratio, parameter = aspect ratio
+    inline const Interpolant2D &canardUpwashGradient()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D upwash(1, RegressionMethod::POWER);
+            detail::addCurve(upwash, 4.0, LONGITUDINAL::x_AR4, LONGITUDINAL::y_AR4);
+            detail::addCurve(upwash, 6.0, LONGITUDINAL::x_AR6, LONGITUDINAL::y_AR6);
+            detail::addCurve(upwash, 9.0, LONGITUDINAL::x_AR9, LONGITUDINAL::y_AR9);
+            detail::addCurve(upwash, 12.0, LONGITUDINAL::x_AR12, LONGITUDINAL::y_AR12);
+            return upwash;
+        }();
+        return chart;
+    }
+
+    /// Perkins upwash gradient, curve A (body segments ahead of the wing)
+    inline const RegressionModel &fuselageUpwashGradientCurveA()
+    {
+        static const RegressionModel chart = detail::fitChart(LONGITUDINAL::x_A_curve, LONGITUDINAL::y_A_curve,
+                                                              2, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Perkins upwash gradient, curve B (body segment adjacent to the wing leading edge)
+    inline const RegressionModel &fuselageUpwashGradientCurveB()
+    {
+        static const RegressionModel chart = detail::fitChart(LONGITUDINAL::x_B_curve, LONGITUDINAL::y_B_curve,
+                                                              2, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Body / nacelle moment factor Kf vs position of the root quarter chord [% length]
+    inline const RegressionModel &bodyMomentFactorKf()
+    {
+        static const RegressionModel chart = detail::fitChart(LONGITUDINAL::Kf_x, LONGITUDINAL::Kf_y,
+                                                              1, RegressionMethod::EXPONENTIAL);
+        return chart;
+    }
+
+    // ============================================================
+    // Fitted charts - control surface effectiveness
+    // ============================================================
+
+    /// Flap span factor Kb: x = spanwise station eta, parameter = taper ratio
+    inline const Interpolant2D &flapSpanFactorKb()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D kb(3, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(kb, 0.0, FLAP_EFFECTIVENESS::x_Kb_taper0, FLAP_EFFECTIVENESS::y_Kb_taper0);
+            detail::addCurve(kb, 0.5, FLAP_EFFECTIVENESS::x_Kb_taper05, FLAP_EFFECTIVENESS::y_Kb_taper05);
+            detail::addCurve(kb, 1.0, FLAP_EFFECTIVENESS::x_Kb_taper1, FLAP_EFFECTIVENESS::y_Kb_taper1);
+            return kb;
+        }();
+        return chart;
+    }
+
+    /// Ratio of 3D to 2D flap effectiveness (alphaCL/alphaCl): x = aspect ratio, parameter = curve label
+    inline const Interpolant2D &flapEffectivenessRatio()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D ratio(1, RegressionMethod::POWER);
+            detail::addCurve(ratio, 0.1, FLAP_EFFECTIVENESS::x_RatioFlapEff_cf01, FLAP_EFFECTIVENESS::y_RatioFlapEff_cf01);
+            detail::addCurve(ratio, 0.2, FLAP_EFFECTIVENESS::x_RatioFlapEff_cf02, FLAP_EFFECTIVENESS::y_RatioFlapEff_cf02);
+            detail::addCurve(ratio, 0.3, FLAP_EFFECTIVENESS::x_RatioFlapEff_cf03, FLAP_EFFECTIVENESS::y_RatioFlapEff_cf03);
+            detail::addCurve(ratio, 0.4, FLAP_EFFECTIVENESS::x_RatioFlapEff_cf04, FLAP_EFFECTIVENESS::y_RatioFlapEff_cf04);
+            detail::addCurve(ratio, 0.5, FLAP_EFFECTIVENESS::x_RatioFlapEff_cf05, FLAP_EFFECTIVENESS::y_RatioFlapEff_cf05);
+            detail::addCurve(ratio, 0.6, FLAP_EFFECTIVENESS::x_RatioFlapEff_cf06, FLAP_EFFECTIVENESS::y_RatioFlapEff_cf06);
+            detail::addCurve(ratio, 0.7, FLAP_EFFECTIVENESS::x_RatioFlapEff_cf07, FLAP_EFFECTIVENESS::y_RatioFlapEff_cf07);
+            detail::addCurve(ratio, 0.8, FLAP_EFFECTIVENESS::x_RatioFlapEff_cf08, FLAP_EFFECTIVENESS::y_RatioFlapEff_cf08);
+            detail::addCurve(ratio, 0.9, FLAP_EFFECTIVENESS::x_RatioFlapEff_cf09, FLAP_EFFECTIVENESS::y_RatioFlapEff_cf09);
+            return ratio;
+        }();
+        return chart;
+    }
+
+    // ============================================================
+    // Fitted charts - lateral
+    // ============================================================
+
+    /// (Cl_beta / CL) due to sweep: x = half-chord sweep [deg], param1 = aspect ratio, param2 = taper ratio
+    inline const Interpolant3D &rollBetaLiftRatioDueToSweep()
+    {
+        static const Interpolant3D chart = []
+        {
+            Interpolant3D ratio(2, RegressionMethod::POLYNOMIAL);
+
+            detail::addCurve(ratio, 1.0, 1.0, LATERAL::x_lambda1_A1, LATERAL::y_lambda1_A1);
+            detail::addCurve(ratio, 1.0, 2.0, LATERAL::x_lambda1_A2, LATERAL::y_lambda1_A2);
+            detail::addCurve(ratio, 1.0, 4.0, LATERAL::x_lambda1_A4, LATERAL::y_lambda1_A4);
+            detail::addCurve(ratio, 1.0, 6.0, LATERAL::x_lambda1_A6, LATERAL::y_lambda1_A6);
+            detail::addCurve(ratio, 1.0, 8.0, LATERAL::x_lambda1_A8, LATERAL::y_lambda1_A8);
+
+            detail::addCurve(ratio, 0.5, 1.0, LATERAL::x_lambda05_A1, LATERAL::y_lambda05_A1);
+            detail::addCurve(ratio, 0.5, 2.0, LATERAL::x_lambda05_A2, LATERAL::y_lambda05_A2);
+            detail::addCurve(ratio, 0.5, 4.0, LATERAL::x_lambda05_A4, LATERAL::y_lambda05_A4);
+            detail::addCurve(ratio, 0.5, 6.0, LATERAL::x_lambda05_A6, LATERAL::y_lambda05_A6);
+            detail::addCurve(ratio, 0.5, 8.0, LATERAL::x_lambda05_A8, LATERAL::y_lambda05_A8);
+
+            detail::addCurve(ratio, 0.0, 1.0, LATERAL::x_lambda0_A1, LATERAL::y_lambda0_A1);
+            detail::addCurve(ratio, 0.0, 1.5, LATERAL::x_lambda0_A1_5, LATERAL::y_lambda0_A1_5);
+            detail::addCurve(ratio, 0.0, 2.0, LATERAL::x_lambda0_A2, LATERAL::y_lambda0_A2);
+            detail::addCurve(ratio, 0.0, 3.0, LATERAL::x_lambda0_A3, LATERAL::y_lambda0_A3);
+            detail::addCurve(ratio, 0.0, 6.0, LATERAL::x_lambda0_A6, LATERAL::y_lambda0_A6);
+            return ratio;
+        }();
+        return chart;
+    }
+
+    /// Compressibility correction to sweep K_M_lambda: x = M cos(sweep), parameter = AR / cos(sweep)
+    inline const Interpolant2D &compressibilityCorrectionToSweepKMLambda()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D kmLambda(3, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(kmLambda, 2.0, LATERAL::x_K_Mach_lambda2, LATERAL::y_K_Mach_lambda2);
+            detail::addCurve(kmLambda, 3.0, LATERAL::x_K_Mach_lambda3, LATERAL::y_K_Mach_lambda3);
+            detail::addCurve(kmLambda, 4.0, LATERAL::x_K_Mach_lambda4, LATERAL::y_K_Mach_lambda4);
+            detail::addCurve(kmLambda, 5.0, LATERAL::x_K_Mach_lambda5, LATERAL::y_K_Mach_lambda5);
+            detail::addCurve(kmLambda, 6.0, LATERAL::x_K_Mach_lambda6, LATERAL::y_K_Mach_lambda6);
+            detail::addCurve(kmLambda, 8.0, LATERAL::x_K_Mach_lambda8, LATERAL::y_K_Mach_lambda8);
+            detail::addCurve(kmLambda, 10.0, LATERAL::x_K_Mach_lambda10, LATERAL::y_K_Mach_lambda10);
+            return kmLambda;
+        }();
+        return chart;
+    }
+
+    /// Fuselage correction factor Kf: x = nose-to-tip quarter chord / span, parameter = AR / cos(sweep)
+    inline const Interpolant2D &fuselageCorrectionFactorKf()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D kf(3, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(kf, 4.0, LATERAL::x_Kf_ratio4, LATERAL::y_Kf_ratio4);
+            detail::addCurve(kf, 4.5, LATERAL::x_Kf_ratio4_5, LATERAL::y_Kf_ratio4_5);
+            detail::addCurve(kf, 5.0, LATERAL::x_Kf_ratio5, LATERAL::y_Kf_ratio5);
+            detail::addCurve(kf, 5.5, LATERAL::x_Kf_ratio5_5, LATERAL::y_Kf_ratio5_5);
+            detail::addCurve(kf, 6.0, LATERAL::x_Kf_ratio6, LATERAL::y_Kf_ratio6);
+            detail::addCurve(kf, 7.0, LATERAL::x_Kf_ratio7, LATERAL::y_Kf_ratio7);
+            detail::addCurve(kf, 8.0, LATERAL::x_Kf_ratio8, LATERAL::y_Kf_ratio8);
+            return kf;
+        }();
+        return chart;
+    }
+
+    /// (Cl_beta / CL) due to aspect ratio: x = aspect ratio, parameter = taper ratio
+    inline const Interpolant2D &rollBetaLiftRatioDueToAspectRatio()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D ratio(5, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(ratio, 0.0, LATERAL::x_ClbetaCL_lambda0, LATERAL::y_ClbetaCL_lambda0);
+            detail::addCurve(ratio, 0.5, LATERAL::x_ClbetaCL_lambda05, LATERAL::y_ClbetaCL_lambda05);
+            detail::addCurve(ratio, 1.0, LATERAL::x_ClbetaCL_lambda1, LATERAL::y_ClbetaCL_lambda1);
+            return ratio;
+        }();
+        return chart;
+    }
+
+    /// (Cl_beta / Gamma) due to dihedral: x = aspect ratio, param1 = |half-chord sweep| [deg], param2 = taper ratio
+    inline const Interpolant3D &rollBetaDihedralRatio()
+    {
+        static const Interpolant3D chart = []
+        {
+            Interpolant3D ratio(3, RegressionMethod::POLYNOMIAL);
+
+            detail::addCurve(ratio, 1.0, 0.0, LATERAL::x_ClbetaGamma_lambda1_sweep0, LATERAL::y_ClbetaGamma_lambda1_sweep0);
+            detail::addCurve(ratio, 1.0, 40.0, LATERAL::x_ClbetaGamma_lambda1_sweep40, LATERAL::y_ClbetaGamma_lambda1_sweep40);
+            detail::addCurve(ratio, 1.0, 60.0, LATERAL::x_ClbetaGamma_lambda1_sweep60, LATERAL::y_ClbetaGamma_lambda1_sweep60);
+
+            detail::addCurve(ratio, 0.5, 0.0, LATERAL::x_ClbetaGamma_lambda05_sweep0, LATERAL::y_ClbetaGamma_lambda05_sweep0);
+            detail::addCurve(ratio, 0.5, 40.0, LATERAL::x_ClbetaGamma_lambda05_sweep40, LATERAL::y_ClbetaGamma_lambda05_sweep40);
+            detail::addCurve(ratio, 0.5, 60.0, LATERAL::x_ClbetaGamma_lambda05_sweep60, LATERAL::y_ClbetaGamma_lambda05_sweep60);
+
+            detail::addCurve(ratio, 0.0, 0.0, LATERAL::x_ClbetaGamma_lambda0_sweep0, LATERAL::y_ClbetaGamma_lambda0_sweep0);
+            detail::addCurve(ratio, 0.0, 40.0, LATERAL::x_ClbetaGamma_lambda0_sweep40, LATERAL::y_ClbetaGamma_lambda0_sweep40);
+            detail::addCurve(ratio, 0.0, 60.0, LATERAL::x_ClbetaGamma_lambda0_sweep60, LATERAL::y_ClbetaGamma_lambda0_sweep60);
+            return ratio;
+        }();
+        return chart;
+    }
+
+    /// Compressibility correction to dihedral K_M_Gamma: x = M cos(sweep), parameter = AR / cos(sweep)
+    inline const Interpolant2D &compressibilityCorrectionToDihedralKM()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D km(2, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(km, 2.0, LATERAL::x_Kmd_ratio2, LATERAL::y_Kmd_ratio2);
+            detail::addCurve(km, 4.0, LATERAL::x_Kmd_ratio4, LATERAL::y_Kmd_ratio4);
+            detail::addCurve(km, 6.0, LATERAL::x_Kmd_ratio6, LATERAL::y_Kmd_ratio6);
+            detail::addCurve(km, 8.0, LATERAL::x_Kmd_ratio8, LATERAL::y_Kmd_ratio8);
+            detail::addCurve(km, 10.0, LATERAL::x_Kmd_ratio10, LATERAL::y_Kmd_ratio10);
+            return km;
+        }();
+        return chart;
+    }
+
+    /// Wing twist correction factor: x = taper ratio, parameter = aspect ratio
+    inline const Interpolant2D &twistCorrectionFactor()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D twist(6, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(twist, 0.0, LATERAL::x_TwistCorr_lambda0, LATERAL::y_TwistCorr_lambda0);
+            detail::addCurve(twist, 0.4, LATERAL::x_TwistCorr_lambda04, LATERAL::y_TwistCorr_lambda04);
+            detail::addCurve(twist, 1.0, LATERAL::x_TwistCorr_lambda1, LATERAL::y_TwistCorr_lambda1);
+            return twist;
+        }();
+        return chart;
+    }
+
+    // ============================================================
+    // Fitted charts - directional
+    // ============================================================
+
+    /// Perkins body factor Kbeta (fuselage and nacelles): parameter = fineness ratio l_f / d_f
+    inline const Interpolant2D &bodySideForceFactorKbeta()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(1, RegressionMethod::POWER);
+            detail::addCurve(fitted, 2.5, DIRECTIONAL::Kbeta_x_2_5, DIRECTIONAL::Kbeta_y_2_5);
+            detail::addCurve(fitted, 3.0, DIRECTIONAL::Kbeta_x_3, DIRECTIONAL::Kbeta_y_3);
+            detail::addCurve(fitted, 4.0, DIRECTIONAL::Kbeta_x_4, DIRECTIONAL::Kbeta_y_4);
+            detail::addCurve(fitted, 5.0, DIRECTIONAL::Kbeta_x_5, DIRECTIONAL::Kbeta_y_5);
+            detail::addCurve(fitted, 6.0, DIRECTIONAL::Kbeta_x_6, DIRECTIONAL::Kbeta_y_6);
+            detail::addCurve(fitted, 7.0, DIRECTIONAL::Kbeta_x_7, DIRECTIONAL::Kbeta_y_7);
+            detail::addCurve(fitted, 8.0, DIRECTIONAL::Kbeta_x_8, DIRECTIONAL::Kbeta_y_8);
+            detail::addCurve(fitted, 10.0, DIRECTIONAL::Kbeta_x_10, DIRECTIONAL::Kbeta_y_10);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Wing-body interference factor Ki vs z_w / d_f, high wing (Roskam Part VI)
+    inline const RegressionModel &wingBodyInterferenceFactorKiHighWing()
+    {
+        static const RegressionModel chart = detail::fitChart(DIRECTIONAL::Ki_x_high_wing, DIRECTIONAL::Ki_y_high_wing,
+                                                              1, RegressionMethod::LINEAR);
+        return chart;
+    }
+
+    /// Wing-body interference factor Ki vs z_w / d_f, low wing (Roskam Part VI)
+    inline const RegressionModel &wingBodyInterferenceFactorKiLowWing()
+    {
+        static const RegressionModel chart = detail::fitChart(DIRECTIONAL::Ki_x_low_wing, DIRECTIONAL::Ki_y_low_wing,
+                                                              1, RegressionMethod::LINEAR);
+        return chart;
+    }
+
+    /// Vertical tail aspect ratio in presence of the fuselage / isolated, taper ratio 1.0: x = b_v / fuselage depth
+    inline const RegressionModel &verticalTailFuselageAspectRatioRatioTaper1()
+    {
+        static const RegressionModel chart = detail::fitChart(DIRECTIONAL::x_lambda1, DIRECTIONAL::y_lambda1,
+                                                              5, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Vertical tail aspect ratio in presence of the fuselage / isolated, taper ratio 0.6: x = b_v / fuselage depth
+    inline const RegressionModel &verticalTailFuselageAspectRatioRatioTaper06()
+    {
+        static const RegressionModel chart = detail::fitChart(DIRECTIONAL::x_lambda06, DIRECTIONAL::y_lambda06,
+                                                              5, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Vertical tail aspect ratio in presence of the fuselage / isolated: x = b_v / fuselage depth, parameter = taper ratio
+    inline const Interpolant2D &verticalTailFuselageAspectRatioRatio()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(5, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(fitted, 1.0, DIRECTIONAL::x_lambda1, DIRECTIONAL::y_lambda1);
+            detail::addCurve(fitted, 0.6, DIRECTIONAL::x_lambda06, DIRECTIONAL::y_lambda06);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Vertical tail aspect ratio in presence of the horizontal tail / isolated: x = z_h / b_v, parameter = x_ac,h / c_r,v
+    inline const Interpolant2D &verticalTailHorizontalAspectRatioRatio()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(3, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(fitted, 0.5, DIRECTIONAL::x_xcv05, DIRECTIONAL::y_xcv05);
+            detail::addCurve(fitted, 0.6, DIRECTIONAL::x_xcv06, DIRECTIONAL::y_xcv06);
+            detail::addCurve(fitted, 0.7, DIRECTIONAL::x_xcv07, DIRECTIONAL::y_xcv07);
+            detail::addCurve(fitted, 0.8, DIRECTIONAL::x_xcv08, DIRECTIONAL::y_xcv08);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Factor Kvh vs horizontal / vertical tail area ratio (Roskam Part VI)
+    inline const RegressionModel &verticalTailFactorKvh()
+    {
+        static const RegressionModel chart = detail::fitChart(DIRECTIONAL::x_Kvh, DIRECTIONAL::y_Kvh,
+                                                              3, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Vertical tail lift slope [1/deg] vs effective aspect ratio
+    inline const RegressionModel &verticalTailLiftSlope()
+    {
+        static const RegressionModel chart = detail::fitChart(DIRECTIONAL::equivalentAspectRatioVerticalTail, DIRECTIONAL::liftSlopeVerticalTail,
+                                                              3, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Side force factor Kv of a single vertical tail vs b_v / fuselage depth
+    inline const RegressionModel &singleVerticalTailFactorKv()
+    {
+        static const RegressionModel chart = detail::fitChart(DIRECTIONAL::Kv, DIRECTIONAL::verticalTailSpanToFuselageDepthInRegionOfVerticalRatio,
+                                                              1, RegressionMethod::LINEAR);
+        return chart;
+    }
+
+    /// Vee tail lift slope factor K (NACA Report 823): x = aspect ratio, parameter = taper ratio
+    inline const Interpolant2D &veeTailLiftSlopeFactorK()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(1, RegressionMethod::LOGARITHMIC);
+            detail::addCurve(fitted, 0.2, DIRECTIONAL::K_factor_x_lambda_025, DIRECTIONAL::K_factor_y_lambda_025);
+            detail::addCurve(fitted, 0.5, DIRECTIONAL::K_factor_x_lambda_05, DIRECTIONAL::K_factor_y_lambda_05);
+            detail::addCurve(fitted, 1.0, DIRECTIONAL::K_factor_x_lambda_1, DIRECTIONAL::K_factor_y_lambda_1);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Twin vertical tails, side force ratio with wing-horizontal-fuselage: x = d_f / b_v, parameter = b_h / l_f
+    inline const Interpolant2D &twinVerticalTailSideForceRatio()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(3, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(fitted, 1.0, DIRECTIONAL::ratio_WHF_x_bh_lf_1, DIRECTIONAL::ratio_WHF_y_bh_lf_1);
+            detail::addCurve(fitted, 0.8, DIRECTIONAL::ratio_WHF_x_bh_lf_08, DIRECTIONAL::ratio_WHF_y_bh_lf_08);
+            detail::addCurve(fitted, 0.6, DIRECTIONAL::ratio_WHF_x_bh_lf_06, DIRECTIONAL::ratio_WHF_y_bh_lf_06);
+            detail::addCurve(fitted, 0.4, DIRECTIONAL::ratio_WHF_x_bh_lf_04, DIRECTIONAL::ratio_WHF_y_bh_lf_04);
+            detail::addCurve(fitted, 0.2, DIRECTIONAL::ratio_WHF_x_bh_lf_02, DIRECTIONAL::ratio_WHF_y_bh_lf_02);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Twin vertical tails, effective dCy/dbeta: x = effective aspect ratio, parameter = leading-edge sweep [deg]
+    inline const Interpolant2D &twinVerticalTailEffectiveSideForceSlope()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(2, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(fitted, 0.0, DIRECTIONAL::effectiveAspectRatioVerticalTwin_0, DIRECTIONAL::sideForceWRTBetaEffective_0);
+            detail::addCurve(fitted, 20.0, DIRECTIONAL::effectiveAspectRaticoVerticalTwin_20, DIRECTIONAL::sideForceWRTBetaEffective_20);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Rudder effectiveness: x = deflection [deg], param1 = rudder chord ratio, param2 = aspect ratio
+    inline const Interpolant3D &rudderEffectiveness()
+    {
+        static const Interpolant3D chart = []
+        {
+            Interpolant3D fitted(5, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(fitted, 1.5, 0.3, DIRECTIONAL::x_rudder_AR1_5_cr_c_0_30, DIRECTIONAL::y_rudder_AR1_5_cr_c_0_30);
+            detail::addCurve(fitted, 1.5, 0.37, DIRECTIONAL::x_rudder_AR1_5_cr_c_0_37, DIRECTIONAL::y_rudder_AR1_5_cr_c_0_37);
+            detail::addCurve(fitted, 1.5, 0.45, DIRECTIONAL::x_rudder_AR1_5_cr_c_0_45, DIRECTIONAL::y_rudder_AR1_5_cr_c_0_45);
+            detail::addCurve(fitted, 2.0, 0.3, DIRECTIONAL::x_rudder_AR2_0_cr_c_0_30, DIRECTIONAL::y_rudder_AR2_0_cr_c_0_30);
+            detail::addCurve(fitted, 2.0, 0.37, DIRECTIONAL::x_rudder_AR2_0_cr_c_0_37, DIRECTIONAL::y_rudder_AR2_0_cr_c_0_37);
+            detail::addCurve(fitted, 2.0, 0.45, DIRECTIONAL::x_rudder_AR2_0_cr_c_0_45, DIRECTIONAL::y_rudder_AR2_0_cr_c_0_45);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Delta Cn_beta due to the vertical tail surface vs wing position / maximum fuselage diameter
+    inline const RegressionModel &wingPositionDeltaCnBeta()
+    {
+        static const RegressionModel chart = detail::fitChart(DIRECTIONAL::wingToMaximumFuselageDiameterRatio, DIRECTIONAL::deltaCnBetaDueToVerticalTailSurface,
+                                                              2, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    // ============================================================
+    // Fitted charts - propeller
+    // ============================================================
+
+    /// Blockage factor vs advance ratio J, scoop inlet
+    inline const RegressionModel &scoopInletBlockageFactor()
+    {
+        static const RegressionModel chart = detail::fitChart(PROPELLER::scoop_J, PROPELLER::scoop_BF,
+                                                              3, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Blockage factor vs advance ratio J, annular inlet
+    inline const RegressionModel &annularInletBlockageFactor()
+    {
+        static const RegressionModel chart = detail::fitChart(PROPELLER::annular_J, PROPELLER::annular_BF,
+                                                              3, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Delta Mach due to blade camber vs integrated design lift coefficient
+    inline const RegressionModel &bladeCamberDeltaMach()
+    {
+        static const RegressionModel chart = detail::fitChart(PROPELLER::integratedLiftCoeffcientValues, PROPELLER::deltaMachValues,
+                                                              2, RegressionMethod::POLYNOMIAL);
+        return chart;
+    }
+
+    /// Propeller compressibility factor: x = advance ratio J, parameter = effective Mach number
+    inline const Interpolant2D &propellerCompressibilityFactor()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D compressibility(3, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(compressibility, 0.3, PROPELLER::mach03_x, PROPELLER::compressibilityFactorAtMach03);
+            detail::addCurve(compressibility, 0.4, PROPELLER::mach04_x, PROPELLER::compressibilityFactorAtMach04);
+            detail::addCurve(compressibility, 0.5, PROPELLER::mach05_x, PROPELLER::compressibilityFactorAtMach05);
+            detail::addCurve(compressibility, 0.6, PROPELLER::mach06_x, PROPELLER::compressibilityFactorAtMach06);
+            detail::addCurve(compressibility, 0.7, PROPELLER::mach07_x, PROPELLER::compressibilityFactorAtMach07);
+            return compressibility;
+        }();
+        return chart;
+    }
+
+    // ============================================================
+    // Fitted charts - flap parasite drag
+    // ============================================================
+
+    /// Delta_1 of the flap CD0 increment, slotted flap: x = flap chord ratio cf/c, parameter = t/c
+    inline const Interpolant2D &slottedFlapChordRatioDragFactor()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(4, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(fitted, 0.12, CD0_FLAP::x_delta1_slotted_tc012, CD0_FLAP::y_delta1_slotted_tc012);
+            detail::addCurve(fitted, 0.21, CD0_FLAP::x_delta1_slotted_tc021, CD0_FLAP::y_delta1_slotted_tc021);
+            // t/c = 0.30 non digitalizzata: si ripete la curva a 0.21
+            detail::addCurve(fitted, 0.30, CD0_FLAP::x_delta1_slotted_tc021, CD0_FLAP::y_delta1_slotted_tc021);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Delta_2 of the flap CD0 increment, slotted flap: x = deflection [deg], parameter = t/c
+    inline const Interpolant2D &slottedFlapDeflectionDragFactor()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(6, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(fitted, 0.12, CD0_FLAP::x_delta2_slotted_tc012, CD0_FLAP::y_delta2_slotted_tc012);
+            detail::addCurve(fitted, 0.21, CD0_FLAP::x_delta2_slotted_tc021, CD0_FLAP::y_delta2_slotted_tc021);
+            detail::addCurve(fitted, 0.30, CD0_FLAP::x_delta2_slotted_tc030, CD0_FLAP::y_delta2_slotted_tc030);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Delta_1 of the flap CD0 increment, plain and split flaps: x = flap chord ratio cf/c, parameter = t/c
+    inline const Interpolant2D &plainFlapChordRatioDragFactor()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(4, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(fitted, 0.12, CD0_FLAP::x_delta1_plain_tc012, CD0_FLAP::y_delta1_plain_tc012);
+            detail::addCurve(fitted, 0.21, CD0_FLAP::x_delta1_plain_tc021, CD0_FLAP::y_delta1_plain_tc021);
+            detail::addCurve(fitted, 0.30, CD0_FLAP::x_delta1_plain_tc030, CD0_FLAP::y_delta1_plain_tc030);
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Delta_2 of the flap CD0 increment, plain flap: x = deflection [deg], parameter = t/c
+    inline const Interpolant2D &plainFlapDeflectionDragFactor()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(3, RegressionMethod::POLYNOMIAL);
+            // The t/c curves share the same x grid: one QR factorization for all of them
+            const std::vector<double> y = detail::toVector(CD0_FLAP::y_delta2_plain_all_tc);
+            fitted.addCurves({0.12, 0.21, 0.30}, detail::toVector(CD0_FLAP::x_delta2_plain_all_tc), {y, y, y});
+            return fitted;
+        }();
+        return chart;
+    }
+
+    /// Delta_2 of the flap CD0 increment, split flap: x = deflection [deg], parameter = t/c
+    inline const Interpolant2D &splitFlapDeflectionDragFactor()
+    {
+        static const Interpolant2D chart = []
+        {
+            Interpolant2D fitted(3, RegressionMethod::POLYNOMIAL);
+            detail::addCurve(fitted, 0.12, CD0_FLAP::x_delta2_split_tc012, CD0_FLAP::y_delta2_split_tc012);
+            detail::addCurve(fitted, 0.21, CD0_FLAP::x_delta2_split_tc021, CD0_FLAP::y_delta2_split_tc021);
+            detail::addCurve(fitted, 0.30, CD0_FLAP::x_delta2_split_tc030, CD0_FLAP::y_delta2_split_tc030);
+            return fitted;
+        }();
+        return chart;
+    }
+
+} // namespace DIGITIZED_CHARTS
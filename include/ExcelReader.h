@@ -19,6 +19,7 @@
 #include "ConvAngle.h"
 #include "ConvArea.h"
 #include "AircraftData.h"
+#include "AircraftDataCache.h"
 #include "Interpolant.h"
 
 /// @brief Constructs an ExcelReader object and opens the specified Excel file.
@@ -48,6 +49,20 @@ private:
     std::string unitToPassX = "";     // Unità di misura da convertire per X o unità di misura finale di X.
     std::string unitToPassY = "";     // Unità di misura da convertire per Y o unità di misura finale di Y.
     std::string flagChart = "";      // Flag per abilitare il grafico della regressione.
+    bool useCache = true;            // Abilita la cache binaria di readAllAircraftData.
+
+    /**
+     * @brief Returns the workbook, opening the Excel file on first use.
+     * @return Workbook of the opened document.
+     */
+    OpenXLSX::XLWorkbook openWorkbook() // Apre il file solo quando serve davvero (non su cache hit).
+    {
+        if (!workbook.isOpen())
+        {
+            workbook.open(filePath);
+        }
+        return workbook.workbook();
+    }
 
     /**
      * @brief Counts populated rows starting from the configured start row.
@@ -55,7 +70,7 @@ private:
      */
     int getLengthOfRow() // Conta quante righe sono popolate a partire da startRow.
     {
-        worksheet = workbook.workbook().worksheet(sheetName); // Aggiorna il worksheet in base al nome impostato.
+        worksheet = openWorkbook().worksheet(sheetName); // Aggiorna il worksheet in base al nome impostato.
         bool checkFlag = true;                                // Flag di controllo per il while.
         endRow = 0;                                           // Si parte assumendo almeno una riga di dati.
 
@@ -90,7 +105,7 @@ private:
         // Svuota il vettore per evitare duplicati se chiamato più volte
         units.clear();
         
-        worksheet = workbook.workbook().worksheet("INFO");
+        worksheet = openWorkbook().worksheet("INFO");
 
         for (int col = 22; col <= 27; col++)
         {
@@ -121,7 +136,7 @@ private:
         double indexX = startRow;
 
         std::vector<std::string> detectedUnits = getUnitOfAllData();
-        worksheet = workbook.workbook().worksheet(sheetName);
+        worksheet = openWorkbook().worksheet(sheetName);
         unitToPassX = worksheet.cell(OpenXLSX::XLCellReference(8, startColMethod)).value().get<std::string>();
 
         for (size_t i = 0; i < vectorXlength; i++)
@@ -281,7 +296,7 @@ private:
         double indexY = startRow;
 
         std::vector<std::string> detectedUnits = getUnitOfAllData();
-        worksheet = workbook.workbook().worksheet(sheetName);
+        worksheet = openWorkbook().worksheet(sheetName);
         unitToPassY = worksheet.cell(OpenXLSX::XLCellReference(10, startColMethod)).value().get<std::string>();
 
         for (size_t i = 0; i < vectorYlength; i++)
@@ -520,7 +535,7 @@ private:
             return 0;
         }
         
-        worksheet = workbook.workbook().worksheet(sheetName);
+        worksheet = openWorkbook().worksheet(sheetName);
         cell = worksheet.cell(OpenXLSX::XLCellReference(4, startColMethod));
         degreeOfPolynomial = cell.value().get<double>();
 
@@ -542,7 +557,7 @@ private:
             return "";
         }
 
-        worksheet = workbook.workbook().worksheet(sheetName);
+        worksheet = openWorkbook().worksheet(sheetName);
         flagChart = worksheet.cell(OpenXLSX::XLCellReference(6, startColMethod)).value().get<std::string>();
 
         return flagChart;
@@ -555,7 +570,7 @@ private:
      */
      int countVariables(const std::string& sheetName)
     {
-        worksheet = workbook.workbook().worksheet(sheetName);
+        worksheet = openWorkbook().worksheet(sheetName);
         
         int count = 0;
         const int MAX_COLUMNS = 300;  // Safety: max 100 variabili (300 colonne)
@@ -587,7 +602,7 @@ public:
         auto baseDir = std::filesystem::current_path() / folderName; // auto deduce std::filesystem::path, ottenendo il path della cartella base.
         auto fullPath = baseDir / excelFileName;                     // auto deduce std::filesystem::path, completando il percorso con il file.
         this->filePath = fullPath.string();                          // Salva il percorso definitivo come std::string per OpenXLSX.
-        this->workbook.open(this->filePath);                         // Carica il workbook dal percorso calcolato.
+                                                                     // Il workbook viene aperto al primo accesso (openWorkbook).
     }
 
     /// @brief Set the sheet name and data range to read from the Excel file.
@@ -707,17 +722,16 @@ public:
         var.xUnit = unitsVec[0];
         var.yUnit = unitsVec[1];
         
+        var.chartFlag = getFlagToEnableChartFromExcel();
         var.method = getMethodOfRegressionFromExcel();
         var.polynomialDegree = getDegreeOfPolynomialFromExcel();
         
         var.xData = getXDataFromExcel();
         var.yData = getYDataFromExcel();
         
-        // Calcola coefficienti
-        if (var.method != RegressionMethod::CONSTANT && var.isValid()) {
-            Interpolant interp(var.xData, var.yData, 
-                              var.polynomialDegree, var.method);
-            var.coefficients = interp.getCoefficients();
+        // Calcola una sola volta coefficienti e modello della regressione
+        if (var.isValid()) {
+            var.fit();
         }
         
         return var;
@@ -773,7 +787,7 @@ public:
                     yDetectedUnits.push_back(var.yUnit);
 
                     // Genera il grafico della regressione se richiesto
-                    component.getChartOfVariableRegression(var.varName, getFlagToEnableChartFromExcel(), aircraftName);
+                    component.getChartOfVariableRegression(var.varName, var.chartFlag, aircraftName);
                 }
                 else
                 {
@@ -845,12 +859,42 @@ public:
 
         return component;
     }
+    /// @brief Enables or disables the binary cache used by readAllAircraftData.
+    /// @param enable True to load/store "<workbook>.cache" (default), false to always read the workbook.
+    void setUseCache(bool enable)
+    {
+        useCache = enable;
+    }
+
     /// @brief Reads all aircraft data from the Excel sheets.
+    /// @details When the cache is enabled and "<workbook>.cache" matches the current workbook
+    ///          (same size, content hash and fitting code), the data and fitted coefficients are
+    ///          loaded from it and the workbook is never opened. The regression charts requested by
+    ///          the chart flag of each variable are generated in both cases.
     /// @param aircraftName Name of the aircraft.
     /// @return An AircraftData object populated with data from all relevant Excel sheets.
     AERO::AircraftData readAllAircraftData(const std::string& aircraftName)
     {
         AERO::AircraftData aircraft;
+
+        // Se il workbook non è cambiato dall'ultima lettura, carica dati e coefficienti dalla cache
+        if (useCache && AERO::CACHE::load(filePath, aircraft))
+        {
+            aircraft.setAircraftName(aircraftName);
+            std::cout << "Loaded aircraft data from cache: " << AERO::CACHE::cachePathFor(filePath) << std::endl;
+
+            // Stessi grafici della lettura dal workbook, con il flag salvato per ogni variabile
+            for (const AERO::ComponentData* component : {&aircraft.fuselage, &aircraft.wing, &aircraft.horizontal,
+                                                         &aircraft.vertical, &aircraft.undercarriage, &aircraft.engine})
+            {
+                for (const auto& [varName, var] : component->variables)
+                {
+                    component->getChartOfVariableRegression(varName, var.chartFlag, aircraftName);
+                }
+            }
+            return aircraft;
+        }
+
         aircraft.setAircraftName(aircraftName);
         
         aircraft.fuselage = readComponent("FUSELAGE", aircraftName);
@@ -860,6 +904,17 @@ public:
         aircraft.undercarriage = readComponent("UNDERCARRIAGE", aircraftName);
         aircraft.engine = readComponent("ENGINES", aircraftName);
         
+        if (useCache)
+        {
+            try
+            {
+                AERO::CACHE::save(filePath, aircraft);
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "[WARNING] Aircraft data cache not written: " << e.what() << std::endl;
+            }
+        }
        
         return aircraft;
     }
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+// 64-bit FNV-1a: chiave di contenuto per le cache su disco
+// (AircraftDataCache, GeometryCache, VSPAeroScheduler).
+// Ogni funzione continua l'hash ricevuto, così più sorgenti si concatenano in una chiave.
+
+namespace FNV1A {
+
+constexpr std::uint64_t offsetBasis = 14695981039346656037ull;
+constexpr std::uint64_t prime = 1099511628211ull;
+
+/**
+ * @brief Continues a hash over a byte range.
+ * @param data Pointer to the bytes.
+ * @param size Number of bytes.
+ * @param hash Hash to continue (offsetBasis for a new one).
+ * @return Hash value.
+ */
+inline std::uint64_t hashBytes(const void* data, std::size_t size, std::uint64_t hash = offsetBasis)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= prime;
+    }
+    return hash;
+}
+
+/**
+ * @brief Continues a hash over the characters of a string.
+ */
+inline std::uint64_t hashString(const std::string& text, std::uint64_t hash = offsetBasis)
+{
+    return hashBytes(text.data(), text.size(), hash);
+}
+
+/**
+ * @brief Continues a hash over the content of a file, read in 64 KiB blocks.
+ * @param path Path of the file.
+ * @param hash In/out: hash to continue (offsetBasis for a new one).
+ * @return false if the file cannot be read.
+ */
+inline bool hashFile(const std::string& path, std::uint64_t& hash)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    std::array<char, 65536> buffer;
+    while (in)
+    {
+        in.read(buffer.data(), buffer.size());
+        hash = hashBytes(buffer.data(), static_cast<std::size_t>(in.gcount()), hash);
+    }
+    return in.eof();
+}
+
+} // namespace FNV1A
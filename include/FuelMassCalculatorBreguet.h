@@ -29,6 +29,7 @@
 #include "ConvArea.h"
 #include "ConvVel.h"
 #include "ATMOSISA.h"
+#include "ISATable.h"
 #include "ODE45.h"
 #include "PLOT.h"
 
@@ -42,7 +43,13 @@ private:
     double availableThrust = 0.0;
     double averageSpeedKmh = 0.0;
     double densityRatio = 0.0;
-    double integrationStep = 1.0 / 99.0;
+    // dW/dx costante: bastano pochi passi adattivi; si tengono tutti (ALL_STEPS) per i grafici del peso
+    ODE45Options integrationOptions = []
+    {
+        ODE45Options options;
+        options.mode = ODE45Mode::ADAPTIVE_DOPRI5;
+        return options;
+    }();
     double weightFuelTaxiTakeOff = 0.0;
     double weightFuelClimb = 0.0;
     double designFuelMass = 0.0;
@@ -103,7 +110,7 @@ public:
 
             weightFuelClimb = weightAfterTaxiTakeOff * (1 - ratioWeightTakeOffClimbPropeller);
 
-            densityRatio = Atmosphere::ISA::densityRatio(altitude);
+            densityRatio = Atmosphere::ISATable::standard().densityRatio(altitude);
 
             availablePower = numberOfEngines * BSHP * densityRatio * throttle * etaP;
 
@@ -116,7 +123,7 @@ public:
                               0,
                               range,
                               weightAfterClimb,
-                              integrationStep);
+                              integrationOptions);
 
             // Get solution arrays (angle of attack and downwash angle)
             odeSolver45.getT();
@@ -180,7 +187,7 @@ public:
                               0,
                               range,
                               weightAfterClimb,
-                              integrationStep);
+                              integrationOptions);
 
             // Get solution arrays (angle of attack and downwash angle)
             odeSolver45.getT();
@@ -212,7 +219,7 @@ public:
 
             MTOM = massConverter.getConvertedValues();
 
-            densityRatio = Atmosphere::ISA::densityRatio(altitude);
+            densityRatio = Atmosphere::ISATable::standard().densityRatio(altitude);
 
             ConvVel velocityConvertertoKmh(Speed::M_TO_S, Speed::KM_TO_H, averageSpeed);
 
@@ -242,7 +249,7 @@ public:
                               0,
                               range,
                               weightAfterClimb,
-                              integrationStep);
+                              integrationOptions);
 
             // Get solution arrays (angle of attack and downwash angle)
             odeSolver45.getT();
@@ -285,7 +292,7 @@ public:
 
         {
 
-            densityRatio = Atmosphere::ISA::densityRatio(altitude);
+            densityRatio = Atmosphere::ISATable::standard().densityRatio(altitude);
 
             ConvLength lengthConverter(Length::M, Length::FT, altitude);
 
@@ -329,7 +336,7 @@ public:
                               0,
                               range,
                               weightAfterClimb,
-                              integrationStep);
+                              integrationOptions);
 
             // Get solution arrays (angle of attack and downwash angle)
             odeSolver45.getT();
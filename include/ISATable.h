@@ -0,0 +1,290 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "ATMOSISA.h"
+
+namespace Atmosphere {
+
+/**
+ * @brief Precomputed ISA lookup table for hot loops
+ *
+ * Tabulates temperature, speed of sound, pressure, density and dynamic
+ * viscosity on a uniform geometric-altitude grid, together with their exact
+ * altitude derivatives. A query is a direct index computation plus a linear
+ * or cubic Hermite interpolation: no std::pow, std::exp or layer search.
+ *
+ * Intervals containing a layer boundary (where the temperature gradient is
+ * discontinuous) are flagged at construction and answered with the exact
+ * model, so the interpolation never straddles a kink.
+ *
+ * Off-standard days are supported with a temperature offset deltaT: the
+ * pressure is the ISA pressure of the altitude, the temperature is
+ * T_ISA + deltaT and the other properties follow from them.
+ *
+ * Maximum relative error versus ISA::calculate over -5000 m to 86000 m
+ * (worst property, measured on every interval at 1/4, 1/2 and 3/4 of the step):
+ * - CUBIC,  step 100 m : 3e-10
+ * - CUBIC,  step 500 m : 2e-7
+ * - LINEAR, step 100 m : 4e-5
+ * - LINEAR, step 10 m  : 4e-7
+ * maxRelativeError() measures the actual value of a given table.
+ *
+ * Example:
+ * @code
+ * const ISATable& isa = ISATable::standard();
+ * double rho = isa.density(altitude);
+ *
+ * ISATable hotDay(15.0);   // ISA + 15 K
+ * double a = hotDay.speedOfSound(altitude);
+ * @endcode
+ */
+class ISATable {
+public:
+    enum class Interpolation {
+        LINEAR,     // Piecewise linear between the nodes
+        CUBIC       // Cubic Hermite with the exact nodal derivatives
+    };
+
+    /**
+     * @brief Builds the table
+     * @param deltaT Temperature offset from ISA [K]
+     * @param step Grid spacing [m]
+     * @param interpolation Interpolation scheme
+     * @param hMin Lowest tabulated geometric altitude [m] (>= -5000)
+     * @param hMax Highest tabulated geometric altitude [m] (<= 86000)
+     * @throws std::invalid_argument if the grid is not valid
+     */
+    explicit ISATable(double deltaT = 0.0,
+                      double step = 100.0,
+                      Interpolation interpolation = Interpolation::CUBIC,
+                      double hMin = -5000.0,
+                      double hMax = 86000.0)
+        : deltaT(deltaT), interpolation(interpolation), hMin(hMin), hMax(hMax)
+    {
+        if (!(step > 0.0) || !(hMax > hMin) || hMin < -5000.0 || hMax > 86000.0) {
+            throw std::invalid_argument("ISATable: invalid altitude grid");
+        }
+        if (!(ISA::T0 + deltaT > 100.0)) {
+            throw std::invalid_argument("ISATable: temperature offset too low");
+        }
+
+        intervals = static_cast<size_t>(std::ceil((hMax - hMin) / step - 1e-9));
+        this->step = (hMax - hMin) / static_cast<double>(intervals);
+        invStep = 1.0 / this->step;
+
+        const size_t nodes = intervals + 1;
+        for (auto& column : table) {
+            column.resize(2 * nodes);
+        }
+        for (size_t k = 0; k < nodes; ++k) {
+            const double h = (k == intervals) ? hMax : hMin + static_cast<double>(k) * this->step;
+            std::array<double, PROPERTIES> value, slope;
+            exactWithDerivatives(h, value, slope);
+            for (size_t p = 0; p < PROPERTIES; ++p) {
+                table[p][2 * k] = value[p];
+                table[p][2 * k + 1] = slope[p] * this->step;   // Derivata rispetto alla coordinata locale s
+            }
+        }
+
+        // Intervalli che contengono un cambio di strato: risposta esatta.
+        // Anche il livello del mare (strato 1): le pressioni di base di ISA sono
+        // arrotondate e la pressione ha un piccolo salto in corrispondenza della base
+        exact.assign(intervals, false);
+        for (size_t layer = 1; layer < ISA::H_base.size(); ++layer) {
+            const double H = ISA::H_base[layer];
+            const double h = ISA::R_earth * H / (ISA::R_earth - H);   // Geopotenziale -> geometrica
+            if (h > hMin && h < hMax) {
+                const size_t k = std::min(static_cast<size_t>((h - hMin) * invStep), intervals - 1);
+                exact[k] = true;
+                // Confine esattamente su un nodo: anche l'intervallo precedente ha il gomito
+                if (k > 0 && std::abs(h - node(k)) < 1e-9 * this->step) {
+                    exact[k - 1] = true;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Shared standard-day table (ISA, 100 m cubic), built on first use
+     */
+    static const ISATable& standard() {
+        static const ISATable instance;
+        return instance;
+    }
+
+    /// Temperature [K]
+    double temperature(double h) const { return lookup(TEMPERATURE, h); }
+
+    /// Speed of sound [m/s]
+    double speedOfSound(double h) const { return lookup(SPEED_OF_SOUND, h); }
+
+    /// Pressure [Pa]
+    double pressure(double h) const { return lookup(PRESSURE, h); }
+
+    /// Density [kg/m³]
+    double density(double h) const { return lookup(DENSITY, h); }
+
+    /// Dynamic viscosity [Pa·s]
+    double viscosity(double h) const { return lookup(VISCOSITY, h); }
+
+    /// Kinematic viscosity [m²/s]
+    double kinematicViscosity(double h) const { return lookup(VISCOSITY, h) / lookup(DENSITY, h); }
+
+    /// Pressure ratio P/P0 [-]
+    double pressureRatio(double h) const { return lookup(PRESSURE, h) / ISA::P0; }
+
+    /// Density ratio rho/rho0 [-] (rho0 of the standard sea level)
+    double densityRatio(double h) const { return lookup(DENSITY, h) / ISA::rho0; }
+
+    /**
+     * @brief Complete atmospheric properties at given altitude
+     * @param h Geometric altitude [m]
+     * @return ISA::Properties Interpolated data
+     * @throws std::out_of_range if the altitude is outside the table
+     */
+    ISA::Properties calculate(double h) const {
+        const double T = temperature(h);
+        const double P = pressure(h);
+        const double rho = density(h);
+        const double mu = viscosity(h);
+        return {T, speedOfSound(h), P, rho, mu, mu / rho, P / ISA::P0, T / ISA::T0, rho / ISA::rho0};
+    }
+
+    /**
+     * @brief Batch lookup writing the requested properties into separate arrays
+     * @param h Geometric altitudes [m]
+     * @param n Number of altitudes
+     * @param out Output arrays (see ISA::BatchOutput); null pointers are skipped
+     * @throws std::out_of_range if any altitude is outside the table
+     */
+    void calculate(const double* h, size_t n, const ISA::BatchOutput& out) const {
+        for (size_t i = 0; i < n; ++i) {
+            const double T = (out.T || out.theta) ? temperature(h[i]) : 0.0;
+            const double P = (out.P || out.delta) ? pressure(h[i]) : 0.0;
+            const double rho = (out.rho || out.sigma || out.nu) ? density(h[i]) : 0.0;
+            const double mu = (out.mu || out.nu) ? viscosity(h[i]) : 0.0;
+            if (out.T)     out.T[i]     = T;
+            if (out.theta) out.theta[i] = T / ISA::T0;
+            if (out.a)     out.a[i]     = speedOfSound(h[i]);
+            if (out.P)     out.P[i]     = P;
+            if (out.delta) out.delta[i] = P / ISA::P0;
+            if (out.rho)   out.rho[i]   = rho;
+            if (out.sigma) out.sigma[i] = rho / ISA::rho0;
+            if (out.mu)    out.mu[i]    = mu;
+            if (out.nu)    out.nu[i]    = mu / rho;
+        }
+    }
+
+    /**
+     * @brief Measures the maximum relative error versus the exact model
+     *
+     * Every interval is checked at 1/4, 1/2 and 3/4 of the step, for all the
+     * tabulated properties.
+     *
+     * @return double Maximum relative error
+     */
+    double maxRelativeError() const {
+        double maxError = 0.0;
+        std::array<double, PROPERTIES> value, slope;
+        for (size_t k = 0; k < intervals; ++k) {
+            for (double s : {0.25, 0.5, 0.75}) {
+                const double h = node(k) + s * step;
+                exactWithDerivatives(h, value, slope);
+                for (size_t p = 0; p < PROPERTIES; ++p) {
+                    const double approx = lookup(static_cast<Property>(p), h);
+                    maxError = std::max(maxError, std::abs(approx - value[p]) / std::abs(value[p]));
+                }
+            }
+        }
+        return maxError;
+    }
+
+    // Getters
+    double getDeltaT() const { return deltaT; }
+    double getStep() const { return step; }
+    double getMinAltitude() const { return hMin; }
+    double getMaxAltitude() const { return hMax; }
+    Interpolation getInterpolation() const { return interpolation; }
+
+private:
+    enum Property { TEMPERATURE, SPEED_OF_SOUND, PRESSURE, DENSITY, VISCOSITY, PROPERTIES };
+
+    double deltaT = 0.0;
+    Interpolation interpolation = Interpolation::CUBIC;
+    double hMin = -5000.0;
+    double hMax = 86000.0;
+    double step = 100.0;
+    double invStep = 0.01;
+    size_t intervals = 0;
+
+    // Per ogni proprietà: (valore, derivata * step) a ogni nodo, interlacciati
+    std::array<std::vector<double>, PROPERTIES> table;
+    std::vector<bool> exact;   // Intervalli con cambio di strato
+
+    double node(size_t k) const { return hMin + static_cast<double>(k) * step; }
+
+    /**
+     * @brief Exact properties and their derivatives with respect to the geometric altitude
+     */
+    void exactWithDerivatives(double h, std::array<double, PROPERTIES>& value,
+                              std::array<double, PROPERTIES>& slope) const {
+        const ISA::Properties isa = ISA::calculate(h);
+        const double T = isa.T + deltaT;
+        const double P = isa.P;
+        const double rho = P / (ISA::R * T);
+        const double a = std::sqrt(ISA::gamma * ISA::R * T);
+        const double mu = ISA::C1 * std::pow(T, 1.5) / (T + ISA::S);
+
+        // dH/dh per la quota geopotenziale; gradiente termico dello strato da ISA
+        const double ratio = ISA::R_earth / (ISA::R_earth + h);
+        const double dHdh = ratio * ratio;
+        const double H = ISA::R_earth * h / (ISA::R_earth + h);
+        const double dTdH = -ISA::lapse_rate[ISA::getLayer(H)];
+
+        const double dT = dTdH * dHdh;
+        const double dP = -isa.rho * ISA::g0 * dHdh;   // Equilibrio idrostatico sulla pressione ISA
+
+        value = {T, a, P, rho, mu};
+        slope = {dT,
+                 0.5 * a * dT / T,
+                 dP,
+                 rho * (dP / P - dT / T),
+                 mu * (1.5 / T - 1.0 / (T + ISA::S)) * dT};
+    }
+
+    /**
+     * @brief Interpolated value of one property
+     */
+    double lookup(Property p, double h) const {
+        if (!(h >= hMin && h <= hMax)) {
+            throw std::out_of_range("ISATable: altitude outside the tabulated range");
+        }
+
+        const double u = (h - hMin) * invStep;
+        const size_t k = std::min(static_cast<size_t>(u), intervals - 1);
+        const double s = u - static_cast<double>(k);
+
+        if (exact[k]) {
+            std::array<double, PROPERTIES> value, slope;
+            exactWithDerivatives(h, value, slope);
+            return value[p];
+        }
+
+        const double* c = table[p].data() + 2 * k;   // y0, d0, y1, d1
+        const double dy = c[2] - c[0];
+        if (interpolation == Interpolation::LINEAR) {
+            return c[0] + s * dy;
+        }
+        // Hermite cubico in forma di Horner sulla coordinata locale s in [0, 1]
+        const double c2 = 3.0 * dy - 2.0 * c[1] - c[3];
+        const double c3 = c[1] + c[3] - 2.0 * dy;
+        return c[0] + s * (c[1] + s * (c2 + s * c3));
+    }
+};
+
+} // namespace Atmosphere
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <numbers>
 #include "RegressionMethod.h" // Inclusione dell'enum RegressionMethod che è una enumerazione dei metodi di regressione disponibili
+#include "RegressionModel.h"
 #include <Eigen/Dense>
 #include "gnuplot-iostream.h"
 #include <utility>
@@ -15,6 +16,7 @@
 #include <cctype>
 #include <filesystem>
 #include <ctime>
+#include <stdexcept>
 
 /// =========================== Constructor ==============================
 /**
@@ -40,7 +42,9 @@ private:
     std::vector<double> yValues;
     int Degree;
     RegressionMethod Method;                  // Metodo di regressione scelto
-    std::vector<double> polyCoeff;            // Coefficienti del polinomio per la regressione polinomiale
+    std::vector<double> polyCoeff;            // Coefficienti del polinomio nella variabile scalata z
+    double polyCenter = 0.0;                  // Centro delle ascisse: z = (x - polyCenter) / polyScale
+    double polyScale = 1.0;                   // Semiampiezza delle ascisse
     double valueOfX;                          // Query point dobe valutare l'output della regressione
     double ALinear;                           // Alinear slope della regressione lineare
     double BLinear;                           // BLinear intercetta della regressione lineare
@@ -94,47 +98,10 @@ private:
     // Metodo privato per la regressione polinomiale
     void polynomialRegression()
     {
-
-        using namespace Eigen;
-
-        int m = xValues.size();
-        int n = Degree;
-
-        if (n <= 1)
-        {
-
-            throw std::runtime_error("Degree must be greater than 1 for polynomial regression");
-        }
-
-        if (m < n + 1)
-        {
-            throw std::runtime_error("Not enough points for polynomial regression");
-        }
-
-        // --- Costruzione Vandermonde come fa MATLAB---
-        MatrixXd V(m, n + 1); // MatrixXd deriva da Eigen ed è una matrice di double a dimensione dinamica
-
-        for (int i = 0; i < m; ++i)
-        {
-            double xi = xValues[i];
-            for (int j = 0; j <= n; ++j)
-            {
-                V(i, j) = std::pow(xi, n - j);
-            }
-        }
-
-        // --- y vector ---
-        VectorXd Y(m); // VectorXd deriva da Eigen ed è un vettore di double a dimensione dinamica
-        for (int i = 0; i < m; ++i)
-            Y(i) = yValues[i];
-
-        // --- Least squares: V \ y (QR pivotato, come MATLAB) ---
-        VectorXd p = V.colPivHouseholderQr().solve(Y);
-
-        // --- Salva coefficienti ---
-        polyCoeff.resize(n + 1);
-        for (int i = 0; i <= n; ++i)
-            polyCoeff[i] = p(i);
+        RegressionModel model = polynomialFit(xValues, std::vector<std::vector<double>>{yValues}, Degree).front();
+        polyCoeff = std::move(model.coefficients);
+        polyCenter = model.center;
+        polyScale = model.scale;
     }
 
     // Metodo privato per la regressione esponenziale
@@ -308,6 +275,95 @@ public:
 
     // ========================== Public API =================================
 
+    /**
+     * @brief Least-squares polynomial fit of several curves sharing the same abscissae.
+     *
+     * The abscissae are mapped to z = (x - c) / s in [-1, 1], where the monomial
+     * Vandermonde matrix is well conditioned even for degree 5-6. The matrix is
+     * built with running products (no std::pow), factorized once with a pivoted
+     * Householder QR (as MATLAB polyfit) and solved for all y columns in a single
+     * call. The coefficients are kept in z together with center and scale, and
+     * the models evaluate Horner in z: expanding them back to x-monomials would
+     * reintroduce the cancellation the scaling avoids.
+     *
+     * @param x Abscissae shared by all curves.
+     * @param yColumns One vector of ordinates per curve, each of size x.size().
+     * @param degree Polynomial degree (> 1).
+     * @return One POLYNOMIAL model [q_n, ..., q_0] in z per curve, all with the same center and scale.
+     *
+     * @throw std::runtime_error If the degree is <= 1 or there are not enough points.
+     * @throw std::invalid_argument If a y column does not match x in size.
+     */
+    static std::vector<RegressionModel> polynomialFit(const std::vector<double>& x,
+                                                      const std::vector<std::vector<double>>& yColumns,
+                                                      int degree)
+    {
+        using namespace Eigen;
+
+        const int m = static_cast<int>(x.size());
+        const int n = degree;
+        const int k = static_cast<int>(yColumns.size());
+
+        if (n <= 1)
+        {
+            throw std::runtime_error("Degree must be greater than 1 for polynomial regression");
+        }
+
+        if (m < n + 1)
+        {
+            throw std::runtime_error("Not enough points for polynomial regression");
+        }
+
+        // --- Centratura e scalatura delle ascisse in [-1, 1] ---
+        const auto [xMin, xMax] = std::minmax_element(x.begin(), x.end());
+        const double center = 0.5 * (*xMax + *xMin);
+        const double scale = (*xMax > *xMin) ? 0.5 * (*xMax - *xMin) : 1.0;
+
+        // --- Vandermonde nella variabile scalata, colonne [z^n ... z^0] ---
+        MatrixXd V(m, n + 1);
+        for (int i = 0; i < m; ++i)
+        {
+            const double z = (x[i] - center) / scale;
+            double power = 1.0;
+            for (int j = n; j >= 0; --j)
+            {
+                V(i, j) = power;
+                power *= z;
+            }
+        }
+
+        // --- Matrice dei termini noti, una colonna per curva ---
+        MatrixXd Y(m, k);
+        for (int c = 0; c < k; ++c)
+        {
+            if (static_cast<int>(yColumns[c].size()) != m)
+            {
+                throw std::invalid_argument("Every y column must have the same size as x");
+            }
+            for (int i = 0; i < m; ++i)
+                Y(i, c) = yColumns[c][i];
+        }
+
+        // --- Least squares: una sola fattorizzazione QR per tutte le curve ---
+        const MatrixXd Z = V.colPivHouseholderQr().solve(Y);
+
+        // --- Un modello per curva, coefficienti lasciati nella variabile scalata ---
+        std::vector<RegressionModel> models(k);
+        for (int c = 0; c < k; ++c)
+        {
+            models[c].method = RegressionMethod::POLYNOMIAL;
+            models[c].coefficients.resize(n + 1);
+            for (int j = 0; j <= n; ++j)
+            {
+                models[c].coefficients[j] = Z(j, c);
+            }
+            models[c].center = center;
+            models[c].scale = scale;
+        }
+
+        return models;
+    }
+
     /// Method to get the estimated Y value from the regression at a specific X value
     double getYValueFromRegression(double valueOfX)
     {
@@ -327,10 +383,12 @@ public:
 
         { // Queste parentesi servono per creare un nuovo scope in modo da poter dichiarare variabili locali come yValue
 
+            // Horner nella variabile scalata in cui è stato risolto il fit
+            const double z = (valueOfX - polyCenter) / polyScale;
             double yValue = 0.0;
-            for (int i = 0; i <= Degree; i++)
+            for (size_t i = 0; i < polyCoeff.size(); i++)
             {
-                yValue += polyCoeff[i] * std::pow(valueOfX, Degree - i);
+                yValue = yValue * z + polyCoeff[i];
             }
             // std::cout << "The calculated value from polynomial regression is: " << yValue << std::endl;
             return yValue;
@@ -369,9 +427,107 @@ public:
         }
     }
 
+    /// Method to get the estimated Y values from the regression at many X values at once.
+    /// The regression method is dispatched once for the whole batch; polynomials are evaluated
+    /// with Horner's scheme in the scaled variable, coefficient-by-coefficient over blocks of points, and the
+    /// exp/log based models use Eigen's vectorized array functions.
+    /// @param x Pointer to n query points.
+    /// @param y Pointer to n output values (written, may alias x).
+    /// @param n Number of query points.
+    void getYValuesFromRegression(const double *x, double *y, size_t n) const
+    {
+
+        using namespace Eigen;
+
+        Map<const ArrayXd> xArray(x, static_cast<Index>(n));
+        Map<ArrayXd> yArray(y, static_cast<Index>(n));
+
+        switch (this->Method)
+        {
+
+        case RegressionMethod::LINEAR:
+
+            yArray = ALinear * xArray + BLinear;
+            return;
+
+        case RegressionMethod::POLYNOMIAL:
+        {
+            // Blocchi piccoli così x e y restano in cache L1 durante i passaggi di Horner
+            constexpr size_t blockSize = 256;
+            double z[blockSize];
+
+            for (size_t start = 0; start < n; start += blockSize)
+            {
+                const size_t end = std::min(n, start + blockSize);
+
+                for (size_t i = start; i < end; ++i)
+                {
+                    z[i - start] = (x[i] - polyCenter) / polyScale;
+                    y[i] = polyCoeff[0];
+                }
+
+                for (size_t j = 1; j < polyCoeff.size(); ++j)
+                {
+                    const double c = polyCoeff[j];
+                    for (size_t i = start; i < end; ++i)
+                    {
+                        y[i] = y[i] * z[i - start] + c;
+                    }
+                }
+            }
+            return;
+        }
+
+        case RegressionMethod::EXPONENTIAL:
+
+            yArray = AExp * (BExp * xArray).exp();
+            return;
+
+        case RegressionMethod::POWER:
+
+            // x^B = exp(B * ln(x)), valido per x > 0 come la regressione potenza stessa
+            yArray = APower * (BPower * xArray.log()).exp();
+            return;
+
+        case RegressionMethod::LOGARITHMIC:
+
+            yArray = ALog * xArray.log() + BLog;
+            return;
+
+        case RegressionMethod::CONSTANT:
+
+            yArray = xArray;
+            return;
+
+        default:
+
+            yArray.setZero();
+            return;
+        }
+    }
+
+    /// Overload of getYValuesFromRegression for std::vector inputs.
+    std::vector<double> getYValuesFromRegression(const std::vector<double> &x) const
+    {
+
+        std::vector<double> y(x.size());
+        getYValuesFromRegression(x.data(), y.data(), x.size());
+        return y;
+    }
+
+    /// Overload of getYValuesFromRegression for Eigen vectors.
+    Eigen::VectorXd getYValuesFromRegression(const Eigen::VectorXd &x) const
+    {
+
+        Eigen::VectorXd y(x.size());
+        getYValuesFromRegression(x.data(), y.data(), static_cast<size_t>(x.size()));
+        return y;
+    }
+
     /// Method to retrieve the coefficients of the regression model
     /// LINEAR : [Slope, Intercept]
-    /// POLYNOMIAL : [p_n, p_(n-1), ..., p_1, p_0]
+    /// POLYNOMIAL : [p_n, p_(n-1), ..., p_1, p_0] in x (expanded from the scaled fit,
+    ///              getModel() returns the scaled form used for evaluation)
     /// EXPONENTIAL : [A, B] where y = A * exp(B * x)
     /// POWER : [A, B] where y = A * x^B
     /// LOGARITHMIC : [A, B] where y = A * ln(x) + B
@@ -394,7 +550,7 @@ public:
             // }
             // std::cout << std::endl;
 
-            return polyCoeff;
+            return getModel().monomialCoefficients();
 
         case RegressionMethod::EXPONENTIAL:
 
@@ -419,6 +575,47 @@ public:
         }
     }
 
+    /// Method to retrieve the fitted model (method + coefficients) for repeated evaluation
+    /// without keeping the raw x/y data. The layout is the same as getCoefficients() except for
+    /// POLYNOMIAL, whose coefficients stay in z = (x - center) / scale together with center and scale.
+    RegressionModel getModel() const
+    {
+
+        RegressionModel model;
+        model.method = this->Method;
+
+        switch (this->Method)
+        {
+
+        case RegressionMethod::LINEAR:
+            model.coefficients = {ALinear, BLinear};
+            break;
+
+        case RegressionMethod::POLYNOMIAL:
+            model.coefficients = polyCoeff;
+            model.center = polyCenter;
+            model.scale = polyScale;
+            break;
+
+        case RegressionMethod::EXPONENTIAL:
+            model.coefficients = {AExp, BExp};
+            break;
+
+        case RegressionMethod::POWER:
+            model.coefficients = {APower, BPower};
+            break;
+
+        case RegressionMethod::LOGARITHMIC:
+            model.coefficients = {ALog, BLog};
+            break;
+
+        default:
+            break;
+        }
+
+        return model;
+    }
+
     /// @brief Generates and displays a chart of the regression using Gnuplot.
     /// @param xLabelChart Label for the X axis.
     /// @param yLabelChart Label for the Y axis.
@@ -465,9 +662,10 @@ public:
             {
 
                 xLinear.emplace_back(i); // Uso l'indice i così le coppie (xLinear, yLinear) corrispondono ai punti della retta nel dominio originale.
-                yLinear.emplace_back(ALinear * i + BLinear);
             }
 
+            yLinear = getYValuesFromRegression(xLinear);
+
             // Preparazione dati per il plot
             std::vector<std::pair<double, double>> dataForChart;
             std::vector<std::pair<double, double>> xyPoint;
@@ -614,15 +812,10 @@ public:
             {
 
                 xPoli.emplace_back(i); // Uso l'indice i così le coppie (xPoli, yPoli) corrispondono ai punti della retta nel dominio originale.
-
-                double yValue = 0.0;
-                for (int j = 0; j < polyCoeff.size(); ++j)
-                {
-                    yValue += polyCoeff[j] * std::pow(i, Degree - j);
-                }
-                yPoli.emplace_back(yValue);
             }
 
+            yPoli = getYValuesFromRegression(xPoli);
+
             // Preparazione dati per il plot
             std::vector<std::pair<double, double>> dataForChart;
             std::vector<std::pair<double, double>> xyPoint;
@@ -769,9 +962,10 @@ public:
             {
 
                 xExp.emplace_back(i);
-                yExp.emplace_back(AExp * std::exp(BExp * i));
             }
 
+            yExp = getYValuesFromRegression(xExp);
+
             // Preparazione dati per il plot
             std::vector<std::pair<double, double>> dataForChart;
             std::vector<std::pair<double, double>> xyPoint;
@@ -917,9 +1111,10 @@ public:
             for (double i = minVale; i <= maxVale; i += deltaH)
             {
                 xPower.emplace_back(i);
-                yPower.emplace_back(APower * std::pow(i, BPower));
             }
 
+            yPower = getYValuesFromRegression(xPower);
+
             // Preparazione dati per il plot
             std::vector<std::pair<double, double>> dataForChart;
             std::vector<std::pair<double, double>> xyPoint;
@@ -1059,9 +1254,10 @@ public:
             for (double i = minVale; i <= maxVale; i += deltaH)
             {
                 xLog.emplace_back(i);
-                yLog.emplace_back(ALog * std::log(i) + BLog);
             }
 
+            yLog = getYValuesFromRegression(xLog);
+
             // Preparazione dati per il plot
             std::vector<std::pair<double, double>> dataForChart;
             std::vector<std::pair<double, double>> xyPoint;
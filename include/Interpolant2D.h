@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include "Interpolant.h"
 #include "RegressionMethod.h"
+#include "RegressionModel.h"
 
 /**
  * @brief 2D Interpolation class using multiple 1D interpolants
@@ -14,14 +15,19 @@
  * 1. Interpolating along one dimension (x) for each parameter value
  * 2. Interpolating the results along the parameter dimension
  * 
+ * Each curve is fitted once in addCurve() and only its coefficients are kept,
+ * so interpolate() is a plain evaluation of the stored models followed by the
+ * closed-form least-squares line across the parameter direction: no Interpolant
+ * is rebuilt and no memory is allocated per query.
+ * 
  * Example use case: Interpolating upwash gradient as a function of 
  * distance ratio (x) and aspect ratio (parameter)
  */
 class Interpolant2D
 {
 private:
-    // Map: parameter value -> pair of (x_data, y_data)
-    std::map<double, std::pair<std::vector<double>, std::vector<double>>> dataMap;
+    // Map: parameter value -> fitted model of the curve at that parameter
+    std::map<double, RegressionModel> modelMap;
     
     // Regression settings
     int degree;
@@ -30,6 +36,65 @@ private:
     // Cached parameter values for quick access
     std::vector<double> parameterValues;
 
+    // Coefficients of all fitted curves stored contiguously, in the same order
+    // as parameterValues. Every curve shares method and degree, so curve i
+    // occupies [i * coefficientsPerCurve, (i + 1) * coefficientsPerCurve).
+    std::vector<double> curveCoefficients;
+    size_t coefficientsPerCurve = 0;
+
+    // Center and scale of the abscissae of each curve (used by POLYNOMIAL)
+    std::vector<double> curveCenters;
+    std::vector<double> curveScales;
+
+    // Precomputed terms of the linear regression along the parameter direction:
+    // y(p) = sum_i y_i * (1/n + parameterWeights[i] * (p - parameterMean))
+    double parameterMean = 0.0;
+    std::vector<double> parameterWeights;
+
+    // Rebuild the contiguous caches after a curve has been added
+    void updateCaches()
+    {
+        parameterValues.clear();
+        curveCoefficients.clear();
+        curveCenters.clear();
+        curveScales.clear();
+        for (const auto& [param_val, model] : modelMap)
+        {
+            parameterValues.push_back(param_val);
+            coefficientsPerCurve = model.coefficients.size();
+            curveCoefficients.insert(curveCoefficients.end(), model.coefficients.begin(), model.coefficients.end());
+            curveCenters.push_back(model.center);
+            curveScales.push_back(model.scale);
+        }
+
+        const double n = static_cast<double>(parameterValues.size());
+        double sumP = 0.0;
+        for (double p : parameterValues)
+        {
+            sumP += p;
+        }
+        parameterMean = sumP / n;
+
+        double denominator = 0.0;
+        for (double p : parameterValues)
+        {
+            denominator += (p - parameterMean) * (p - parameterMean);
+        }
+
+        parameterWeights.resize(parameterValues.size());
+        for (size_t i = 0; i < parameterValues.size(); ++i)
+        {
+            parameterWeights[i] = (parameterValues[i] - parameterMean) / denominator;
+        }
+    }
+
+    // Evaluate the i-th stored curve at x
+    double evaluateCurve(size_t i, double x) const noexcept
+    {
+        return RegressionModel::evaluate(method, curveCoefficients.data() + i * coefficientsPerCurve, coefficientsPerCurve, x,
+                                         curveCenters[i], curveScales[i]);
+    }
+
 public:
     /**
      * @brief Construct a new Interpolant2D object
@@ -45,9 +110,15 @@ public:
     /**
      * @brief Add a curve for a specific parameter value
      * 
+     * The curve is fitted immediately with the interpolator's degree and method;
+     * only the resulting coefficients are stored.
+     * 
      * @param parameterValue The parameter value (e.g., aspect ratio = 4.0)
      * @param x_data X values for this curve
      * @param y_data Y values for this curve
+     * 
+     * @throws std::invalid_argument if x_data and y_data have different sizes or are empty
+     * @throws std::runtime_error if the regression cannot be fitted (see Interpolant)
      */
     void addCurve(double parameterValue, 
                   const std::vector<double>& x_data, 
@@ -63,14 +134,67 @@ public:
             throw std::invalid_argument("Data vectors cannot be empty");
         }
 
-        dataMap[parameterValue] = {x_data, y_data};
+        modelMap[parameterValue] = Interpolant(x_data, y_data, degree, method).getModel();
         
-        // Update parameter values cache
-        parameterValues.clear();
-        for (const auto& pair : dataMap)
+        // Update parameter values cache and parameter-direction weights
+        updateCaches();
+    }
+
+    /**
+     * @brief Add several curves that share the same abscissae
+     * 
+     * For POLYNOMIAL interpolators the Vandermonde matrix of the shared x grid is
+     * factorized once and all curves are solved in a single call (see
+     * Interpolant::polynomialFit); other methods fall back to one fit per curve.
+     * 
+     * @param parameterValues_ Parameter value of each curve
+     * @param x_data X values shared by all curves
+     * @param y_data Y values of each curve, one vector per parameter value
+     * 
+     * @throws std::invalid_argument if the number of curves and parameters differ,
+     *         or if any y vector does not match x_data in size
+     * @throws std::runtime_error if the regression cannot be fitted (see Interpolant)
+     */
+    void addCurves(const std::vector<double>& parameterValues_,
+                   const std::vector<double>& x_data,
+                   const std::vector<std::vector<double>>& y_data)
+    {
+        if (parameterValues_.size() != y_data.size())
+        {
+            throw std::invalid_argument("parameterValues and y_data must have the same size");
+        }
+
+        if (x_data.empty())
         {
-            parameterValues.push_back(pair.first);
+            throw std::invalid_argument("Data vectors cannot be empty");
         }
+
+        for (const auto& y : y_data)
+        {
+            if (y.size() != x_data.size())
+            {
+                throw std::invalid_argument("x_data and y_data must have the same size");
+            }
+        }
+
+        if (method == RegressionMethod::POLYNOMIAL)
+        {
+            std::vector<RegressionModel> models = Interpolant::polynomialFit(x_data, y_data, degree);
+            for (size_t i = 0; i < parameterValues_.size(); ++i)
+            {
+                modelMap[parameterValues_[i]] = std::move(models[i]);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < parameterValues_.size(); ++i)
+            {
+                modelMap[parameterValues_[i]] = Interpolant(x_data, y_data[i], degree, method).getModel();
+            }
+        }
+
+        // Caches are rebuilt once for the whole family
+        updateCaches();
     }
 
     /**
@@ -85,33 +209,72 @@ public:
      */
     double interpolate(double x_target, double parameter_target) const
     {
-        if (dataMap.empty())
+        if (parameterValues.empty())
         {
             throw std::runtime_error("No data has been added to the interpolator");
         }
 
-        if (dataMap.size() == 1)
+        if (parameterValues.size() == 1)
         {
             // Only one curve available - just interpolate along x
-            const auto& curve = dataMap.begin()->second;
-            Interpolant interp1D(curve.first, curve.second, degree, method);
-            return interp1D.getYValueFromRegression(x_target);
+            return evaluateCurve(0, x_target);
         }
 
-        // Step 1: For each parameter value, interpolate at x_target
-        std::vector<double> y_at_target_x;
-        
-        for (const auto& [param_val, curve_data] : dataMap)
+        // Step 1: evaluate each stored curve at x_target
+        // Step 2: linear least-squares along the parameter direction (more stable)
+        const double invN = 1.0 / static_cast<double>(parameterValues.size());
+        const double deltaParameter = parameter_target - parameterMean;
+
+        double result = 0.0;
+        for (size_t i = 0; i < parameterValues.size(); ++i)
+        {
+            result += evaluateCurve(i, x_target) * (invN + parameterWeights[i] * deltaParameter);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Perform 2D interpolation on a batch of query points
+     * 
+     * Equivalent to calling interpolate(x_target[i], parameter_target[i]) for each i,
+     * without any allocation.
+     * 
+     * @param x_target Pointer to n abscissa values
+     * @param parameter_target Pointer to n parameter values
+     * @param output Pointer to n output values (written)
+     * @param n Number of query points
+     */
+    void interpolate(const double* x_target,
+                     const double* parameter_target,
+                     double* output,
+                     size_t n) const
+    {
+        for (size_t k = 0; k < n; ++k)
+        {
+            output[k] = interpolate(x_target[k], parameter_target[k]);
+        }
+    }
+
+    /**
+     * @brief Perform 2D interpolation on a batch of query points
+     * 
+     * @param x_target Abscissa values
+     * @param parameter_target Parameter values (same size as x_target)
+     * @return std::vector<double> Interpolated Y values
+     * 
+     * @throws std::invalid_argument if the two inputs have different sizes
+     */
+    std::vector<double> interpolate(const std::vector<double>& x_target,
+                                    const std::vector<double>& parameter_target) const
+    {
+        if (x_target.size() != parameter_target.size())
         {
-            const auto& [x_data, y_data] = curve_data;
-            Interpolant interp1D(x_data, y_data, degree, method);
-            y_at_target_x.push_back(interp1D.getYValueFromRegression(x_target));
+            throw std::invalid_argument("x_target and parameter_target must have the same size");
         }
 
-        // Step 2: Interpolate along the parameter dimension
-        // Use linear interpolation for parameter direction (more stable)
-        Interpolant interp_param(parameterValues, y_at_target_x, 1, RegressionMethod::LINEAR);
-        return interp_param.getYValueFromRegression(parameter_target);
+        std::vector<double> output(x_target.size());
+        interpolate(x_target.data(), parameter_target.data(), output.data(), output.size());
+        return output;
     }
 
     /**
@@ -119,7 +282,7 @@ public:
      */
     size_t getNumCurves() const
     {
-        return dataMap.size();
+        return modelMap.size();
     }
 
     /**
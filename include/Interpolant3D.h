@@ -2,7 +2,7 @@
 
 #include <vector>
 #include <string>
-#include <map>
+#include <algorithm>
 #include <stdexcept>
 #include "Interpolant.h"
 #include "Interpolant2D.h"
@@ -33,12 +33,15 @@ class Interpolant3D
 {
 private:
     /**
-     * @brief Map from outer parameter (param2) to a 2D interpolant
+     * @brief 2D interpolants, one per outer parameter (param2) value
      *
      * Each entry represents one "slice" of the 3D data at a fixed param2 value.
      * The 2D interpolant within each slice handles (x, param1) interpolation.
+     * Slices are kept contiguous and sorted in the same order as param2Values;
+     * every curve is fitted once when it is added, so queries only evaluate
+     * stored coefficients.
      */
-    std::map<double, Interpolant2D> sliceMap;
+    std::vector<Interpolant2D> slices;
 
     // Regression settings applied to each internal 2D interpolant
     int degree;
@@ -47,6 +50,34 @@ private:
     /// Cached sorted list of outer parameter values for quick access
     std::vector<double> param2Values;
 
+    /// Precomputed terms of the linear regression along param2 (see Interpolant2D)
+    double param2Mean = 0.0;
+    std::vector<double> param2Weights;
+
+    /// Rebuild the param2 regression weights after a slice has been added
+    void updateParam2Weights()
+    {
+        const double n = static_cast<double>(param2Values.size());
+        double sumP = 0.0;
+        for (double p : param2Values)
+        {
+            sumP += p;
+        }
+        param2Mean = sumP / n;
+
+        double denominator = 0.0;
+        for (double p : param2Values)
+        {
+            denominator += (p - param2Mean) * (p - param2Mean);
+        }
+
+        param2Weights.resize(param2Values.size());
+        for (size_t i = 0; i < param2Values.size(); ++i)
+        {
+            param2Weights[i] = (param2Values[i] - param2Mean) / denominator;
+        }
+    }
+
 public:
     /**
      * @brief Construct a new Interpolant3D object
@@ -63,6 +94,7 @@ public:
      * @brief Add a single curve to a specific 2D slice
      *
      * If the 2D slice for param2Value does not exist yet, it is created automatically.
+     * The curve is fitted immediately; only its coefficients are stored.
      *
      * @param param2Value  Value of the outer parameter for this slice (e.g., Mach = 0.3)
      * @param param1Value  Value of the inner curve parameter within the slice (e.g., taper ratio = 0.5)
@@ -95,21 +127,19 @@ public:
             throw std::invalid_argument("Data vectors cannot be empty");
         }
 
-        // Create the 2D slice if it does not exist yet
-        if (sliceMap.find(param2Value) == sliceMap.end())
+        // Create the 2D slice if it does not exist yet, keeping param2Values sorted
+        auto position = std::lower_bound(param2Values.begin(), param2Values.end(), param2Value);
+        const size_t index = static_cast<size_t>(position - param2Values.begin());
+
+        if (position == param2Values.end() || *position != param2Value)
         {
-            sliceMap.emplace(param2Value, Interpolant2D(degree, method));
-
-            // Update the cached list of outer parameter values
-            param2Values.clear();
-            for (const auto &entry : sliceMap)
-            {
-                param2Values.push_back(entry.first);
-            }
+            param2Values.insert(position, param2Value);
+            slices.insert(slices.begin() + index, Interpolant2D(degree, method));
+            updateParam2Weights();
         }
 
         // Add the curve to the corresponding 2D slice
-        sliceMap.at(param2Value).addCurve(param1Value, x_data, y_data);
+        slices[index].addCurve(param1Value, x_data, y_data);
     }
 
     /**
@@ -120,7 +150,9 @@ public:
      *    using the internal Interpolant2D.
      * 2. Collect the results from all slices.
      * 3. Interpolate the collected results along the param2 dimension using
-     *    a 1D linear interpolant evaluated at param2_target.
+     *    a 1D linear least-squares line evaluated at param2_target.
+     *
+     * No Interpolant is built and no memory is allocated during the query.
      *
      * @param x_target       Target value of the base abscissa
      * @param param1_target  Target value of the inner curve parameter
@@ -139,28 +171,75 @@ public:
                        double param1_target,
                        double param2_target) const
     {
-        if (sliceMap.empty())
+        if (slices.empty())
         {
             throw std::runtime_error("No data has been added to the 3D interpolator");
         }
 
         // Special case: only one 2D slice available
-        if (sliceMap.size() == 1)
+        if (slices.size() == 1)
+        {
+            return slices.front().interpolate(x_target, param1_target);
+        }
+
+        // Step 1, 2 & 3: evaluate each 2D slice and accumulate the param2 regression
+        const double invN = 1.0 / static_cast<double>(slices.size());
+        const double deltaParam2 = param2_target - param2Mean;
+
+        double result = 0.0;
+        for (size_t i = 0; i < slices.size(); ++i)
         {
-            return sliceMap.begin()->second.interpolate(x_target, param1_target);
+            result += slices[i].interpolate(x_target, param1_target) * (invN + param2Weights[i] * deltaParam2);
         }
+        return result;
+    }
 
-        // Step 1 & 2: Evaluate each 2D slice at (x_target, param1_target)
-        std::vector<double> y_at_slices;
+    /**
+     * @brief Perform 3D interpolation on a batch of query points
+     *
+     * Equivalent to calling interpolate(x_target[i], param1_target[i], param2_target[i])
+     * for each i, without any allocation.
+     *
+     * @param x_target       Pointer to n abscissa values
+     * @param param1_target  Pointer to n inner parameter values
+     * @param param2_target  Pointer to n outer parameter values
+     * @param output         Pointer to n output values (written)
+     * @param n              Number of query points
+     */
+    void interpolate(const double *x_target,
+                     const double *param1_target,
+                     const double *param2_target,
+                     double *output,
+                     size_t n) const
+    {
+        for (size_t k = 0; k < n; ++k)
+        {
+            output[k] = interpolate(x_target[k], param1_target[k], param2_target[k]);
+        }
+    }
 
-        for (const auto &[param2_val, slice2D] : sliceMap)
+    /**
+     * @brief Perform 3D interpolation on a batch of query points
+     *
+     * @param x_target       Abscissa values
+     * @param param1_target  Inner parameter values (same size as x_target)
+     * @param param2_target  Outer parameter values (same size as x_target)
+     * @return std::vector<double> Interpolated output values
+     *
+     * @throws std::invalid_argument if the inputs have different sizes
+     */
+    std::vector<double> interpolate(const std::vector<double> &x_target,
+                                    const std::vector<double> &param1_target,
+                                    const std::vector<double> &param2_target) const
+    {
+        if (x_target.size() != param1_target.size() || x_target.size() != param2_target.size())
         {
-            y_at_slices.push_back(slice2D.interpolate(x_target, param1_target));
+            throw std::invalid_argument("x_target, param1_target and param2_target must have the same size");
         }
 
-        // Step 3: Interpolate along the outer parameter dimension (param2)
-        Interpolant interp_param2(param2Values, y_at_slices, 1, RegressionMethod::LINEAR);
-        return interp_param2.getYValueFromRegression(param2_target);
+        std::vector<double> output(x_target.size());
+        interpolate(x_target.data(), param1_target.data(), param2_target.data(), output.data(), output.size());
+        return output;
     }
 
     /**
@@ -170,7 +249,7 @@ public:
      */
     size_t getNumSlices() const
     {
-        return sliceMap.size();
+        return slices.size();
     }
 
     /**
@@ -207,10 +286,11 @@ public:
      */
     size_t getNumCurvesInSlice(double param2Value) const
     {
-        if (sliceMap.find(param2Value) == sliceMap.end())
+        auto position = std::lower_bound(param2Values.begin(), param2Values.end(), param2Value);
+        if (position == param2Values.end() || *position != param2Value)
         {
             throw std::out_of_range("No slice found for the given param2 value");
         }
-        return sliceMap.at(param2Value).getNumCurves();
+        return slices[static_cast<size_t>(position - param2Values.begin())].getNumCurves();
     }
 };
\ No newline at end of file
@@ -4,8 +4,7 @@
 #include "EnumAircraftCategory.h"
 #include "EnumAircraftEngineType.h"
 #include "EnumAircraftEngineCategory.h"
-#include "Interpolant.h"
-#include "RegressionMethod.h"
+#include "TabulatedInterpolant.h"
 #include "ConvMass.h"
 #include "ConvLength.h"
 #include "EnumMASS.h"
@@ -70,12 +69,13 @@ public:
         const double eccentricityFactor    = 0.5 * (wingSpanFeet + fuselageLengthFeet);   // Roskam e-coefficient
 
         // --- Select coefficient tables based on category + engine type ---
-        RoskamTable tbl = selectTable();
+        const RoskamInterpolants& tbl = selectTable();
 
         // --- Interpolate radii of gyration ---
-        double Rxbar = interpPchipLinearExtrap(tbl.weight, tbl.Rx, weightAircaftPounds);
-        double Rybar = interpPchipLinearExtrap(tbl.weight, tbl.Ry, weightAircaftPounds);
-        double Rzbar = interpPchipLinearExtrap(tbl.weight, tbl.Rz, weightAircaftPounds);
+        // PCHIP in-range, linear extrapolation out-of-range (MATLAB interp1 'pchip' + 'linear','extrap')
+        double Rxbar = tbl.Rx.evaluate(weightAircaftPounds);
+        double Rybar = tbl.Ry.evaluate(weightAircaftPounds);
+        double Rzbar = tbl.Rz.evaluate(weightAircaftPounds);
 
         // --- Compute inertias (1.3558 = 14.5939 * 0.3048^2 : slug*ft^2 -> kg*m^2) ---
         Result res;
@@ -115,15 +115,32 @@ private:
         std::vector<double> Rz;
     };
 
+    // --------------------------------------------------------
+    // PCHIP interpolants of a Roskam table, built once per
+    // configuration (static in selectTable) and shared by all calls
+    // --------------------------------------------------------
+    struct RoskamInterpolants
+    {
+        TabulatedInterpolant Rx;
+        TabulatedInterpolant Ry;
+        TabulatedInterpolant Rz;
+
+        explicit RoskamInterpolants(const RoskamTable& table)
+            : Rx(table.weight, table.Rx, TabulatedMethod::PCHIP)
+            , Ry(table.weight, table.Ry, TabulatedMethod::PCHIP)
+            , Rz(table.weight, table.Rz, TabulatedMethod::PCHIP)
+        {}
+    };
+
     // --------------------------------------------------------
     // Table selector — mirrors the MATLAB if/elseif chain
     // --------------------------------------------------------
     /**
      * @brief Selects the Roskam coefficient table for the current aircraft configuration.
-     * @return Table with weight and Rx/Ry/Rz coefficient vectors.
+     * @return Rx/Ry/Rz interpolants over weight, built on the first use of each table.
      * @throws std::runtime_error If the category/engine combination is not supported.
      */
-    RoskamTable selectTable() const
+    const RoskamInterpolants& selectTable() const
     {
         const bool isGAorUAV = (aircraftCategory == AircraftCategory::GENERAL_AVIATION ||
                                 aircraftCategory == AircraftCategory::UAV);
@@ -138,62 +155,67 @@ private:
         // --- GUAV single engine ---
         if (isGAorUAV && engineCategory == AircraftEngineCategory::SINGLE_ENGINE)
         {
-            return {
+            static const RoskamInterpolants singleEngine(RoskamTable{
                 { 3125, 1127, 1477, 1761, 1885, 2700 },  // weight in lbs
                 { 0.248, 0.254, 0.242, 0.212, 0.342, 0.222 }, // Rx
                 { 0.338, 0.405, 0.386, 0.362, 0.397, 0.356 }, // Ry
                 { 0.393, 0.418, 0.403, 0.394, 0.393, 0.379 }  // Rz
-            };
+            });
+            return singleEngine;
         }
 
         // --- GUAV twin engine ---
         if (isGAorUAV && engineCategory == AircraftEngineCategory::TWIN_ENGINE)
         {
-            return {
+            static const RoskamInterpolants twinEngine(RoskamTable{
                 { 4880, 4000, 6500, 9000, 5000, 6200, 4851, 8400, 5642, 9925 },
                 { 0.260, 0.251, 0.240, 0.232, 0.414, 0.373, 0.324, 0.340, 0.285, 0.256 },
                 { 0.329, 0.327, 0.313, 0.360, 0.278, 0.269, 0.318, 0.284, 0.345, 0.212 },
                 { 0.399, 0.391, 0.384, 0.396, 0.502, 0.461, 0.446, 0.445, 0.429, 0.336 }
-            };
+            });
+            return twinEngine;
         }
 
         // --- Regional Turboprop (RT) ---
         if (aircraftCategory == AircraftCategory::REGIONAL_TURBOPROP)
         {
-            return {
+            static const RoskamInterpolants regionalTurboprop(RoskamTable{
                 { 38500, 12500 },
                 { 0.235, 0.203 },
                 { 0.363, 0.326 },
                 { 0.416, 0.350 }
-            };
+            });
+            return regionalTurboprop;
         }
 
         // --- Piston Propeller (PP) ---
         if (aircraftCategory == AircraftCategory::GENERAL_AVIATION && engineType == AircraftEngineType::PISTON_PROPELLER)
         {
-            return {
+            static const RoskamInterpolants pistonPropeller(RoskamTable{
                 { 107000, 120000, 146500, 60360, 97200, 49500, 45000, 41800, 44500, 20000 },
                 { 0.300, 0.316, 0.371, 0.250, 0.322, 0.278, 0.272, 0.286, 0.308, 0.225 },
                 { 0.298, 0.336, 0.278, 0.320, 0.324, 0.314, 0.378, 0.351, 0.345, 0.303 },
                 { 0.426, 0.448, 0.473, 0.388, 0.456, 0.400, 0.444, 0.443, 0.457, 0.346 }
-            };
+            });
+            return pistonPropeller;
         }
 
         // --- Turboprop (TP) ---
         if (aircraftCategory == AircraftCategory::GENERAL_AVIATION && engineType == AircraftEngineType::TURBOPROP)
         {
-            return {
+            static const RoskamInterpolants turboprop(RoskamTable{
                 { 103000, 187000, 116000 },
                 { 0.317, 0.330, 0.394 },
                 { 0.356, 0.357, 0.341 },
                 { 0.455, 0.478, 0.497 }
-            };
+            });
+            return turboprop;
         }
 
         // --- Transport Jet ---
         if (aircraftCategory == AircraftCategory::TRANSPORT_JET)
         {
-            return {
+            static const RoskamInterpolants transportJet(RoskamTable{
                 { 6505,  12000, 7036,  13500,
                   185000,191500,240000,245000,165000,
                   89000, 180000,100000,113000,
@@ -207,170 +229,10 @@ private:
                 { 0.430, 0.423, 0.447, 0.420, 0.465, 0.464,
                   0.473, 0.472, 0.452, 0.518, 0.502, 0.550, 0.456,
                   0.517, 0.445, 0.508, 0.435, 0.434 }
-            };
+            });
+            return transportJet;
         }
 
         throw std::runtime_error("MomentOfInertia: unsupported aircraft category / engine type combination.");
     }
-
-    // ============================================================
-    // PCHIP interpolation inside the data range,
-    // linear extrapolation outside — mirrors MATLAB helper.
-    //
-    // x and y need not be sorted on input (they are sorted here).
-    // Duplicate x values are averaged.
-    // ============================================================
-    /**
-     * @brief Performs PCHIP interpolation in-range and linear extrapolation out-of-range.
-     * @param x Sample x values.
-     * @param y Sample y values.
-     * @param xq Query x value.
-     * @return Interpolated or extrapolated y value at xq.
-     * @throws std::invalid_argument If input data is empty.
-     */
-    static double interpPchipLinearExtrap(std::vector<double> x,
-                                          std::vector<double> y,
-                                          double xq)
-    {
-        const std::size_t n = x.size();
-        if (n == 0) throw std::invalid_argument("interpPchipLinearExtrap: empty data");
-        if (n == 1) return y[0];
-
-        // --- Sort by x ---
-        std::vector<std::size_t> idx(n);
-        std::iota(idx.begin(), idx.end(), 0);
-        std::sort(idx.begin(), idx.end(), [&](std::size_t a, std::size_t b){ return x[a] < x[b]; });
-
-        std::vector<double> xs(n), ys(n);
-        for (std::size_t i = 0; i < n; ++i) { xs[i] = x[idx[i]]; ys[i] = y[idx[i]]; }
-
-        // --- Merge duplicates (average y at same x) ---
-        std::vector<double> xu, yu;
-        xu.push_back(xs[0]);
-        yu.push_back(ys[0]);
-        for (std::size_t i = 1; i < n; ++i)
-        {
-            if (std::abs(xs[i] - xu.back()) < 1e-12)
-                yu.back() = 0.5 * (yu.back() + ys[i]);
-            else { xu.push_back(xs[i]); yu.push_back(ys[i]); }
-        }
-
-        const std::size_t m = xu.size();
-        if (m == 1) return yu[0];
-
-        const double xmin = xu.front();
-        const double xmax = xu.back();
-
-        // --- Linear extrapolation outside via Interpolant (two boundary points) ---
-        // Mirrors MATLAB: interp1(xs, ys, xq, 'linear', 'extrap')
-        // Only the two nearest boundary points are passed so the slope matches
-        // exactly the local edge interval, consistent with MATLAB behaviour.
-        if (xq <= xmin)
-        {
-            Interpolant leftExtrap({ xu[0], xu[1] }, { yu[0], yu[1] },
-                                   /*degree=*/1, RegressionMethod::LINEAR);
-            return leftExtrap.getYValueFromRegression(xq);
-        }
-        if (xq >= xmax)
-        {
-            Interpolant rightExtrap({ xu[m-2], xu[m-1] }, { yu[m-2], yu[m-1] },
-                                    /*degree=*/1, RegressionMethod::LINEAR);
-            return rightExtrap.getYValueFromRegression(xq);
-        }
-
-        // --- PCHIP inside ---
-        // Step 1: interval lengths and slopes
-        std::vector<double> h(m-1), delta(m-1);
-        for (std::size_t i = 0; i < m-1; ++i)
-        {
-            h[i]     = xu[i+1] - xu[i];
-            delta[i] = (yu[i+1] - yu[i]) / h[i];
-        }
-
-        // Step 2: derivatives d[i] using Fritsch-Carlson conditions
-        std::vector<double> d(m);
-
-        // Endpoints: one-sided three-point formula
-        d[0]   = pchipEndDerivative(h[0], h[1], delta[0], delta[1]);
-        d[m-1] = pchipEndDerivative(h[m-2], h[m-3 < m-2 ? m-3 : m-2],
-                                    delta[m-2],
-                                    m >= 3 ? delta[m-3] : delta[m-2]);
-        // flip sign for the right endpoint (mirrored one-sided)
-        d[m-1] = pchipEndDerivative(h[m-2],
-                                    m >= 3 ? h[m-3] : h[m-2],
-                                    delta[m-2],
-                                    m >= 3 ? delta[m-3] : delta[m-2],
-                                    /*rightEndpoint=*/true);
-
-        // Interior points
-        for (std::size_t i = 1; i < m-1; ++i)
-        {
-            if (delta[i-1] * delta[i] <= 0.0)
-            {
-                // Local extremum — set derivative to zero
-                d[i] = 0.0;
-            }
-            else
-            {
-                // Weighted harmonic mean (preserves shape)
-                double w1 = 2.0*h[i]   + h[i-1];
-                double w2 = 2.0*h[i-1] + h[i];
-                d[i] = (w1 + w2) / (w1/delta[i-1] + w2/delta[i]);
-            }
-        }
-
-        // Step 3: locate interval and evaluate cubic Hermite
-        std::size_t k = 0;
-        while (k < m-2 && xq > xu[k+1]) ++k;
-
-        double t  = (xq - xu[k]) / h[k];
-        double t2 = t * t;
-        double t3 = t2 * t;
-
-        // Hermite basis functions
-        double h00 =  2*t3 - 3*t2 + 1;
-        double h10 =    t3 - 2*t2 + t;
-        double h01 = -2*t3 + 3*t2;
-        double h11 =    t3 -   t2;
-
-        return h00*yu[k] + h10*h[k]*d[k] + h01*yu[k+1] + h11*h[k]*d[k+1];
-    }
-
-    // --------------------------------------------------------
-    // One-sided endpoint derivative for PCHIP
-    //   hLeft, hRight : interval widths adjacent to endpoint
-    //   dLeft, dRight : slopes on those intervals
-    //   rightEndpoint : if true, mirrors indices for the right end
-    // --------------------------------------------------------
-    /**
-     * @brief Computes one-sided endpoint derivative used by PCHIP.
-     * @param h0 Width of the nearest interval.
-     * @param h1 Width of the adjacent interval.
-     * @param del0 Slope on the nearest interval.
-     * @param del1 Slope on the adjacent interval.
-     * @param rightEndpoint True when evaluating the right endpoint rule.
-     * @return Endpoint derivative constrained for shape preservation.
-     */
-    static double pchipEndDerivative(double h0, double h1,
-                                     double del0, double del1,
-                                     bool rightEndpoint = false)
-    {
-        // Three-point one-sided estimate (Fritsch & Carlson, 1980)
-        double d = ((2.0*h0 + h1)*del0 - h0*del1) / (h0 + h1);
-
-        // Impose sign matching with nearest slope
-        if (rightEndpoint)
-        {
-            if (d * del0 < 0.0) d = 0.0;
-            else if (del0 * del1 < 0.0 && std::abs(d) > 3.0*std::abs(del0))
-                d = 3.0 * del0;
-        }
-        else
-        {
-            if (d * del0 < 0.0) d = 0.0;
-            else if (del0 * del1 < 0.0 && std::abs(d) > 3.0*std::abs(del0))
-                d = 3.0 * del0;
-        }
-        return d;
-    }
 };
\ No newline at end of file
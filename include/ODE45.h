@@ -2,21 +2,39 @@
 #define ODE45_H
 
 #include <vector>
+#include <array>
 #include <functional>
 #include <cmath>
 #include <stdexcept>
 #include <type_traits>   // std::invoke_result_t, std::decay_t
+#include <algorithm>
+#include <limits>
+#include <initializer_list>
+#include <utility>
 
 // =============================================================================
 //  StateTraits<State>
 //  Insegna a ODE45 come fare aritmetica su qualsiasi tipo di stato.
 //
 //  Specializzazioni built-in:
-//    - double              → scalare
-//    - std::vector<double> → sistema N-dimensionale
+//    - double                       → scalare
+//    - std::vector<double>          → sistema N-dimensionale (dimensione a runtime)
+//    - std::array<double, N>        → sistema N-dimensionale (dimensione fissa)
+//    - Eigen::Matrix<double, N, 1>  → fisso o dinamico (VectorXd), se Eigen è incluso
 //
-//  Per tipi custom (es. Eigen::VectorXd) aggiungi una nuova
-//  specializzazione in fondo al file.
+//  Per tipi custom aggiungi una nuova specializzazione in fondo al file.
+//
+//  Operazioni richieste:
+//    - zero, add, scale        → interfaccia per valore (storica)
+//    - assign, axpy, scaleInPlace
+//                              → interfaccia in-place usata dal ciclo di
+//                                integrazione: lavora su buffer preallocati
+//                                e non alloca memoria
+//    - errorNorm               → norma RMS pesata dell'errore locale
+//                                (modalità adattiva, vedi ODE45Options)
+//    - dimension, data         → numero di componenti e accesso contiguo
+//                                (modalità stiff: lo stato è visto come un
+//                                vettore Eigen per lo Jacobiano)
 // =============================================================================
 
 template <typename State>
@@ -47,6 +65,37 @@ struct StateTraits<double> {
      * @return Scaled scalar value.
      */
     static double scale(double s,        const double& v) { return s * v; }
+
+    /// dst = src
+    static void assign(double& dst, const double& src)          { dst = src;   }
+
+    /// y += a * x
+    static void axpy(double a, const double& x, double& y)      { y += a * x;  }
+
+    /// v *= s
+    static void scaleInPlace(double s, double& v)               { v *= s;      }
+
+    /**
+     * @brief Weighted error norm used by the adaptive step-size control.
+     * @param err Local error estimate.
+     * @param yOld State at the beginning of the step.
+     * @param yNew State at the end of the step.
+     * @param absTol Absolute tolerance.
+     * @param relTol Relative tolerance.
+     * @return |err| / (absTol + relTol * max(|yOld|, |yNew|)).
+     */
+    static double errorNorm(const double& err, const double& yOld, const double& yNew,
+                            double absTol, double relTol)
+    {
+        return std::abs(err) / (absTol + relTol * std::max(std::abs(yOld), std::abs(yNew)));
+    }
+
+    /// Numero di componenti
+    static size_t dimension(const double&)                      { return 1;    }
+
+    /// Puntatore ai componenti
+    static double*       data(double& v)                        { return &v;   }
+    static const double* data(const double& v)                  { return &v;   }
 };
 
 // ── Specializzazione VETTORIALE ──────────────────────────────────────────────
@@ -87,46 +136,256 @@ struct StateTraits<std::vector<double>> {
         for (size_t i = 0; i < v.size(); i++) res[i] = s * v[i];
         return res;
     }
+
+    /// dst = src — riusa la capacità di dst, nessuna allocazione se le dimensioni coincidono
+    static void assign(State& dst, const State& src) {
+        dst.assign(src.begin(), src.end());
+    }
+
+    /// y += a * x
+    static void axpy(double a, const State& x, State& y) {
+        if (x.size() != y.size())
+            throw std::runtime_error("ODE45: dimensioni vettore incompatibili");
+        for (size_t i = 0; i < x.size(); i++) y[i] += a * x[i];
+    }
+
+    /// v *= s
+    static void scaleInPlace(double s, State& v) {
+        for (double& vi : v) vi *= s;
+    }
+
+    /**
+     * @brief Weighted RMS error norm used by the adaptive step-size control.
+     * @param err Local error estimate.
+     * @param yOld State at the beginning of the step.
+     * @param yNew State at the end of the step.
+     * @param absTol Absolute tolerance.
+     * @param relTol Relative tolerance.
+     * @return sqrt(mean((err_i / (absTol + relTol * max(|yOld_i|, |yNew_i|)))^2)).
+     */
+    static double errorNorm(const State& err, const State& yOld, const State& yNew,
+                            double absTol, double relTol) {
+        if (err.empty()) return 0.0;
+        double sum = 0.0;
+        for (size_t i = 0; i < err.size(); i++) {
+            const double sc = absTol + relTol * std::max(std::abs(yOld[i]), std::abs(yNew[i]));
+            sum += (err[i] / sc) * (err[i] / sc);
+        }
+        return std::sqrt(sum / err.size());
+    }
+
+    /// Numero di componenti
+    static size_t dimension(const State& v)       { return v.size(); }
+
+    /// Puntatore ai componenti (contigui)
+    static double*       data(State& v)           { return v.data(); }
+    static const double* data(const State& v)     { return v.data(); }
+};
+
+// ── Specializzazione ARRAY a dimensione fissa ────────────────────────────────
+//  Nessuna allocazione dinamica: lo stato vive interamente sullo stack.
+template <size_t N>
+struct StateTraits<std::array<double, N>> {
+    using State = std::array<double, N>;
+
+    static State zero(const State&) { State res{}; return res; }
+
+    static State add(const State& a, const State& b) {
+        State res;
+        for (size_t i = 0; i < N; i++) res[i] = a[i] + b[i];
+        return res;
+    }
+
+    static State scale(double s, const State& v) {
+        State res;
+        for (size_t i = 0; i < N; i++) res[i] = s * v[i];
+        return res;
+    }
+
+    static void assign(State& dst, const State& src)          { dst = src; }
+
+    static void axpy(double a, const State& x, State& y) {
+        for (size_t i = 0; i < N; i++) y[i] += a * x[i];
+    }
+
+    static void scaleInPlace(double s, State& v) {
+        for (double& vi : v) vi *= s;
+    }
+
+    static double errorNorm(const State& err, const State& yOld, const State& yNew,
+                            double absTol, double relTol) {
+        if (N == 0) return 0.0;
+        double sum = 0.0;
+        for (size_t i = 0; i < N; i++) {
+            const double sc = absTol + relTol * std::max(std::abs(yOld[i]), std::abs(yNew[i]));
+            sum += (err[i] / sc) * (err[i] / sc);
+        }
+        return std::sqrt(sum / N);
+    }
+
+    static size_t dimension(const State&)         { return N; }
+
+    static double*       data(State& v)           { return v.data(); }
+    static const double* data(const State& v)     { return v.data(); }
 };
 
 
 // =============================================================================
-//  Helper per le deduction guides
+//  ODE45Options  —  scelta dell'integratore e parametri della modalità adattiva
+//
+//    FIXED_STEP_RK4   : RK4 classico a passo costante dt (comportamento storico)
+//    ADAPTIVE_DOPRI5  : Dormand-Prince 5(4) con controllo del passo (come MATLAB
+//                       ode45): stima dell'errore embedded, FSAL (6 valutazioni
+//                       di f per passo accettato), passo limitato da maxStep.
+//    STIFF_ROSENBROCK23 : Rosenbrock 2(3) linearmente implicito (come MATLAB
+//                       ode23s, Shampine & Reichelt) per sistemi stiff, es.
+//                       dinamica del velivolo accoppiata ad attuatori veloci.
+//                       L-stabile: il passo è limitato dalla precisione, non
+//                       dalla stabilità. Jacobiano alle differenze finite,
+//                       riusato per jacobianReuse passi accettati (ricalcolato
+//                       subito dopo un passo rifiutato); la fattorizzazione
+//                       LU di I - h d J è rifatta solo quando h cambia.
+//                       Richiede Eigen incluso PRIMA di questo header.
+//
+//    ODE45 s(f, 0.0, 3000.0, W0, ODE45Options{ODE45Mode::ADAPTIVE_DOPRI5});
 //
-//  DeduceState<Func, State>  estrae il tipo di stato in due modi:
+//  Politiche di output (cosa viene salvato in getT()/getY() o passato
+//  all'observer):
+//
+//    ALL_STEPS       : ogni passo accettato (comportamento storico)
+//    FINAL_STATE     : solo lo stato finale → memoria O(1)
+//    EVERY_NTH_STEP  : un passo ogni outputStride, più lo stato finale
+//    SAMPLE_TIMES    : solo gli istanti in sampleTimes, ricavati con dense
+//                      output (Hermite cubico per RK4, interpolante continua
+//                      di ordine 4 per Dormand-Prince) → O(campioni richiesti)
+// =============================================================================
+
+enum class ODE45Mode {
+    FIXED_STEP_RK4,
+    ADAPTIVE_DOPRI5,
+    STIFF_ROSENBROCK23
+};
+
+enum class ODE45Output {
+    ALL_STEPS,
+    FINAL_STATE,
+    EVERY_NTH_STEP,
+    SAMPLE_TIMES
+};
+
+struct ODE45Options {
+    ODE45Mode mode     = ODE45Mode::FIXED_STEP_RK4;
+    double relTol      = 1e-6;     // Tolleranza relativa (adattivo)
+    double absTol      = 1e-9;     // Tolleranza assoluta (adattivo)
+    double maxStep     = 0.0;      // Passo massimo; 0 = nessun limite oltre tf - t0
+    double initialStep = 0.0;      // Passo iniziale; 0 = stima automatica (Hairer)
+    size_t maxSteps    = 1000000;  // Limite di sicurezza sui passi tentati
+    double dt          = 0.01;     // Passo della modalità FIXED_STEP_RK4
+    size_t jacobianReuse = 10;     // Passi accettati con lo stesso Jacobiano (STIFF_ROSENBROCK23)
+
+    ODE45Output output = ODE45Output::ALL_STEPS;   // Politica di output
+    size_t outputStride = 1;                        // Passo di campionamento per EVERY_NTH_STEP
+    std::vector<double> sampleTimes;                // Istanti richiesti per SAMPLE_TIMES (in [t0, tf])
+};
+
+
+// =============================================================================
+//  ODE45Event<State>  —  evento g(t, y) = 0
 //
-//    1. Dalla condizione iniziale y0 (via State, parametro esplicito)
-//    2. Dal tipo di ritorno della funzione f (via std::invoke_result_t)
+//  Dopo ogni passo accettato il segno di g viene confrontato con quello del
+//  passo precedente; se cambia (nel verso richiesto da direction) l'istante
+//  dell'evento è raffinato con il metodo Illinois sull'interpolante del passo
+//  (dense output), quindi senza nuove valutazioni di f.
+//  Un evento terminal ferma l'integrazione nell'istante dell'evento:
 //
-//  Entrambe devono coincidere — il compilatore lo verifica da solo.
+//    ODE45Event<double> reserve{[&](double, const double& W){ return W - Wreserve; }, -1, true};
+//    ODE45 s(f, 0.0, rangeMax, W0, opts, {reserve});
+//    double rangeAtReserve = s.getFinalTime();
 // =============================================================================
 
+template <typename State>
+struct ODE45Event {
+    std::function<double(double, const State&)> condition;  // g(t, y); l'evento è g = 0
+    int  direction = 0;                                      // 0 entrambi, +1 g crescente, -1 g decrescente
+    bool terminal  = false;                                  // true: ferma l'integrazione
+};
+
+
 // =============================================================================
-//  ODE45<State>  —  solutore RK4 generico (C++17)
+//  ODE45<State, Func>  —  solutore generico (C++17)
+//
+//  Due modalità (vedi ODE45Options): RK4 a passo fisso (default, firma
+//  storica con dt) oppure Dormand-Prince 5(4) adattivo.
+//
+//  Il callable è un parametro template (non std::function): la chiamata a f
+//  può essere inlineata. Sono accettate due firme:
+//
+//    State f(double t, const State& y)              → per valore
+//    void  f(double t, const State& y, State& dydt) → in-place, scrive in dydt
+//
+//  Con la firma in-place e gli operatori in-place di StateTraits il ciclo di
+//  integrazione non alloca memoria (gli stadi k_i e gli stati intermedi sono
+//  buffer preallocati una volta per solve()); restano solo le copie salvate
+//  in getT()/getY(), che dipendono dalla politica di output.
+//
+//  Observer: al posto di salvare i campioni, ogni punto di output può essere
+//  passato a un callable  observer(double t, const State& y)  (streaming,
+//  nessuna crescita di memoria). Lo stato finale è sempre disponibile con
+//  getFinalTime()/getFinalState().
+//
+//    ODE45 s(f, 0.0, 1e5, y0, opts, [&](double t, const State& y){ log << t; });
 //
 //  Con le deduction guides NON serve specificare <State> esplicitamente:
 //
-//    // scalare — il compilatore deduce ODE45<double>
+//    // scalare — il compilatore deduce ODE45<double, lambda>
 //    ODE45 s([](double t, const double& y){ return -2*y; }, 0, 10, 1.0, 0.01);
 //
-//    // vettoriale — deduce ODE45<std::vector<double>>
+//    // vettoriale — deduce ODE45<std::vector<double>, decltype(eqMoto)>
 //    ODE45 s(eqMoto, 0, 20, std::vector{1.0, 0.0}, 0.01);
 // =============================================================================
 
-template <typename State>
+template <typename State, typename Func = std::function<State(double, const State&)>>
 class ODE45 {
 
     using Traits  = StateTraits<State>;
-    using OdeFunc = std::function<State(double, const State&)>;
+
+    // true se f ha la firma in-place f(t, y, dydt)
+    static constexpr bool inPlaceRhs = std::is_invocable_v<Func&, double, const State&, State&>;
 
 private:
-    OdeFunc             f;
+    Func                f;
     double              t0, tf, dt;
     State               y0;
+    ODE45Options        options;
 
     std::vector<double> tVec;
     std::vector<State>  yVec;
 
+    // Ultimo stato raggiunto, indipendente dalla politica di output
+    double              tFinal = 0.0;
+    State               yFinal;
+
+    // Stato della politica di output durante un'integrazione
+    size_t              outputCounter = 0;
+    size_t              nextSample = 0;
+    std::vector<double> samples;
+
+    // Eventi e loro occorrenze
+    std::vector<ODE45Event<State>> events;
+    std::vector<double> eventValues;       // g_i all'inizio del passo corrente
+    std::vector<double> eventTimes;
+    std::vector<State>  eventStates;
+    std::vector<size_t> eventIndices;
+    bool                terminated = false;
+    State               yEvent;            // Buffer per lo stato nell'istante di un evento
+
+    // Statistiche dell'ultima integrazione
+    size_t              acceptedSteps = 0;
+    size_t              rejectedSteps = 0;
+    size_t              functionEvaluations = 0;
+    size_t              jacobianEvaluations = 0;
+    size_t              luDecompositions = 0;
+
     // ── aritmetica interna ───────────────────────────────────────────────────
     /**
      * @brief Adds two states through StateTraits.
@@ -144,23 +403,317 @@ private:
      */
     State scale(double s, const State& v)       const { return Traits::scale(s, v); }
 
+    /**
+     * @brief Writes out = base + sum_i c_i * k_i into a preallocated buffer.
+     * @param out Output buffer (already sized like base).
+     * @param base Base state.
+     * @param terms Pairs (coefficient, stage) to accumulate.
+     */
+    static void combine(State& out, const State& base,
+                        std::initializer_list<std::pair<double, const State*>> terms) {
+        Traits::assign(out, base);
+        for (const auto& [c, k] : terms) Traits::axpy(c, *k, out);
+    }
+
+    /**
+     * @brief Evaluates the right-hand side into dydt.
+     * @param t Time.
+     * @param y State.
+     * @param dydt Output derivative (preallocated).
+     */
+    void evaluate(double t, const State& y, State& dydt) {
+        if constexpr (inPlaceRhs) f(t, y, dydt);
+        else                      dydt = f(t, y);
+        functionEvaluations += 1;
+    }
+
+    // ── politica di output ───────────────────────────────────────────────────
+    /**
+     * @brief Prepares the output policy before an integration.
+     */
+    void beginOutput() {
+        outputCounter = 0;
+        nextSample = 0;
+        samples.clear();
+        if (options.output == ODE45Output::SAMPLE_TIMES) {
+            for (double ts : options.sampleTimes)
+                if (ts >= t0 && ts <= tf) samples.push_back(ts);
+            std::sort(samples.begin(), samples.end());
+        }
+    }
+
+    /**
+     * @brief Emits the initial point according to the output policy.
+     * @param sink Output callable sink(t, y).
+     */
+    template <typename Sink>
+    void emitInitial(Sink& sink, double t, const State& y) {
+        switch (options.output) {
+        case ODE45Output::ALL_STEPS:
+        case ODE45Output::EVERY_NTH_STEP:
+            sink(t, y);
+            break;
+        case ODE45Output::SAMPLE_TIMES:
+            while (nextSample < samples.size() && samples[nextSample] <= t) {
+                sink(samples[nextSample], y);
+                nextSample += 1;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    /**
+     * @brief Emits the output points of an accepted step [tOld, tNew].
+     * @param sink Output callable sink(t, y).
+     * @param dense Callable dense(theta, out) writing y(tOld + theta * (tNew - tOld)) in out.
+     * @param yDense Buffer for dense output.
+     * @param last True for the last step of the integration.
+     * @param stopped True if a terminal event ends the integration at tNew:
+     *                sample times after it are dropped instead of emitted.
+     */
+    template <typename Sink, typename Dense>
+    void emitStep(Sink& sink, double tOld, double tNew, const State& yNew, Dense&& dense, State& yDense,
+                  bool last, bool stopped = false) {
+        switch (options.output) {
+        case ODE45Output::ALL_STEPS:
+            sink(tNew, yNew);
+            break;
+        case ODE45Output::FINAL_STATE:
+            if (last) sink(tNew, yNew);
+            break;
+        case ODE45Output::EVERY_NTH_STEP:
+            outputCounter += 1;
+            if (last || outputCounter % std::max<size_t>(options.outputStride, 1) == 0) sink(tNew, yNew);
+            break;
+        case ODE45Output::SAMPLE_TIMES:
+            while (nextSample < samples.size() && (samples[nextSample] <= tNew || (last && !stopped))) {
+                const double ts = samples[nextSample];
+                if (ts >= tNew) {
+                    sink(ts, yNew);
+                } else {
+                    dense((ts - tOld) / (tNew - tOld), yDense);
+                    sink(ts, yDense);
+                }
+                nextSample += 1;
+            }
+            if (stopped) nextSample = samples.size();   // istanti oltre l'evento terminale: non raggiunti
+            break;
+        }
+    }
+
+    /**
+     * @brief Stores the reached end point.
+     */
+    void finish(double t, const State& y) {
+        tFinal = t;
+        Traits::assign(yFinal, y);
+    }
+
+    // ── eventi ───────────────────────────────────────────────────────────────
+    /**
+     * @brief Resets the event records and evaluates every event at the initial point.
+     */
+    void beginEvents(double t, const State& y) {
+        eventTimes.clear();
+        eventStates.clear();
+        eventIndices.clear();
+        terminated = false;
+        eventValues.resize(events.size());
+        for (size_t i = 0; i < events.size(); ++i)
+            eventValues[i] = events[i].condition(t, y);
+    }
+
+    /**
+     * @brief Checks whether g crossed zero from gOld to gNew in the requested direction.
+     */
+    static bool crossed(double gOld, double gNew, int direction) {
+        if (gOld == 0.0) return false;   // già segnalato (o stato iniziale sull'evento)
+        const bool rising  = gOld < 0.0 && gNew >= 0.0;
+        const bool falling = gOld > 0.0 && gNew <= 0.0;
+        return (rising && direction >= 0) || (falling && direction <= 0);
+    }
+
+    /**
+     * @brief Locates the zero of an event inside a step with the Illinois method.
+     * @param event Event to locate.
+     * @param gOld Event value at theta = 0.
+     * @param gNew Event value at theta = 1.
+     * @param dense Step interpolant dense(theta, out).
+     * @param yDense Scratch buffer.
+     * @return Fraction theta of the step at which the event occurs.
+     */
+    template <typename Dense>
+    double locateEvent(const ODE45Event<State>& event, double tOld, double tNew,
+                       double gOld, double gNew, Dense& dense, State& yDense) const {
+        double a = 0.0, ga = gOld;
+        double b = 1.0, gb = gNew;
+        const double tolTheta = 4.0 * std::numeric_limits<double>::epsilon()
+                              * std::max(1.0, std::abs(tNew)) / (tNew - tOld);
+        int side = 0;
+
+        for (int iter = 0; iter < 100 && (b - a) > tolTheta; ++iter) {
+            const double theta = std::clamp((a * gb - b * ga) / (gb - ga), a, b);
+            dense(theta, yDense);
+            const double g = event.condition(tOld + theta * (tNew - tOld), yDense);
+            if (g == 0.0) return theta;
+            if ((g < 0.0) == (gb < 0.0)) {
+                b = theta; gb = g;
+                if (side == -1) ga *= 0.5;   // Illinois: dimezza l'estremo rimasto fermo
+                side = -1;
+            } else {
+                a = theta; ga = g;
+                if (side == +1) gb *= 0.5;
+                side = +1;
+            }
+        }
+        return b;
+    }
+
+    /**
+     * @brief Records the events of an accepted step and emits its output points.
+     * @param sink Output callable sink(t, y).
+     * @param dense Step interpolant dense(theta, out) on [tOld, tNew].
+     * @param yDense Scratch buffer.
+     * @param last True if tNew is the end of the integration interval.
+     * @return true if a terminal event stopped the integration inside the step.
+     */
+    template <typename Sink, typename Dense>
+    bool acceptStep(Sink& sink, double tOld, double tNew, const State& yNew,
+                    Dense&& dense, State& yDense, bool last) {
+        double tEnd = tNew;
+        const State* yEnd = &yNew;
+
+        if (!events.empty()) {
+            // Eventi attivati nel passo, ordinati per istante
+            std::vector<std::pair<double, size_t>> triggered;
+            for (size_t i = 0; i < events.size(); ++i) {
+                const double gNew = events[i].condition(tNew, yNew);
+                if (crossed(eventValues[i], gNew, events[i].direction))
+                    triggered.emplace_back(locateEvent(events[i], tOld, tNew, eventValues[i], gNew, dense, yDense), i);
+                eventValues[i] = gNew;
+            }
+            std::sort(triggered.begin(), triggered.end());
+
+            for (const auto& [theta, i] : triggered) {
+                dense(theta, yEvent);
+                eventTimes.push_back(tOld + theta * (tNew - tOld));
+                eventStates.push_back(yEvent);
+                eventIndices.push_back(i);
+                if (events[i].terminal) {
+                    terminated = true;
+                    tEnd = eventTimes.back();
+                    yEnd = &yEvent;
+                    break;
+                }
+            }
+        }
+
+        const double thetaEnd = (tEnd - tOld) / (tNew - tOld);
+        emitStep(sink, tOld, tEnd, *yEnd,
+                 [&](double theta, State& out) { dense(theta * thetaEnd, out); },
+                 yDense, last || terminated, terminated);
+
+        if (terminated) finish(tEnd, *yEnd);
+        return terminated;
+    }
+
+    /**
+     * @brief Validates the integration interval and options.
+     */
+    void validate() const {
+        if (tf <= t0) throw std::invalid_argument("ODE45: tf deve essere > t0");
+        if (options.mode == ODE45Mode::FIXED_STEP_RK4 && dt <= 0)
+            throw std::invalid_argument("ODE45: dt deve essere > 0");
+        if (options.mode != ODE45Mode::FIXED_STEP_RK4 && (options.relTol <= 0 || options.absTol < 0))
+            throw std::invalid_argument("ODE45: tolleranze non valide");
+#ifndef EIGEN_WORLD_VERSION
+        if (options.mode == ODE45Mode::STIFF_ROSENBROCK23)
+            throw std::invalid_argument("ODE45: STIFF_ROSENBROCK23 richiede Eigen incluso prima di ODE45.h");
+#endif
+    }
+
 public:
     /// @brief Builds the solver from any compatible callable.
-    /// @tparam Func  Callable type (lambda, function, functor, std::function)
-    /// @param  func  dy/dt = func(t, y)
+    /// @tparam F     Callable type (lambda, function, functor, std::function)
+    /// @param  func  dy/dt = func(t, y)  oppure  func(t, y, dydt)
     /// @param  t0    Initial time
     /// @param  tf    Final time
     /// @param  y0    Initial condition
     /// @param  dt    Integration step (default 0.01)
-    template <typename Func>
-    ODE45(Func&& func, double t0, double tf, const State& y0, double dt = 0.01)
-        : f(std::forward<Func>(func)), t0(t0), tf(tf), y0(y0), dt(dt)
+    template <typename F>
+    ODE45(F&& func, double t0, double tf, const State& y0, double dt = 0.01)
+        : f(std::forward<F>(func)), t0(t0), tf(tf), dt(dt), y0(y0)
     {
         if (dt <= 0)  throw std::invalid_argument("ODE45: dt deve essere > 0");
         if (tf <= t0) throw std::invalid_argument("ODE45: tf deve essere > t0");
+        options.dt = dt;
+        solve();
+    }
+
+    /// @brief Builds the solver with explicit integration options.
+    /// @tparam F       Callable type (lambda, function, functor, std::function)
+    /// @param  func    dy/dt = func(t, y)  oppure  func(t, y, dydt)
+    /// @param  t0      Initial time
+    /// @param  tf      Final time
+    /// @param  y0      Initial condition
+    /// @param  options Integrator mode, tolerances and step limits
+    template <typename F>
+    ODE45(F&& func, double t0, double tf, const State& y0, const ODE45Options& options)
+        : f(std::forward<F>(func)), t0(t0), tf(tf), dt(options.dt), y0(y0), options(options)
+    {
+        validate();
+        solve();
+    }
+
+    /// @brief Builds the solver with event functions.
+    /// @tparam F       Callable type (lambda, function, functor, std::function)
+    /// @param  func    dy/dt = func(t, y)  oppure  func(t, y, dydt)
+    /// @param  t0      Initial time
+    /// @param  tf      Final time
+    /// @param  y0      Initial condition
+    /// @param  options Integrator mode, tolerances, step limits and output policy
+    /// @param  events  Events to detect; a terminal event stops the integration
+    template <typename F>
+    ODE45(F&& func, double t0, double tf, const State& y0, const ODE45Options& options,
+          std::vector<ODE45Event<State>> events)
+        : f(std::forward<F>(func)), t0(t0), tf(tf), dt(options.dt), y0(y0), options(options),
+          events(std::move(events))
+    {
+        validate();
         solve();
     }
 
+    /// @brief Builds the solver and streams the output points to an observer.
+    /// @tparam F        Callable type (lambda, function, functor, std::function)
+    /// @tparam Observer Callable observer(double t, const State& y)
+    /// @param  func     dy/dt = func(t, y)  oppure  func(t, y, dydt)
+    /// @param  t0       Initial time
+    /// @param  tf       Final time
+    /// @param  y0       Initial condition
+    /// @param  options  Integrator mode, tolerances, step limits and output policy
+    /// @param  observer Receives every output point; getT()/getY() stay empty
+    template <typename F, typename Observer,
+              typename = std::enable_if_t<std::is_invocable_v<Observer&, double, const State&>>>
+    ODE45(F&& func, double t0, double tf, const State& y0, const ODE45Options& options, Observer&& observer)
+        : f(std::forward<F>(func)), t0(t0), tf(tf), dt(options.dt), y0(y0), options(options)
+    {
+        validate();
+        solve(observer);
+    }
+
+    /// @brief Builds the solver with event functions and streams the output to an observer.
+    template <typename F, typename Observer>
+    ODE45(F&& func, double t0, double tf, const State& y0, const ODE45Options& options,
+          std::vector<ODE45Event<State>> events, Observer&& observer)
+        : f(std::forward<F>(func)), t0(t0), tf(tf), dt(options.dt), y0(y0), options(options),
+          events(std::move(events))
+    {
+        validate();
+        solve(observer);
+    }
+
     /// @brief Riesegue l'integrazione (es. dopo aver cambiato parametri).
     // void solve() {
     //     tVec.clear();
@@ -185,36 +738,463 @@ public:
     // }
 
     /**
-     * @brief Runs RK4 integration from t0 to tf.
+     * @brief Runs the integration from t0 to tf, storing the output points in getT()/getY().
      */
     void solve() {
-    tVec.clear();
-    yVec.clear();
+        tVec.clear();
+        yVec.clear();
+        if (options.output == ODE45Output::ALL_STEPS && options.mode == ODE45Mode::FIXED_STEP_RK4) {
+            // Il numero di campioni è noto a priori: una sola allocazione per getT()/getY()
+            const size_t nSamples = static_cast<size_t>(std::ceil((tf - t0) / dt)) + 2;
+            tVec.reserve(nSamples);
+            yVec.reserve(nSamples);
+        }
+        auto store = [this](double t, const State& y) {
+            tVec.push_back(t);
+            yVec.push_back(y);
+        };
+        run(store);
+    }
+
+    /**
+     * @brief Runs the integration from t0 to tf, streaming the output points to an observer.
+     * @param observer Callable observer(double t, const State& y); nothing is stored.
+     */
+    template <typename Observer>
+    void solve(Observer&& observer) {
+        tVec.clear();
+        yVec.clear();
+        run(observer);
+    }
+
+private:
+    /**
+     * @brief Dispatches the integration to the selected stepper.
+     * @param sink Output callable sink(t, y).
+     */
+    template <typename Sink>
+    void run(Sink& sink) {
+        acceptedSteps = rejectedSteps = functionEvaluations = 0;
+        jacobianEvaluations = luDecompositions = 0;
+        beginOutput();
+        beginEvents(t0, y0);
+        Traits::assign(yEvent, y0);
 
+        switch (options.mode) {
+        case ODE45Mode::ADAPTIVE_DOPRI5:
+            solveAdaptive(sink);
+            break;
+#ifdef EIGEN_WORLD_VERSION
+        case ODE45Mode::STIFF_ROSENBROCK23:
+            solveStiff(sink);
+            break;
+#endif
+        default:
+            solveFixedStep(sink);
+            break;
+        }
+    }
+
+    /**
+     * @brief Classical RK4 with constant step dt.
+     *
+     * The derivative at the end of a step is the first stage of the next one, so it
+     * is also available for the cubic Hermite dense output at no extra cost.
+     */
+    template <typename Sink>
+    void solveFixedStep(Sink& sink) {
     double t = t0;
     State  y = y0;
 
-    // Salva la condizione iniziale
-    tVec.push_back(t);
-    yVec.push_back(y);
+    // Buffer preallocati: stadi, stato intermedio, inizio passo e dense output
+    State k1 = Traits::zero(y0), k2 = k1, k3 = k1, k4 = k1, yStage = k1, yOld = k1, yDense = k1;
+
+    // Condizione iniziale
+    emitInitial(sink, t, y);
+
+    evaluate(t, y, k1);
 
     while (t < tf - dt * 1e-9) {
-        State k1 = f(t,        y);
-        State k2 = f(t + dt/2, add(y, scale(dt/2, k1)));
-        State k3 = f(t + dt/2, add(y, scale(dt/2, k2)));
-        State k4 = f(t + dt,   add(y, scale(dt,   k3)));
-
-        y = add(y, scale(dt/6.0,
-                add(add(k1, scale(2.0, k2)),
-                    add(scale(2.0, k3), k4))));
+        Traits::assign(yOld, y);
+        const double tOld = t;
+
+        combine(yStage, y, {{dt/2, &k1}});
+        evaluate(t + dt/2, yStage, k2);
+        combine(yStage, y, {{dt/2, &k2}});
+        evaluate(t + dt/2, yStage, k3);
+        combine(yStage, y, {{dt,   &k3}});
+        evaluate(t + dt,   yStage, k4);
+
+        Traits::axpy(dt/6.0, k1, y);
+        Traits::axpy(dt/3.0, k2, y);
+        Traits::axpy(dt/3.0, k3, y);
+        Traits::axpy(dt/6.0, k4, y);
         t += dt;
+        acceptedSteps += 1;
 
-        // Salva DOPO l'aggiornamento
-        tVec.push_back(t);
-        yVec.push_back(y);  // ← ora getY().back() = y(tf) ✓
+        // Derivata nel nuovo punto: primo stadio del passo successivo
+        evaluate(t, y, k2);
+
+        // Output DOPO l'aggiornamento (con ALL_STEPS getY().back() = y(tf) ✓)
+        const double h = t - tOld;
+        const bool stop = acceptStep(sink, tOld, t, y, [&](double theta, State& out) {
+            // Hermite cubico su (yOld, k1) – (y, k2)
+            const double th2 = theta * theta, th3 = th2 * theta;
+            combine(out, yOld, {{-3.0*th2 + 2.0*th3, &yOld}, {h * (th3 - 2.0*th2 + theta), &k1},
+                                {3.0*th2 - 2.0*th3, &y}, {h * (th3 - th2), &k2}});
+        }, yDense, t >= tf - dt * 1e-9);
+
+        if (stop) return;   // evento terminale: finish() già chiamato
+
+        std::swap(k1, k2);
     }
+
+    finish(t, y);
 }
 
+    /**
+     * @brief Weighted error norm of a state through StateTraits.
+     */
+    double errorNorm(const State& err, const State& yOld, const State& yNew) const {
+        return Traits::errorNorm(err, yOld, yNew, options.absTol, options.relTol);
+    }
+
+    /**
+     * @brief Initial step estimate (Hairer, Nørsett & Wanner, Solving ODE I, II.4).
+     * @param y  Initial state.
+     * @param k1 Derivative at (t0, y).
+     * @param hMax Largest admissible step.
+     * @param yStage Scratch state buffer.
+     * @param kStage Scratch derivative buffer.
+     * @return Initial step size.
+     */
+    double initialStep(const State& y, const State& k1, double hMax, State& yStage, State& kStage) {
+        const double d0 = errorNorm(y, y, y);
+        const double d1 = errorNorm(k1, y, y);
+        double h0 = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+        h0 = std::min(h0, hMax);
+
+        combine(yStage, y, {{h0, &k1}});
+        evaluate(t0 + h0, yStage, kStage);
+        Traits::axpy(-1.0, k1, kStage);
+        const double d2 = errorNorm(kStage, y, y) / h0;
+
+        const double dMax = std::max(d1, d2);
+        const double h1 = (dMax <= 1e-15) ? std::max(1e-6, 1e-3 * h0)
+                                          : std::pow(0.01 / dMax, 1.0 / 5.0);
+        return std::min({100.0 * h0, h1, hMax});
+    }
+
+    /**
+     * @brief Dormand-Prince 5(4) with embedded error estimate, FSAL and step-size control.
+     *
+     * The 5th-order solution is propagated (local extrapolation). The last stage of an
+     * accepted step is the derivative at the new point and is reused as the first stage
+     * of the next one (First Same As Last), so each accepted step costs 6 evaluations.
+     */
+    template <typename Sink>
+    void solveAdaptive(Sink& sink) {
+        // Tableau di Dormand-Prince
+        constexpr double c2 = 1.0/5.0, c3 = 3.0/10.0, c4 = 4.0/5.0, c5 = 8.0/9.0;
+        constexpr double a21 = 1.0/5.0;
+        constexpr double a31 = 3.0/40.0,       a32 = 9.0/40.0;
+        constexpr double a41 = 44.0/45.0,      a42 = -56.0/15.0,      a43 = 32.0/9.0;
+        constexpr double a51 = 19372.0/6561.0, a52 = -25360.0/2187.0, a53 = 64448.0/6561.0, a54 = -212.0/729.0;
+        constexpr double a61 = 9017.0/3168.0,  a62 = -355.0/33.0,     a63 = 46732.0/5247.0, a64 = 49.0/176.0,  a65 = -5103.0/18656.0;
+        constexpr double b1  = 35.0/384.0,     b3  = 500.0/1113.0,    b4  = 125.0/192.0,    b5  = -2187.0/6784.0, b6 = 11.0/84.0;
+        // Differenza tra soluzione di ordine 5 e di ordine 4 (stima dell'errore)
+        constexpr double e1 = 71.0/57600.0,    e3 = -71.0/16695.0,    e4 = 71.0/1920.0,     e5 = -17253.0/339200.0,
+                         e6 = 22.0/525.0,      e7 = -1.0/40.0;
+        // Interpolante continua di ordine 4 (Hairer, Nørsett & Wanner, dopri5)
+        constexpr double d1 = -12715105075.0/11282082432.0, d3 = 87487479700.0/32700410799.0,
+                         d4 = -10690763975.0/1880347072.0,  d5 = 701980252875.0/199316789632.0,
+                         d6 = -1453857185.0/822651844.0,    d7 = 69997945.0/29380423.0;
+
+        // Controllo del passo
+        constexpr double safety = 0.9, facMin = 0.2, facMax = 10.0;
+
+        const double span = tf - t0;
+        const double hMax = options.maxStep > 0.0 ? std::min(options.maxStep, span) : span;
+        const double hMin = 16.0 * std::numeric_limits<double>::epsilon() * std::max(std::abs(t0), std::abs(tf));
+
+        double t = t0;
+        State  y = y0;
+
+        // Buffer preallocati: 7 stadi, stato intermedio, nuovo stato ed errore
+        State k1 = Traits::zero(y0), k2 = k1, k3 = k1, k4 = k1, k5 = k1, k6 = k1, k7 = k1;
+        State yStage = k1, yNew = k1, err = k1, yDense = k1;
+
+        emitInitial(sink, t, y);
+
+        evaluate(t, y, k1);
+
+        double h = options.initialStep > 0.0 ? std::min(options.initialStep, hMax)
+                                             : initialStep(y, k1, hMax, yStage, k2);
+        bool rejectedLast = false;
+        size_t attempts = 0;
+
+        while (t < tf) {
+            if (++attempts > options.maxSteps)
+                throw std::runtime_error("ODE45: raggiunto il numero massimo di passi");
+
+            // Ultimo passo: atterra esattamente su tf
+            if (t + h >= tf || tf - (t + h) < hMin) h = tf - t;
+
+            combine(yStage, y, {{h*a21, &k1}});
+            evaluate(t + c2*h, yStage, k2);
+            combine(yStage, y, {{h*a31, &k1}, {h*a32, &k2}});
+            evaluate(t + c3*h, yStage, k3);
+            combine(yStage, y, {{h*a41, &k1}, {h*a42, &k2}, {h*a43, &k3}});
+            evaluate(t + c4*h, yStage, k4);
+            combine(yStage, y, {{h*a51, &k1}, {h*a52, &k2}, {h*a53, &k3}, {h*a54, &k4}});
+            evaluate(t + c5*h, yStage, k5);
+            combine(yStage, y, {{h*a61, &k1}, {h*a62, &k2}, {h*a63, &k3}, {h*a64, &k4}, {h*a65, &k5}});
+            evaluate(t + h,    yStage, k6);
+            combine(yNew,   y, {{h*b1, &k1}, {h*b3, &k3}, {h*b4, &k4}, {h*b5, &k5}, {h*b6, &k6}});
+            evaluate(t + h,    yNew,   k7);
+
+            Traits::assign(err, k1);
+            Traits::scaleInPlace(h*e1, err);
+            Traits::axpy(h*e3, k3, err);
+            Traits::axpy(h*e4, k4, err);
+            Traits::axpy(h*e5, k5, err);
+            Traits::axpy(h*e6, k6, err);
+            Traits::axpy(h*e7, k7, err);
+            const double errNorm = errorNorm(err, y, yNew);
+
+            if (!std::isfinite(errNorm))
+                throw std::runtime_error("ODE45: stima dell'errore non finita");
+
+            if (errNorm <= 1.0) {
+                // Passo accettato
+                const double tOld = t;
+                t = (h == tf - t) ? tf : t + h;
+                acceptedSteps += 1;
+
+                // Output prima dello swap: servono y (inizio passo) e gli stadi k1..k7
+                const bool stop = acceptStep(sink, tOld, t, yNew, [&](double theta, State& out) {
+                    // y(θ) = y + θ(r2 + (1-θ)(r3 + θ(r4 + (1-θ) r5))), con
+                    // r2 = yNew - y, r3 = h k1 - r2, r4 = r2 - h k7 - r3, r5 = h Σ d_i k_i
+                    const double a = theta, b = 1.0 - theta;
+                    // Espandendo r2..r4: y(θ) = y + cR2 (yNew - y) + h cK1 k1 + h cK7 k7 + cR5 r5
+                    const double cR2 = a - a * b + 2.0 * a * a * b;
+                    const double cK1 = a * b - a * a * b;
+                    const double cK7 = -a * a * b;
+                    const double cR5 = a * a * b * b;
+                    combine(out, y, {{-cR2, &y}, {cR2, &yNew},
+                                     {h * (cK1 + cR5 * d1), &k1}, {h * (cK7 + cR5 * d7), &k7},
+                                     {h * cR5 * d3, &k3}, {h * cR5 * d4, &k4},
+                                     {h * cR5 * d5, &k5}, {h * cR5 * d6, &k6}});
+                }, yDense, t >= tf);
+
+                if (stop) return;   // evento terminale: finish() già chiamato
+
+                std::swap(y, yNew);
+                std::swap(k1, k7);   // FSAL
+
+                double fac = errNorm == 0.0 ? facMax : safety * std::pow(errNorm, -1.0/5.0);
+                fac = std::clamp(fac, facMin, rejectedLast ? 1.0 : facMax);
+                h = std::min(h * fac, hMax);
+                rejectedLast = false;
+            } else {
+                // Passo rifiutato: riduce h e riprova dallo stesso punto
+                rejectedSteps += 1;
+                h *= std::max(facMin, safety * std::pow(errNorm, -1.0/5.0));
+                rejectedLast = true;
+                if (h < hMin)
+                    throw std::runtime_error("ODE45: passo sotto il minimo ammissibile");
+            }
+        }
+
+        finish(t, y);
+    }
+
+#ifdef EIGEN_WORLD_VERSION
+    /**
+     * @brief Finite-difference Jacobian J = df/dy at (t, y).
+     * @param fy f(t, y), already available.
+     * @param yPert, fPert Scratch buffers.
+     */
+    void jacobian(double t, const State& y, const State& fy, Eigen::MatrixXd& J,
+                  State& yPert, State& fPert) {
+        const size_t n = Traits::dimension(y);
+        const double sqrtEps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+        Traits::assign(yPert, y);
+        double* yp = Traits::data(yPert);
+        for (size_t j = 0; j < n; ++j) {
+            const double yj = yp[j];
+            const double delta = sqrtEps * std::max(std::abs(yj), 1.0);
+            yp[j] = yj + delta;
+            evaluate(t, yPert, fPert);
+            yp[j] = yj;
+
+            const double* fp = Traits::data(fPert);
+            const double* f0 = Traits::data(fy);
+            for (size_t i = 0; i < n; ++i)
+                J(static_cast<Eigen::Index>(i), static_cast<Eigen::Index>(j)) = (fp[i] - f0[i]) / delta;
+        }
+        jacobianEvaluations += 1;
+    }
+
+    /**
+     * @brief Finite-difference time derivative fT = df/dt at (t, y) (non-autonomous systems).
+     * @param fy f(t, y), already available.
+     * @param fPert Scratch buffer.
+     */
+    void timeDerivative(double t, const State& y, const State& fy, State& fT, State& fPert) {
+        const double deltaT = std::sqrt(std::numeric_limits<double>::epsilon()) * std::max(std::abs(t), 1.0);
+        evaluate(t + deltaT, y, fPert);
+        Traits::assign(fT, fPert);
+        Traits::axpy(-1.0, fy, fT);
+        Traits::scaleInPlace(1.0 / deltaT, fT);
+    }
+
+    /**
+     * @brief Solves (I - h d J) x = b with the current LU factorization.
+     */
+    static void solveLinear(const Eigen::PartialPivLU<Eigen::MatrixXd>& lu, const State& b, State& x) {
+        const Eigen::Index n = static_cast<Eigen::Index>(Traits::dimension(b));
+        Eigen::Map<Eigen::VectorXd>(Traits::data(x), n) = lu.solve(Eigen::Map<const Eigen::VectorXd>(Traits::data(b), n));
+    }
+
+    /**
+     * @brief Linearly implicit Rosenbrock 2(3) (Shampine & Reichelt, MATLAB ode23s) for stiff systems.
+     *
+     * Each step solves three linear systems with the matrix W = I - h d J and costs two
+     * evaluations of f (the third stage is the derivative at the new point and is reused
+     * as the first stage of the next step). J is reused over several accepted steps and
+     * W is refactorized only when h changes.
+     */
+    template <typename Sink>
+    void solveStiff(Sink& sink) {
+        const double d   = 1.0 / (2.0 + std::sqrt(2.0));
+        const double e32 = 6.0 + std::sqrt(2.0);
+
+        // Controllo del passo (errore locale di ordine 3)
+        constexpr double safety = 0.8, facMin = 0.2, facMax = 5.0;
+
+        const double span = tf - t0;
+        const double hMax = options.maxStep > 0.0 ? std::min(options.maxStep, span) : span;
+        const double hMin = 16.0 * std::numeric_limits<double>::epsilon() * std::max(std::abs(t0), std::abs(tf));
+        const size_t reuse = std::max<size_t>(options.jacobianReuse, 1);
+
+        double t = t0;
+        State  y = y0;
+
+        // Buffer preallocati
+        State F0 = Traits::zero(y0), F1 = F0, F2 = F0, k1 = F0, k2 = F0, k3 = F0, fT = F0;
+        State yStage = F0, yNew = F0, rhs = F0, err = F0, yDense = F0;
+
+        const Eigen::Index n = static_cast<Eigen::Index>(Traits::dimension(y0));
+        Eigen::MatrixXd J(n, n), W(n, n);
+        Eigen::PartialPivLU<Eigen::MatrixXd> lu(n);
+
+        emitInitial(sink, t, y);
+
+        evaluate(t, y, F0);
+        jacobian(t, y, F0, J, yStage, F1);
+        timeDerivative(t, y, F0, fT, F1);
+        size_t jacobianAge = 0;      // Passi accettati dall'ultimo Jacobiano
+        double hFactored = 0.0;      // Passo per cui vale la fattorizzazione di W
+
+        double h = options.initialStep > 0.0 ? std::min(options.initialStep, hMax)
+                                             : initialStep(y, F0, hMax, yStage, F1);
+        bool rejectedLast = false;
+        size_t attempts = 0;
+
+        while (t < tf) {
+            if (++attempts > options.maxSteps)
+                throw std::runtime_error("ODE45: raggiunto il numero massimo di passi");
+
+            // Ultimo passo: atterra esattamente su tf
+            if (t + h >= tf || tf - (t + h) < hMin) h = tf - t;
+
+            if (h != hFactored) {
+                W = -h * d * J;
+                W.diagonal().array() += 1.0;
+                lu.compute(W);
+                hFactored = h;
+                luDecompositions += 1;
+            }
+
+            // k1 = W⁻¹ (F0 + h d fT)
+            combine(rhs, F0, {{h * d, &fT}});
+            solveLinear(lu, rhs, k1);
+
+            // k2 = W⁻¹ (F1 - k1) + k1
+            combine(yStage, y, {{0.5 * h, &k1}});
+            evaluate(t + 0.5 * h, yStage, F1);
+            combine(rhs, F1, {{-1.0, &k1}});
+            solveLinear(lu, rhs, k2);
+            Traits::axpy(1.0, k1, k2);
+
+            // Soluzione di ordine 2
+            combine(yNew, y, {{h, &k2}});
+            evaluate(t + h, yNew, F2);
+
+            // k3 = W⁻¹ (F2 - e32 (k2 - F1) - 2 (k1 - F0) + h d fT)
+            combine(rhs, F2, {{-e32, &k2}, {e32, &F1}, {-2.0, &k1}, {2.0, &F0}, {h * d, &fT}});
+            solveLinear(lu, rhs, k3);
+
+            // err = h/6 (k1 - 2 k2 + k3)
+            combine(err, k1, {{-2.0, &k2}, {1.0, &k3}});
+            Traits::scaleInPlace(h / 6.0, err);
+            const double errNorm = errorNorm(err, y, yNew);
+
+            if (!std::isfinite(errNorm))
+                throw std::runtime_error("ODE45: stima dell'errore non finita");
+
+            if (errNorm <= 1.0) {
+                // Passo accettato
+                const double tOld = t;
+                t = (h == tf - t) ? tf : t + h;
+                acceptedSteps += 1;
+
+                const bool stop = acceptStep(sink, tOld, t, yNew, [&](double theta, State& out) {
+                    // Interpolante quadratica di ode23s
+                    const double c1 = theta * (1.0 - theta) / (1.0 - 2.0 * d);
+                    const double c2 = theta * (theta - 2.0 * d) / (1.0 - 2.0 * d);
+                    combine(out, y, {{h * c1, &k1}, {h * c2, &k2}});
+                }, yDense, t >= tf);
+
+                if (stop) return;   // evento terminale: finish() già chiamato
+
+                std::swap(y, yNew);
+                std::swap(F0, F2);   // f(t, y) del nuovo punto
+                if (t < tf) timeDerivative(t, y, F0, fT, F1);
+
+                if (++jacobianAge >= reuse && t < tf) {
+                    jacobian(t, y, F0, J, yStage, F1);
+                    jacobianAge = 0;
+                    hFactored = 0.0;
+                }
+
+                double fac = errNorm == 0.0 ? facMax : safety * std::pow(errNorm, -1.0/3.0);
+                fac = std::clamp(fac, facMin, rejectedLast ? 1.0 : facMax);
+                h = std::min(h * fac, hMax);
+                rejectedLast = false;
+            } else {
+                // Passo rifiutato: con uno Jacobiano vecchio lo si ricalcola prima di ridurre h
+                rejectedSteps += 1;
+                if (jacobianAge > 0) {
+                    jacobian(t, y, F0, J, yStage, F1);
+                    jacobianAge = 0;
+                    hFactored = 0.0;
+                }
+                h *= std::max(facMin, safety * std::pow(errNorm, -1.0/3.0));
+                rejectedLast = true;
+                if (h < hMin)
+                    throw std::runtime_error("ODE45: passo sotto il minimo ammissibile");
+            }
+        }
+
+        finish(t, y);
+    }
+#endif // EIGEN_WORLD_VERSION
+
+public:
+
     /**
      * @brief Returns sampled time values.
      * @return Constant reference to the time vector.
@@ -232,45 +1212,122 @@ public:
      * @return Sample count.
      */
     size_t size()                     const { return tVec.size(); }
+
+    /**
+     * @brief Returns the time reached by the last integration (always tf on success).
+     * @return Final time.
+     */
+    double getFinalTime() const { return tFinal; }
+
+    /**
+     * @brief Returns the state reached by the last integration, for every output policy.
+     * @return Constant reference to the final state.
+     */
+    const State& getFinalState() const { return yFinal; }
+
+    /**
+     * @brief Returns the times of the detected events, in chronological order.
+     * @return Constant reference to the event times.
+     */
+    const std::vector<double>& getEventTimes() const { return eventTimes; }
+
+    /**
+     * @brief Returns the states at the detected events.
+     * @return Constant reference to the event states.
+     */
+    const std::vector<State>& getEventStates() const { return eventStates; }
+
+    /**
+     * @brief Returns, for each detected event, its index in the events vector.
+     * @return Constant reference to the event indices.
+     */
+    const std::vector<size_t>& getEventIndices() const { return eventIndices; }
+
+    /**
+     * @brief Tells whether the last integration was stopped by a terminal event.
+     * @return true if stopped before tf by a terminal event.
+     */
+    bool isTerminatedByEvent() const { return terminated; }
+
+    /**
+     * @brief Returns the number of accepted steps of the last integration.
+     * @return Accepted step count.
+     */
+    size_t getNumberOfAcceptedSteps() const { return acceptedSteps; }
+
+    /**
+     * @brief Returns the number of rejected steps of the last integration (adaptive mode).
+     * @return Rejected step count.
+     */
+    size_t getNumberOfRejectedSteps() const { return rejectedSteps; }
+
+    /**
+     * @brief Returns the number of right-hand side evaluations of the last integration.
+     * @return Function evaluation count.
+     */
+    size_t getNumberOfFunctionEvaluations() const { return functionEvaluations; }
+
+    /**
+     * @brief Returns the number of Jacobian evaluations of the last integration (stiff mode).
+     * @return Jacobian evaluation count.
+     */
+    size_t getNumberOfJacobianEvaluations() const { return jacobianEvaluations; }
+
+    /**
+     * @brief Returns the number of LU decompositions of the last integration (stiff mode).
+     * @return LU decomposition count.
+     */
+    size_t getNumberOfLUDecompositions() const { return luDecompositions; }
 };
 
 
 // =============================================================================
 //  DEDUCTION GUIDES  (C++17 — CTAD)
 //
-//  Permettono di scrivere  ODE45(...)  senza  ODE45<State>(...).
-//  Il compilatore deduce State in due passaggi:
+//  Permettono di scrivere  ODE45(...)  senza  ODE45<State, Func>(...).
+//  Il compilatore deduce i due parametri template:
 //
-//  GUIDA 1 — da y0
+//  State — dalla condizione iniziale y0
 //  ┌─────────────────────────────────────────────────────────────────┐
 //  │  ODE45 s(func, 0, 10, 1.0, 0.01);                              │
 //  │                       ^^^                                       │
-//  │  y0 è double  →  State = double  →  ODE45<double>              │
+//  │  y0 è double  →  State = double                                │
 //  └─────────────────────────────────────────────────────────────────┘
 //
-//  GUIDA 2 — dal tipo di ritorno di Func
+//  Func — dal tipo del callable passato (decay di lambda/funzione/functor)
 //  ┌─────────────────────────────────────────────────────────────────┐
-//  │  ODE45 s(func, 0, 10, std::vector{1.0, 0.0}, 0.01);            │
-//  │          ^^^^                                                   │
-//  │  func ritorna vector<double>                                    │
-//  │  → State = invoke_result_t<Func, double, const vector<double>&> │
-//  │  → ODE45<vector<double>>                                        │
+//  │  ODE45 s(eqMoto, 0, 10, std::vector{1.0, 0.0}, 0.01);          │
+//  │          ^^^^^^                                                 │
+//  │  Func = std::decay_t<decltype(eqMoto)>  (niente std::function)  │
 //  └─────────────────────────────────────────────────────────────────┘
 //
-//  Le due guide devono concordare: se y0 è double ma func ritorna
-//  vector<double>, il compilatore emette un errore di deduzione.
+//  Se func non è compatibile con State (né per valore né in-place), il
+//  compilatore emette un errore all'interno di evaluate().
 // =============================================================================
 
-// GUIDA UNICA: State dedotto dalla condizione iniziale y0
-//
-//  ODE45 s(func, 0, 10, 1.0, 0.01)        → ODE45<double>
-//  ODE45 s(func, 0, 20, std::vector{...}) → ODE45<vector<double>>
-//  ODE45 s(func, 0, 20, y0_eigen)         → ODE45<Eigen::VectorXd>
-//
-//  Una sola guida elimina ogni ambiguità: State è sempre il tipo di y0.
+//  ODE45 s(func, 0, 10, 1.0, 0.01)        → ODE45<double, Func>
+//  ODE45 s(func, 0, 20, std::vector{...}) → ODE45<vector<double>, Func>
+//  ODE45 s(func, 0, 20, y0_eigen)         → ODE45<Eigen::VectorXd, Func>
 template <typename Func, typename State>
 ODE45(Func&&, double, double, const State&, double = 0.01)
-    -> ODE45<State>;
+    -> ODE45<State, std::decay_t<Func>>;
+
+template <typename Func, typename State>
+ODE45(Func&&, double, double, const State&, const ODE45Options&)
+    -> ODE45<State, std::decay_t<Func>>;
+
+template <typename Func, typename State, typename Observer,
+          typename = std::enable_if_t<std::is_invocable_v<Observer&, double, const State&>>>
+ODE45(Func&&, double, double, const State&, const ODE45Options&, Observer&&)
+    -> ODE45<State, std::decay_t<Func>>;
+
+template <typename Func, typename State>
+ODE45(Func&&, double, double, const State&, const ODE45Options&, std::vector<ODE45Event<State>>)
+    -> ODE45<State, std::decay_t<Func>>;
+
+template <typename Func, typename State, typename Observer>
+ODE45(Func&&, double, double, const State&, const ODE45Options&, std::vector<ODE45Event<State>>, Observer&&)
+    -> ODE45<State, std::decay_t<Func>>;
 
 
 // =============================================================================
@@ -286,19 +1343,22 @@ ODE45(Func&&, double, double, const State&, double = 0.01)
 //      Eigen::VectorXd y0(2);
 //      y0 << 1.0, 0.0;
 //
-//      ODE45 s(eqMoto, 0.0, 20.0, y0, 0.01);   // deduce ODE45<VectorXd>
+//      ODE45 s(eqMoto, 0.0, 20.0, y0, 0.01);   // deduce ODE45<VectorXd, ...>
 //      double x   = s.getY()[i][0];
 //      double vel = s.getY()[i][1];
 //
+//  Vale per qualsiasi Eigen::Matrix<double, N, 1>: con N fisso (es.
+//  Eigen::Matrix<double, 12, 1> per il 6-DOF) lo stato non usa l'heap.
+//
 //  Se Eigen non è incluso, questo blocco viene ignorato completamente.
 // =============================================================================
 
 #ifdef EIGEN_WORLD_VERSION   // macro definita da <Eigen/Core> e <Eigen/Dense>
 
-template <>
-struct StateTraits<Eigen::VectorXd> {
+template <int N>
+struct StateTraits<Eigen::Matrix<double, N, 1>> {
 
-    using State = Eigen::VectorXd;
+    using State = Eigen::Matrix<double, N, 1>;
 
     /// Vettore zero della stessa dimensione di ref
     static State zero(const State& ref) {
@@ -316,14 +1376,38 @@ struct StateTraits<Eigen::VectorXd> {
     static State scale(double s, const State& v) {
         return s * v;
     }
-};
 
-// Deduction guide per Eigen::VectorXd
-// Rende possibile  ODE45 s(func, t0, tf, y0_eigen, dt)  senza <VectorXd>
-template <typename Func>
-ODE45(Func&&, double, double, const Eigen::VectorXd&, double = 0.01)
-    -> ODE45<Eigen::VectorXd>;
+    /// dst = src — nessuna riallocazione se le dimensioni coincidono
+    static void assign(State& dst, const State& src) {
+        dst = src;
+    }
+
+    /// y += a * x — espressione Eigen valutata senza temporanei
+    static void axpy(double a, const State& x, State& y) {
+        y.noalias() += a * x;
+    }
+
+    /// v *= s
+    static void scaleInPlace(double s, State& v) {
+        v *= s;
+    }
+
+    /// Norma RMS pesata dell'errore locale (modalità adattiva)
+    static double errorNorm(const State& err, const State& yOld, const State& yNew,
+                            double absTol, double relTol) {
+        if (err.size() == 0) return 0.0;
+        return std::sqrt((err.array() / (absTol + relTol * yOld.array().abs().max(yNew.array().abs())))
+                             .square().mean());
+    }
+
+    /// Numero di componenti
+    static size_t dimension(const State& v) { return static_cast<size_t>(v.size()); }
+
+    /// Puntatore ai componenti (storage contiguo)
+    static double*       data(State& v)       { return v.data(); }
+    static const double* data(const State& v) { return v.data(); }
+};
 
 #endif // EIGEN_WORLD_VERSION
 
-#endif // ODE45_H
\ No newline at end of file
+#endif // ODE45_H
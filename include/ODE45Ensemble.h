@@ -0,0 +1,525 @@
+#ifndef ODE45_ENSEMBLE_H
+#define ODE45_ENSEMBLE_H
+
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <exception>
+#include <algorithm>
+#include <limits>
+#include <initializer_list>
+#include <utility>
+#include "ODE45.h"
+
+// =============================================================================
+//  ODE45Ensemble<Params, Rhs>  —  molti problemi indipendenti in parallelo
+//
+//  Integra la stessa dinamica per M membri (condizioni iniziali e parametri
+//  diversi) tra t0 e tf. Gli stati sono memorizzati structure-of-arrays:
+//  la componente c del membro m è  y[c * M + m].
+//
+//  I membri sono raggruppati in blocchi di `lanes` corsie, integrati in
+//  lockstep: ogni valutazione di f riceve un blocco intero, così il ciclo
+//  sulle corsie nella RHS può essere vettorizzato (SIMD). I blocchi sono
+//  distribuiti tra i thread con OpenMP (se disponibile). In modalità
+//  ADAPTIVE_DOPRI5 ogni corsia ha il proprio passo e il proprio controllo
+//  dell'errore; le corsie già arrivate a tf restano ferme (h = 0).
+//
+//  Firma della RHS (blocchi SoA, componente c della corsia l in [c * width + l]):
+//
+//    void rhs(const double* t, const double* y, double* dydt,
+//             const Params* params, size_t width)
+//
+//  Esempio (Breguet per molte combinazioni di peso e consumo specifico):
+//
+//    struct Cruise { double c, V, E; };
+//    auto f = [](const double* t, const double* W, double* dW, const Cruise* p, size_t n) {
+//        #pragma omp simd
+//        for (size_t l = 0; l < n; ++l) dW[l] = -p[l].c * W[l] / (p[l].V * p[l].E);
+//    };
+//    ODE45Ensemble ens(f, 1, 0.0, range, W0, cruises, opts);
+//    const std::vector<double>& Wf = ens.getFinalStates();
+//
+//  Politiche di output supportate: FINAL_STATE (default per questa classe)
+//  e SAMPLE_TIMES, con i campioni in  samples[(s * dim + c) * M + m].
+// =============================================================================
+
+template <typename Params, typename Rhs>
+class ODE45Ensemble {
+public:
+    static constexpr size_t lanes = 8;   // Corsie per blocco (multiplo della larghezza SIMD)
+
+private:
+    Rhs f;
+    size_t dim;
+    size_t members;
+    double t0, tf;
+    ODE45Options options;
+
+    std::vector<double> yInit;      // SoA, dim x members
+    std::vector<Params> params;
+
+    std::vector<double> samples;    // Istanti richiesti (ordinati, in [t0, tf])
+    std::vector<double> yFinal;     // SoA, dim x members
+    std::vector<double> ySamples;   // SoA, samples x dim x members
+
+    std::vector<size_t> acceptedSteps;
+    std::vector<size_t> rejectedSteps;
+    std::vector<size_t> functionEvaluations;
+
+    // Buffer di un blocco: una copia per thread, riusata su tutti i blocchi
+    struct Workspace {
+        std::vector<double> y, yNew, yStage, err;
+        std::vector<double> k1, k2, k3, k4, k5, k6, k7;
+        double t[lanes], h[lanes], tStage[lanes];
+        bool   active[lanes], rejectedLast[lanes];
+        size_t member[lanes], nextSample[lanes];
+        std::vector<Params> params;
+        std::vector<double> yDense;
+
+        explicit Workspace(size_t dim)
+            : y(dim * lanes), yNew(y), yStage(y), err(y),
+              k1(y), k2(y), k3(y), k4(y), k5(y), k6(y), k7(y),
+              yDense(dim) {}
+    };
+
+    // ── operazioni sui blocchi ───────────────────────────────────────────────
+    /**
+     * @brief out = base + h_l * Σ a_j k_j, lane by lane.
+     */
+    void combine(double* out, const double* base, const double* h,
+                 std::initializer_list<std::pair<double, const double*>> terms) const {
+        for (size_t c = 0; c < dim; ++c) {
+            double* o = out + c * lanes;
+            const double* b = base + c * lanes;
+            #ifdef _OPENMP
+            #pragma omp simd
+            #endif
+            for (size_t l = 0; l < lanes; ++l) o[l] = b[l];
+            for (const auto& [a, k] : terms) {
+                const double* kc = k + c * lanes;
+                #ifdef _OPENMP
+                #pragma omp simd
+                #endif
+                for (size_t l = 0; l < lanes; ++l) o[l] += h[l] * a * kc[l];
+            }
+        }
+    }
+
+    /**
+     * @brief Evaluates the RHS on a block and counts the evaluation for the active lanes.
+     */
+    void evaluate(Workspace& w, const double* t, const double* y, double* dydt) {
+        f(t, y, dydt, w.params.data(), lanes);
+        for (size_t l = 0; l < lanes; ++l)
+            if (w.active[l]) functionEvaluations[w.member[l]] += 1;
+    }
+
+    /**
+     * @brief Weighted RMS norm of the local error of one lane (same norm as ODE45).
+     */
+    double errorNorm(const double* err, const double* yOld, const double* yNew, size_t l) const {
+        double sum = 0.0;
+        for (size_t c = 0; c < dim; ++c) {
+            const size_t i = c * lanes + l;
+            const double sc = options.absTol + options.relTol * std::max(std::abs(yOld[i]), std::abs(yNew[i]));
+            sum += (err[i] / sc) * (err[i] / sc);
+        }
+        return dim == 0 ? 0.0 : std::sqrt(sum / dim);
+    }
+
+    // ── caricamento e scrittura dei risultati ────────────────────────────────
+    /**
+     * @brief Loads the members of a block; the last block is padded with copies of its last member.
+     */
+    void loadBlock(Workspace& w, size_t block) {
+        w.params.clear();
+        for (size_t l = 0; l < lanes; ++l) {
+            const size_t m = std::min(block * lanes + l, members - 1);
+            w.member[l] = m;
+            w.active[l] = (block * lanes + l) < members;
+            w.rejectedLast[l] = false;
+            w.nextSample[l] = 0;
+            w.t[l] = t0;
+            w.params.push_back(params[m]);
+            for (size_t c = 0; c < dim; ++c)
+                w.y[c * lanes + l] = yInit[c * members + m];
+        }
+    }
+
+    void storeFinal(const Workspace& w, size_t l) {
+        const size_t m = w.member[l];
+        for (size_t c = 0; c < dim; ++c)
+            yFinal[c * members + m] = w.y[c * lanes + l];
+    }
+
+    /**
+     * @brief Writes the requested samples falling in [tOld, tNew] of one lane.
+     * @param dense Callable dense(l, theta, out) writing the interpolated state of lane l.
+     */
+    template <typename Dense>
+    void storeSamples(Workspace& w, size_t l, double tOld, double tNew, bool last, Dense&& dense) {
+        if (!w.active[l]) return;   // corsia di riempimento
+        const size_t m = w.member[l];
+        while (w.nextSample[l] < samples.size() && (samples[w.nextSample[l]] <= tNew || last)) {
+            const size_t s = w.nextSample[l];
+            const double ts = samples[s];
+            if (ts >= tNew || tNew == tOld) {
+                for (size_t c = 0; c < dim; ++c) w.yDense[c] = w.yNew[c * lanes + l];
+            } else {
+                dense(l, (ts - tOld) / (tNew - tOld), w.yDense.data());
+            }
+            for (size_t c = 0; c < dim; ++c)
+                ySamples[(s * dim + c) * members + m] = w.yDense[c];
+            w.nextSample[l] += 1;
+        }
+    }
+
+    // ── integratori di un blocco ─────────────────────────────────────────────
+    /**
+     * @brief Classic RK4 with fixed step options.dt on every lane of a block.
+     */
+    void integrateBlockRK4(Workspace& w) {
+        const double dt = options.dt;
+        bool running = true;
+
+        evaluate(w, w.t, w.y.data(), w.k1.data());
+
+        while (running) {
+            running = false;
+            for (size_t l = 0; l < lanes; ++l) {
+                w.h[l] = (w.t[l] < tf - dt * 1e-9) ? std::min(dt, tf - w.t[l]) : 0.0;
+                w.tStage[l] = w.t[l] + 0.5 * w.h[l];
+                running = running || w.h[l] > 0.0;
+            }
+            if (!running) break;
+
+            combine(w.yStage.data(), w.y.data(), w.h, {{0.5, w.k1.data()}});
+            evaluate(w, w.tStage, w.yStage.data(), w.k2.data());
+            combine(w.yStage.data(), w.y.data(), w.h, {{0.5, w.k2.data()}});
+            evaluate(w, w.tStage, w.yStage.data(), w.k3.data());
+            for (size_t l = 0; l < lanes; ++l) w.tStage[l] = w.t[l] + w.h[l];
+            combine(w.yStage.data(), w.y.data(), w.h, {{1.0, w.k3.data()}});
+            evaluate(w, w.tStage, w.yStage.data(), w.k4.data());
+            combine(w.yNew.data(), w.y.data(), w.h, {{1.0/6.0, w.k1.data()}, {2.0/6.0, w.k2.data()},
+                                                     {2.0/6.0, w.k3.data()}, {1.0/6.0, w.k4.data()}});
+
+            // Derivata a fine passo: Hermite per i campioni e primo stadio del passo successivo
+            evaluate(w, w.tStage, w.yNew.data(), w.k2.data());
+
+            for (size_t l = 0; l < lanes; ++l) {
+                if (w.h[l] <= 0.0) continue;
+                const double tOld = w.t[l], h = w.h[l];
+                w.t[l] = tOld + h;
+                if (w.active[l]) acceptedSteps[w.member[l]] += 1;
+
+                if (!samples.empty()) {
+                    storeSamples(w, l, tOld, w.t[l], w.t[l] >= tf - dt * 1e-9,
+                                 [&](size_t lane, double theta, double* out) {
+                        const double th2 = theta * theta, th3 = th2 * theta;
+                        for (size_t c = 0; c < dim; ++c) {
+                            const size_t i = c * lanes + lane;
+                            out[c] = (1.0 - 3.0*th2 + 2.0*th3) * w.y[i] + h * (th3 - 2.0*th2 + theta) * w.k1[i]
+                                   + (3.0*th2 - 2.0*th3) * w.yNew[i] + h * (th3 - th2) * w.k2[i];
+                        }
+                    });
+                }
+            }
+
+            std::swap(w.y, w.yNew);
+            std::swap(w.k1, w.k2);
+        }
+    }
+
+    /**
+     * @brief Dormand-Prince 5(4) with an independent step size on every lane of a block.
+     */
+    void integrateBlockDopri(Workspace& w) {
+        // Tableau di Dormand-Prince (stessi coefficienti di ODE45)
+        constexpr double c2 = 1.0/5.0, c3 = 3.0/10.0, c4 = 4.0/5.0, c5 = 8.0/9.0;
+        constexpr double a21 = 1.0/5.0;
+        constexpr double a31 = 3.0/40.0,       a32 = 9.0/40.0;
+        constexpr double a41 = 44.0/45.0,      a42 = -56.0/15.0,      a43 = 32.0/9.0;
+        constexpr double a51 = 19372.0/6561.0, a52 = -25360.0/2187.0, a53 = 64448.0/6561.0, a54 = -212.0/729.0;
+        constexpr double a61 = 9017.0/3168.0,  a62 = -355.0/33.0,     a63 = 46732.0/5247.0, a64 = 49.0/176.0,  a65 = -5103.0/18656.0;
+        constexpr double b1  = 35.0/384.0,     b3  = 500.0/1113.0,    b4  = 125.0/192.0,    b5  = -2187.0/6784.0, b6 = 11.0/84.0;
+        constexpr double e1 = 71.0/57600.0,    e3 = -71.0/16695.0,    e4 = 71.0/1920.0,     e5 = -17253.0/339200.0,
+                         e6 = 22.0/525.0,      e7 = -1.0/40.0;
+        constexpr double d1 = -12715105075.0/11282082432.0, d3 = 87487479700.0/32700410799.0,
+                         d4 = -10690763975.0/1880347072.0,  d5 = 701980252875.0/199316789632.0,
+                         d6 = -1453857185.0/822651844.0,    d7 = 69997945.0/29380423.0;
+        constexpr double safety = 0.9, facMin = 0.2, facMax = 10.0;
+
+        const double span = tf - t0;
+        const double hMax = options.maxStep > 0.0 ? std::min(options.maxStep, span) : span;
+        const double hMin = 16.0 * std::numeric_limits<double>::epsilon() * std::max(std::abs(t0), std::abs(tf));
+
+        evaluate(w, w.t, w.y.data(), w.k1.data());
+
+        // Passo iniziale per corsia (stima di Hairer, come ODE45::initialStep)
+        if (options.initialStep > 0.0) {
+            std::fill(w.h, w.h + lanes, std::min(options.initialStep, hMax));
+        } else {
+            double d0[lanes], d1n[lanes];
+            for (size_t l = 0; l < lanes; ++l) {
+                d0[l]  = errorNorm(w.y.data(),  w.y.data(), w.y.data(), l);
+                d1n[l] = errorNorm(w.k1.data(), w.y.data(), w.y.data(), l);
+                w.h[l] = (d0[l] < 1e-5 || d1n[l] < 1e-5) ? 1e-6 : 0.01 * d0[l] / d1n[l];
+                w.h[l] = std::min(w.h[l], hMax);
+                w.tStage[l] = t0 + w.h[l];
+            }
+            combine(w.yStage.data(), w.y.data(), w.h, {{1.0, w.k1.data()}});
+            evaluate(w, w.tStage, w.yStage.data(), w.k2.data());
+            for (size_t i = 0; i < dim * lanes; ++i) w.err[i] = w.k2[i] - w.k1[i];
+            for (size_t l = 0; l < lanes; ++l) {
+                const double d2 = errorNorm(w.err.data(), w.y.data(), w.y.data(), l) / w.h[l];
+                const double dMax = std::max(d1n[l], d2);
+                const double h1 = (dMax <= 1e-15) ? std::max(1e-6, 1e-3 * w.h[l])
+                                                  : std::pow(0.01 / dMax, 1.0 / 5.0);
+                w.h[l] = std::min({100.0 * w.h[l], h1, hMax});
+            }
+        }
+
+        double hStep[lanes];    // Passo effettivo del tentativo (0 per le corsie arrivate)
+        size_t attempts = 0;
+
+        while (true) {
+            bool running = false;
+            for (size_t l = 0; l < lanes; ++l) {
+                if (w.t[l] < tf) {
+                    // Ultimo passo: atterra esattamente su tf
+                    if (w.t[l] + w.h[l] >= tf || tf - (w.t[l] + w.h[l]) < hMin) w.h[l] = tf - w.t[l];
+                    hStep[l] = w.h[l];
+                    running = true;
+                } else {
+                    hStep[l] = 0.0;
+                }
+            }
+            if (!running) break;
+            if (++attempts > options.maxSteps)
+                throw std::runtime_error("ODE45Ensemble: raggiunto il numero massimo di passi");
+
+            const double* h = hStep;
+            auto stageTimes = [&](double c) { for (size_t l = 0; l < lanes; ++l) w.tStage[l] = w.t[l] + c * h[l]; };
+
+            combine(w.yStage.data(), w.y.data(), h, {{a21, w.k1.data()}});
+            stageTimes(c2); evaluate(w, w.tStage, w.yStage.data(), w.k2.data());
+            combine(w.yStage.data(), w.y.data(), h, {{a31, w.k1.data()}, {a32, w.k2.data()}});
+            stageTimes(c3); evaluate(w, w.tStage, w.yStage.data(), w.k3.data());
+            combine(w.yStage.data(), w.y.data(), h, {{a41, w.k1.data()}, {a42, w.k2.data()}, {a43, w.k3.data()}});
+            stageTimes(c4); evaluate(w, w.tStage, w.yStage.data(), w.k4.data());
+            combine(w.yStage.data(), w.y.data(), h, {{a51, w.k1.data()}, {a52, w.k2.data()}, {a53, w.k3.data()},
+                                                     {a54, w.k4.data()}});
+            stageTimes(c5); evaluate(w, w.tStage, w.yStage.data(), w.k5.data());
+            combine(w.yStage.data(), w.y.data(), h, {{a61, w.k1.data()}, {a62, w.k2.data()}, {a63, w.k3.data()},
+                                                     {a64, w.k4.data()}, {a65, w.k5.data()}});
+            stageTimes(1.0); evaluate(w, w.tStage, w.yStage.data(), w.k6.data());
+            combine(w.yNew.data(), w.y.data(), h, {{b1, w.k1.data()}, {b3, w.k3.data()}, {b4, w.k4.data()},
+                                                   {b5, w.k5.data()}, {b6, w.k6.data()}});
+            evaluate(w, w.tStage, w.yNew.data(), w.k7.data());
+
+            std::fill(w.err.begin(), w.err.end(), 0.0);
+            combine(w.err.data(), w.err.data(), h, {{e1, w.k1.data()}, {e3, w.k3.data()}, {e4, w.k4.data()},
+                                                    {e5, w.k5.data()}, {e6, w.k6.data()}, {e7, w.k7.data()}});
+
+            for (size_t l = 0; l < lanes; ++l) {
+                if (hStep[l] <= 0.0) continue;
+                const size_t m = w.member[l];
+                const double errNorm = errorNorm(w.err.data(), w.y.data(), w.yNew.data(), l);
+
+                if (!std::isfinite(errNorm))
+                    throw std::runtime_error("ODE45Ensemble: stima dell'errore non finita");
+
+                if (errNorm <= 1.0) {
+                    // Passo accettato: la corsia avanza, le altre restano dove sono
+                    const double tOld = w.t[l], hl = hStep[l];
+                    w.t[l] = (hl == tf - tOld) ? tf : tOld + hl;
+                    if (w.active[l]) acceptedSteps[m] += 1;
+
+                    if (!samples.empty()) {
+                        storeSamples(w, l, tOld, w.t[l], w.t[l] >= tf, [&](size_t lane, double theta, double* out) {
+                            const double a = theta, b = 1.0 - theta;
+                            const double cR2 = a - a * b + 2.0 * a * a * b;
+                            const double cK1 = a * b - a * a * b;
+                            const double cK7 = -a * a * b;
+                            const double cR5 = a * a * b * b;
+                            for (size_t c = 0; c < dim; ++c) {
+                                const size_t i = c * lanes + lane;
+                                out[c] = w.y[i] + cR2 * (w.yNew[i] - w.y[i])
+                                       + hl * ((cK1 + cR5 * d1) * w.k1[i] + (cK7 + cR5 * d7) * w.k7[i]
+                                             + cR5 * (d3 * w.k3[i] + d4 * w.k4[i] + d5 * w.k5[i] + d6 * w.k6[i]));
+                            }
+                        });
+                    }
+
+                    for (size_t c = 0; c < dim; ++c) {
+                        const size_t i = c * lanes + l;
+                        w.y[i]  = w.yNew[i];
+                        w.k1[i] = w.k7[i];   // FSAL
+                    }
+
+                    double fac = errNorm == 0.0 ? facMax : safety * std::pow(errNorm, -1.0/5.0);
+                    fac = std::clamp(fac, facMin, w.rejectedLast[l] ? 1.0 : facMax);
+                    w.h[l] = std::min(hl * fac, hMax);
+                    w.rejectedLast[l] = false;
+                } else {
+                    // Passo rifiutato: solo questa corsia riprova con un passo più corto
+                    if (w.active[l]) rejectedSteps[m] += 1;
+                    w.h[l] *= std::max(facMin, safety * std::pow(errNorm, -1.0/5.0));
+                    w.rejectedLast[l] = true;
+                    if (w.h[l] < hMin)
+                        throw std::runtime_error("ODE45Ensemble: passo sotto il minimo ammissibile");
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Integrates every block, distributing the blocks across the OpenMP threads.
+     */
+    void solve() {
+        yFinal.assign(dim * members, 0.0);
+        ySamples.assign(samples.size() * dim * members, 0.0);
+        acceptedSteps.assign(members, 0);
+        rejectedSteps.assign(members, 0);
+        functionEvaluations.assign(members, 0);
+
+        const long long blocks = static_cast<long long>((members + lanes - 1) / lanes);
+        std::exception_ptr failure;   // Le eccezioni non possono uscire da una regione parallela
+
+        #ifdef _OPENMP
+        #pragma omp parallel
+        #endif
+        {
+            Workspace w(dim);
+
+            #ifdef _OPENMP
+            #pragma omp for schedule(dynamic)
+            #endif
+            for (long long block = 0; block < blocks; ++block) {
+                try {
+                    loadBlock(w, static_cast<size_t>(block));
+                    if (options.mode == ODE45Mode::ADAPTIVE_DOPRI5) integrateBlockDopri(w);
+                    else                                            integrateBlockRK4(w);
+                    for (size_t l = 0; l < lanes; ++l)
+                        if (w.active[l]) storeFinal(w, l);
+                } catch (...) {
+                    #ifdef _OPENMP
+                    #pragma omp critical(ODE45EnsembleFailure)
+                    #endif
+                    if (!failure) failure = std::current_exception();
+                }
+            }
+        }
+
+        if (failure) std::rethrow_exception(failure);
+    }
+
+public:
+    /**
+     * @brief Builds the ensemble and integrates every member from t0 to tf.
+     * @param rhs     Block right-hand side rhs(t, y, dydt, params, width)
+     * @param dim     Number of state components of each member
+     * @param t0      Initial time
+     * @param tf      Final time
+     * @param y0      Initial states, SoA: component c of member m in y0[c * M + m]
+     * @param params  Parameters of each member (one per member)
+     * @param options Integrator mode, tolerances, step limits and output policy
+     * @throws std::invalid_argument If the sizes or the options are not consistent.
+     */
+    ODE45Ensemble(Rhs rhs, size_t dim, double t0, double tf,
+                  std::vector<double> y0, std::vector<Params> params,
+                  const ODE45Options& options = ensembleDefaults())
+        : f(std::move(rhs)), dim(dim), members(params.size()), t0(t0), tf(tf), options(options),
+          yInit(std::move(y0)), params(std::move(params))
+    {
+        if (tf <= t0) throw std::invalid_argument("ODE45Ensemble: tf deve essere > t0");
+        if (dim == 0 || members == 0 || yInit.size() != dim * members)
+            throw std::invalid_argument("ODE45Ensemble: y0 deve contenere dim x membri valori");
+        if (options.mode != ODE45Mode::FIXED_STEP_RK4 && options.mode != ODE45Mode::ADAPTIVE_DOPRI5)
+            throw std::invalid_argument("ODE45Ensemble: sono supportati solo FIXED_STEP_RK4 e ADAPTIVE_DOPRI5");
+        if (options.mode == ODE45Mode::FIXED_STEP_RK4 && options.dt <= 0)
+            throw std::invalid_argument("ODE45Ensemble: dt deve essere > 0");
+        if (options.mode == ODE45Mode::ADAPTIVE_DOPRI5 && (options.relTol <= 0 || options.absTol < 0))
+            throw std::invalid_argument("ODE45Ensemble: tolleranze non valide");
+        if (options.output != ODE45Output::FINAL_STATE && options.output != ODE45Output::SAMPLE_TIMES)
+            throw std::invalid_argument("ODE45Ensemble: sono supportati solo FINAL_STATE e SAMPLE_TIMES");
+
+        if (options.output == ODE45Output::SAMPLE_TIMES) {
+            for (double ts : options.sampleTimes)
+                if (ts >= t0 && ts <= tf) samples.push_back(ts);
+            std::sort(samples.begin(), samples.end());
+        }
+
+        solve();
+    }
+
+    /**
+     * @brief Default options of an ensemble: adaptive Dormand-Prince, final state only.
+     */
+    static ODE45Options ensembleDefaults() {
+        ODE45Options o;
+        o.mode = ODE45Mode::ADAPTIVE_DOPRI5;
+        o.output = ODE45Output::FINAL_STATE;
+        return o;
+    }
+
+    /**
+     * @brief Returns the final states of all members.
+     * @return SoA array, component c of member m at [c * size() + m].
+     */
+    const std::vector<double>& getFinalStates() const { return yFinal; }
+
+    /**
+     * @brief Returns one component of the final state of one member.
+     */
+    double getFinalState(size_t member, size_t component) const { return yFinal[component * members + member]; }
+
+    /**
+     * @brief Returns the sampling instants actually used (sorted, inside [t0, tf]).
+     */
+    const std::vector<double>& getSampleTimes() const { return samples; }
+
+    /**
+     * @brief Returns the states at the sampling instants.
+     * @return SoA array, sample s, component c, member m at [(s * dim + c) * size() + m].
+     */
+    const std::vector<double>& getSamples() const { return ySamples; }
+
+    /**
+     * @brief Returns the number of accepted steps of each member.
+     */
+    const std::vector<size_t>& getNumberOfAcceptedSteps() const { return acceptedSteps; }
+
+    /**
+     * @brief Returns the number of rejected steps of each member (adaptive mode only).
+     */
+    const std::vector<size_t>& getNumberOfRejectedSteps() const { return rejectedSteps; }
+
+    /**
+     * @brief Returns the number of right-hand side evaluations of each member.
+     */
+    const std::vector<size_t>& getNumberOfFunctionEvaluations() const { return functionEvaluations; }
+
+    /**
+     * @brief Returns the number of members.
+     */
+    size_t size() const { return members; }
+
+    /**
+     * @brief Returns the number of state components of each member.
+     */
+    size_t dimension() const { return dim; }
+};
+
+// Deduction guide: Params dal vettore dei parametri, Rhs dal callable
+template <typename Rhs, typename Params>
+ODE45Ensemble(Rhs, size_t, double, double, std::vector<double>, std::vector<Params>, const ODE45Options&)
+    -> ODE45Ensemble<Params, Rhs>;
+
+template <typename Rhs, typename Params>
+ODE45Ensemble(Rhs, size_t, double, double, std::vector<double>, std::vector<Params>)
+    -> ODE45Ensemble<Params, Rhs>;
+
+#endif
@@ -0,0 +1,479 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <future>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX   // Incluso ovunque: niente macro min/max su std::min/std::max
+#endif
+#include <windows.h>
+#include <thread>
+#else
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char **environ;
+#endif
+
+// =============================================================================
+//  PROCESS  —  esecuzione di programmi esterni (vspscript, vspaero, ...)
+//
+//  Il figlio parte con posix_spawn (CreateProcess su Windows) e stdout su una
+//  pipe letta a blocchi da 64 KiB con poll: l'output può essere accumulato,
+//  passato riga per riga a una callback, o entrambe le cose. Come con popen,
+//  stderr resta quello del programma chiamante (i messaggi dei tool non
+//  finiscono tra le righe da interpretare); senza cattura né callback anche
+//  stdout è ereditato, come con system().
+//  Con un timeout il processo (e tutto il suo gruppo: la shell e i programmi
+//  che lancia) viene ucciso allo scadere; il risultato riporta codice di
+//  uscita, segnale, timeout e numero di tentativi.
+//
+//    PROCESS::ProcessOptions opt;
+//    opt.timeoutSeconds = 600;
+//    opt.retries = 1;
+//    auto job = PROCESS::runShellAsync("vspaero.exe -omp 4 case_DegenGeom", opt);
+//    ...                                         // altro lavoro in parallelo
+//    PROCESS::ProcessResult r = job.get();
+//
+//  defaults() contiene le opzioni usate dagli executeCommand degli estrattori
+//  e da VSP::runInDirectory: impostare lì un timeout lo applica a tutto il batch.
+//
+//  Nota POSIX: il figlio ha un proprio process group, quindi il Ctrl-C del
+//  terminale non gli arriva direttamente.
+// =============================================================================
+
+namespace PROCESS {
+
+/**
+ * @brief Launch options of an external process
+ */
+struct ProcessOptions {
+    std::filesystem::path workingDirectory;          // Vuoto = quella del programma
+    double timeoutSeconds = 0.0;                     // Tempo reale per tentativo; 0 = nessun limite
+    int retries = 0;                                 // Tentativi aggiuntivi se il processo fallisce
+    bool captureOutput = true;                       // Accumula stdout in ProcessResult::output (stderr non è catturato)
+    std::function<void(const std::string&)> onLine;  // Parsing incrementale, una riga alla volta (senza '\n')
+};
+
+/**
+ * @brief Outcome of the last attempt
+ */
+struct ProcessResult {
+    bool started = false;       // false se il programma non è partito (vedi error)
+    int exitCode = -1;          // Codice di uscita; -1 se terminato da un segnale o non partito
+    int signal = 0;             // Segnale che ha terminato il processo (POSIX)
+    bool timedOut = false;
+    int attempts = 0;
+    double elapsedSeconds = 0.0;
+    std::string output;         // Solo stdout del processo
+    std::string error;
+
+    bool ok() const { return started && !timedOut && signal == 0 && exitCode == 0; }
+};
+
+/**
+ * @brief Process-wide defaults used by the executeCommand wrappers
+ */
+inline ProcessOptions& defaults() {
+    static ProcessOptions options;
+    return options;
+}
+
+namespace detail {
+
+/**
+ * @brief Collects the output and splits it in lines for the callback
+ */
+class OutputSink {
+public:
+    OutputSink(const ProcessOptions& options, std::string& output) : options(options), output(output) {}
+
+    void append(const char* data, size_t size) {
+        if (options.captureOutput) {
+            output.append(data, size);
+        }
+        if (!options.onLine) {
+            return;
+        }
+        for (size_t i = 0; i < size; ++i) {
+            if (data[i] == '\n') {
+                if (!partial.empty() && partial.back() == '\r') {
+                    partial.pop_back();
+                }
+                options.onLine(partial);
+                partial.clear();
+            }
+            else {
+                partial += data[i];
+            }
+        }
+    }
+
+    void finish() {
+        if (options.onLine && !partial.empty()) {
+            options.onLine(partial);
+            partial.clear();
+        }
+    }
+
+private:
+    const ProcessOptions& options;
+    std::string& output;
+    std::string partial;
+};
+
+inline double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#ifdef _WIN32
+
+inline std::string quoteArgument(const std::string& arg) {
+    if (!arg.empty() && arg.find_first_of(" \t\"") == std::string::npos) {
+        return arg;
+    }
+    std::string quoted = "\"";
+    for (char c : arg) {
+        if (c == '"') {
+            quoted += '\\';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+inline ProcessResult runOnce(const std::vector<std::string>& argv, const ProcessOptions& options) {
+    ProcessResult result;
+    const auto start = std::chrono::steady_clock::now();
+
+    // Dopo "/c" la riga va a cmd.exe così com'è: cmd non usa le regole di quoting di CreateProcess
+    std::string commandLine;
+    bool raw = false;
+    for (const auto& arg : argv) {
+        commandLine += (commandLine.empty() ? "" : " ") + (raw ? arg : quoteArgument(arg));
+        raw = raw || arg == "/c";
+    }
+
+    // Pipe solo per stdout, e solo se l'output serve; stderr è sempre quello del chiamante
+    const bool redirect = options.captureOutput || static_cast<bool>(options.onLine);
+    SECURITY_ATTRIBUTES security{static_cast<DWORD>(sizeof(SECURITY_ATTRIBUTES)), nullptr, TRUE};
+    HANDLE readPipe = nullptr;
+    HANDLE writePipe = nullptr;
+    if (redirect) {
+        if (!CreatePipe(&readPipe, &writePipe, &security, 0)) {
+            result.error = "CreatePipe failed";
+            return result;
+        }
+        SetHandleInformation(readPipe, HANDLE_FLAG_INHERIT, 0);
+    }
+
+    // Job object: al timeout si termina anche tutto quello che il figlio ha lanciato
+    HANDLE job = CreateJobObjectA(nullptr, nullptr);
+    JOBOBJECT_EXTENDED_LIMIT_INFORMATION limits{};
+    limits.BasicLimitInformation.LimitFlags = JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
+    SetInformationJobObject(job, JobObjectExtendedLimitInformation, &limits, sizeof(limits));
+
+    STARTUPINFOA startup{};
+    startup.cb = sizeof(startup);
+    startup.dwFlags = STARTF_USESTDHANDLES;
+    startup.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+    startup.hStdOutput = redirect ? writePipe : GetStdHandle(STD_OUTPUT_HANDLE);
+    startup.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+
+    PROCESS_INFORMATION process{};
+    const std::string directory = options.workingDirectory.string();
+    const BOOL created = CreateProcessA(nullptr, commandLine.data(), nullptr, nullptr, TRUE,
+                                        CREATE_NO_WINDOW | CREATE_SUSPENDED, nullptr,
+                                        directory.empty() ? nullptr : directory.c_str(),
+                                        &startup, &process);
+    const DWORD createError = GetLastError();
+    if (redirect) {
+        CloseHandle(writePipe);
+    }
+    if (!created) {
+        result.error = "CreateProcess failed (" + std::to_string(createError) + "): " + commandLine;
+        if (redirect) {
+            CloseHandle(readPipe);
+        }
+        CloseHandle(job);
+        return result;
+    }
+    AssignProcessToJobObject(job, process.hProcess);
+    ResumeThread(process.hThread);
+    result.started = true;
+
+    OutputSink sink(options, result.output);
+    std::thread reader([&] {
+        if (!redirect) {
+            return;
+        }
+        std::vector<char> buffer(65536);
+        DWORD count = 0;
+        while (ReadFile(readPipe, buffer.data(), static_cast<DWORD>(buffer.size()), &count, nullptr) && count > 0) {
+            sink.append(buffer.data(), count);
+        }
+    });
+
+    const DWORD wait = WaitForSingleObject(process.hProcess,
+        options.timeoutSeconds > 0.0 ? static_cast<DWORD>(std::ceil(options.timeoutSeconds * 1000.0)) : INFINITE);
+    if (wait == WAIT_TIMEOUT) {
+        result.timedOut = true;
+        TerminateJobObject(job, 1);
+        WaitForSingleObject(process.hProcess, INFINITE);
+    }
+    else {
+        DWORD exitCode = 0;
+        GetExitCodeProcess(process.hProcess, &exitCode);
+        result.exitCode = static_cast<int>(exitCode);
+    }
+
+    CloseHandle(job);   // KILL_ON_JOB_CLOSE: i processi rimasti chiudono la pipe
+    reader.join();
+    sink.finish();
+
+    if (redirect) {
+        CloseHandle(readPipe);
+    }
+    CloseHandle(process.hThread);
+    CloseHandle(process.hProcess);
+    result.elapsedSeconds = secondsSince(start);
+    return result;
+}
+
+#else
+
+inline ProcessResult runOnce(const std::vector<std::string>& argv, const ProcessOptions& options) {
+    ProcessResult result;
+    const auto start = std::chrono::steady_clock::now();
+    const bool limited = options.timeoutSeconds > 0.0;
+    const auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::duration<double>(limited ? options.timeoutSeconds : 0.0));
+
+    std::vector<std::string> arguments = argv;
+#if !(defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29)))
+    if (!options.workingDirectory.empty()) {
+        // Senza posix_spawn_file_actions_addchdir_np: cd nella shell del figlio
+        arguments.insert(arguments.begin(), {"/bin/sh", "-c", "cd \"$0\" && exec \"$@\"",
+                                             options.workingDirectory.string()});
+    }
+#endif
+
+    std::vector<char*> args;
+    for (auto& arg : arguments) {
+        args.push_back(arg.data());
+    }
+    args.push_back(nullptr);
+
+    // Pipe solo per stdout, e solo se l'output serve; stderr è sempre quello del chiamante.
+    // Close-on-exec: un figlio lanciato da un altro thread non ne eredita la scrittura
+    const bool redirect = options.captureOutput || static_cast<bool>(options.onLine);
+    int fds[2] = {-1, -1};
+    if (redirect) {
+#ifdef __linux__
+        const int piped = pipe2(fds, O_CLOEXEC);
+#else
+        const int piped = pipe(fds);
+        if (piped == 0) {
+            fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+            fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+        }
+#endif
+        if (piped != 0) {
+            result.error = std::string("pipe failed: ") + std::strerror(errno);
+            return result;
+        }
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if (redirect) {
+        posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+    }
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+    const std::string directory = options.workingDirectory.string();
+    if (!directory.empty()) {
+        posix_spawn_file_actions_addchdir_np(&actions, directory.c_str());
+    }
+#endif
+
+    // Process group proprio: al timeout si uccide anche quello che il figlio ha lanciato
+    posix_spawnattr_t attributes;
+    posix_spawnattr_init(&attributes);
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+    posix_spawnattr_setpgroup(&attributes, 0);
+
+    pid_t pid = 0;
+    const int spawned = posix_spawnp(&pid, args[0], &actions, &attributes, args.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    posix_spawnattr_destroy(&attributes);
+    if (redirect) {
+        close(fds[1]);
+    }
+
+    if (spawned != 0) {
+        if (redirect) {
+            close(fds[0]);
+        }
+        result.error = std::string("posix_spawn failed: ") + std::strerror(spawned) + ": " + argv.front();
+        return result;
+    }
+    result.started = true;
+
+    auto remainingMs = [&]() {
+        const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        return static_cast<int>(std::max<long long>(0, left.count()));
+    };
+
+    // Lettura della pipe fino a EOF o al timeout
+    OutputSink sink(options, result.output);
+    std::vector<char> buffer(redirect ? 65536 : 0);
+    while (redirect) {
+        if (limited && std::chrono::steady_clock::now() >= deadline) {
+            result.timedOut = true;
+            break;
+        }
+        pollfd descriptor{fds[0], POLLIN, 0};
+        const int ready = poll(&descriptor, 1, limited ? std::max(1, remainingMs()) : -1);
+        if (ready < 0 && errno != EINTR) {
+            break;
+        }
+        if (ready <= 0) {
+            continue;
+        }
+        const ssize_t count = read(fds[0], buffer.data(), buffer.size());
+        if (count > 0) {
+            sink.append(buffer.data(), static_cast<size_t>(count));
+        }
+        else if (count == 0 || (errno != EINTR && errno != EAGAIN)) {
+            break;   // EOF: il figlio (e i suoi discendenti) ha chiuso stdout
+        }
+    }
+    sink.finish();
+    if (redirect) {
+        close(fds[0]);
+    }
+
+    // Attesa dell'uscita, sempre entro il limite (il figlio può chiudere stdout e restare vivo)
+    int status = 0;
+    bool reaped = false;
+    while (!result.timedOut) {
+        const pid_t waited = waitpid(pid, &status, limited ? WNOHANG : 0);
+        if (waited == pid) {
+            reaped = true;
+            break;
+        }
+        if (waited < 0 && errno != EINTR) {
+            break;
+        }
+        if (limited && std::chrono::steady_clock::now() >= deadline) {
+            result.timedOut = true;
+            break;
+        }
+        if (waited == 0) {
+            usleep(5000);
+        }
+    }
+
+    if (result.timedOut) {
+        kill(-pid, SIGKILL);
+        while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+        }
+        reaped = true;
+    }
+
+    if (reaped) {
+        if (WIFEXITED(status)) {
+            result.exitCode = WEXITSTATUS(status);
+        }
+        else if (WIFSIGNALED(status)) {
+            result.signal = WTERMSIG(status);
+        }
+    }
+    result.elapsedSeconds = secondsSince(start);
+    return result;
+}
+
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Runs a program and waits for it (with the timeout and retries of the options)
+ * @param argv Program and arguments; the program is searched in PATH
+ * @param options Working directory, timeout, retries and output handling
+ * @return ProcessResult Outcome of the last attempt
+ */
+inline ProcessResult run(const std::vector<std::string>& argv, const ProcessOptions& options = defaults()) {
+    if (argv.empty()) {
+        throw std::invalid_argument("PROCESS::run: empty command");
+    }
+    ProcessResult result;
+    for (int attempt = 0; attempt <= std::max(0, options.retries); ++attempt) {
+        result = detail::runOnce(argv, options);
+        result.attempts = attempt + 1;
+        if (result.ok() || !result.started) {
+            break;   // Riuscito, oppure programma inesistente: riprovare non serve
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Runs a command line through the shell (/bin/sh -c, cmd /c on Windows)
+ */
+inline ProcessResult runShell(const std::string& command, const ProcessOptions& options = defaults()) {
+#ifdef _WIN32
+    return run({"cmd.exe", "/c", command}, options);
+#else
+    return run({"/bin/sh", "-c", command}, options);
+#endif
+}
+
+/**
+ * @brief Starts run() on its own thread; the caller can overlap other work
+ */
+inline std::future<ProcessResult> runAsync(std::vector<std::string> argv, ProcessOptions options = defaults()) {
+    return std::async(std::launch::async, [argv = std::move(argv), options = std::move(options)] {
+        return run(argv, options);
+    });
+}
+
+/**
+ * @brief Starts runShell() on its own thread
+ */
+inline std::future<ProcessResult> runShellAsync(std::string command, ProcessOptions options = defaults()) {
+    return std::async(std::launch::async, [command = std::move(command), options = std::move(options)] {
+        return runShell(command, options);
+    });
+}
+
+/**
+ * @brief Runs a command line and returns its output, as the old popen wrappers
+ * @throws std::runtime_error If the program cannot be started or times out
+ */
+inline std::string captureOutput(const std::string& command, const ProcessOptions& options = defaults()) {
+    ProcessResult result = runShell(command, options);
+    if (!result.started) {
+        throw std::runtime_error("Failed to execute command: " + command + " (" + result.error + ")");
+    }
+    if (result.timedOut) {
+        throw std::runtime_error("Command timed out after " + std::to_string(result.elapsedSeconds) + " s: " + command);
+    }
+    return std::move(result.output);
+}
+
+} // namespace PROCESS
@@ -41,6 +41,7 @@
 #include "ODE45.h"
 #include "PLOT.h"
 #include "VSPGEOMETRYEXTRACTOR.h"
+#include "VSPGEOMETRYSESSION.h"
 #include "VSPScriptGenerator.h"
 #include "VSPAeroGenerator.h"
 #include "WETTEDAREA.h"
@@ -50,6 +51,7 @@
 #include "ATMOSISA.h"
 #include "Interpolant2D.h"
 #include "Interpolant3D.h"
+#include "DigitizedCharts.h"
 #include "RegressionMethod.h"
 #include "ChordCalculator.h"
 #include "CD0Calculator.h"
@@ -125,95 +127,6 @@ private:
     double effectiveMach = 0.0;
     double compressibilityFactor = 0.0;
 
-    // --- 116: Blockage factor - Scoop inlet vs J ---
-    std::vector<double> scoop_J = {
-        0.0101796, 0.111802, 0.241481, 0.417075, 0.597827,
-        0.768534, 0.954598, 1.04912, 1.13607, 1.21805,
-        1.33328, 1.43823, 1.56105, 1.67106, 1.78614,
-        1.90892, 2.01626, 2.14656, 2.28959, 2.37900,
-        2.49125, 2.59578, 2.71045, 2.82508, 2.99569};
-
-    std::vector<double> scoop_BF = {
-        1.00005, 1.00009, 1.00042, 1.00127, 1.00232,
-        1.00368, 1.00535, 1.00677, 1.00830, 1.01013,
-        1.01258, 1.01472, 1.01706, 1.01915, 1.02119,
-        1.02343, 1.02516, 1.02714, 1.02922, 1.03055,
-        1.03181, 1.03282, 1.03378, 1.03464, 1.03574};
-
-    // --- 117: Blockage factor - Annular inlet vs J ---
-    std::vector<double> annular_J = {
-        0.0126810, 0.109242, 0.203283, 0.292244, 0.386401,
-        0.528858, 0.666293, 0.834402, 1.00005, 1.26249,
-        1.39502, 1.56082, 1.72158, 1.92325, 2.06109,
-        2.23720, 2.38841, 2.49562, 2.59504, 2.69627,
-        2.82419, 2.99603};
-
-    std::vector<double> annular_BF = {
-        0.999947, 1.00003, 1.00017, 1.00031, 1.00076,
-        1.00130, 1.00200, 1.00321, 1.00462, 1.00674,
-        1.00790, 1.00972, 1.01165, 1.01429, 1.01606,
-        1.01827, 1.02013, 1.02150, 1.02245, 1.02313,
-        1.02384, 1.02485};
-
-    // --- 118: Delta Mach - Effect of blade camber ---
-    std::vector<double> integratedLiftCoeffcientValues = {
-        0.201428, 0.232620, 0.269341, 0.319669, 0.371002,
-        0.412282, 0.463630, 0.501402, 0.537167, 0.570410,
-        0.601147, 0.635925, 0.666671, 0.700439};
-
-    std::vector<double> deltaMachValues = {
-        -0.0158481, -0.0100277, -0.00298277, 0.00549675, 0.0141804,
-        0.0206193, 0.0285914, 0.0337059, 0.0382088, 0.0425062,
-        0.0458867, 0.0492705, 0.0522444, 0.0556274};
-
-    // --- 120: Compressibility factor - M_eff = 0.3 --- (11 punti)
-    std::vector<double> mach03_x = {
-        0.496008, 0.518514, 0.549096, 0.588666, 0.644956,
-        0.716279, 0.764321, 0.795918, 0.825501, 0.885217,
-        0.955506};
-    std::vector<double> compressibilityFactorAtMach03 = {
-        0.850324, 0.865093, 0.886593, 0.903328, 0.926368,
-        0.949853, 0.968331, 0.977033, 0.983999, 0.990988,
-        1.00037};
-
-    // --- 121: Compressibility factor - M_eff = 0.4 --- (12 punti)
-    std::vector<double> mach04_x = {
-        0.795241, 0.841268, 0.900279, 0.952763, 1.00962,
-        1.07893, 1.13145, 1.16728, 1.22240, 1.29908,
-        1.36079, 1.41185};
-    std::vector<double> compressibilityFactorAtMach04 = {
-        0.849914, 0.866654, 0.882537, 0.899283, 0.915165,
-        0.936913, 0.953225, 0.962798, 0.973472, 0.983729,
-        0.992673, 1.00031};
-
-    // --- 122: Compressibility factor - M_eff = 0.5 --- (12 punti)
-    std::vector<double> mach05_x = {
-        1.24941, 1.30403, 1.38396, 1.44282, 1.50379,
-        1.57121, 1.61546, 1.65784, 1.74305, 1.81332,
-        1.86867, 1.90691};
-    std::vector<double> compressibilityFactorAtMach05 = {
-        0.850063, 0.867027, 0.890520, 0.908355, 0.926626,
-        0.945119, 0.957086, 0.965580, 0.976712, 0.986313,
-        0.994167, 1.00049};
-
-    // --- 123: Compressibility factor - M_eff = 0.6 --- (10 punti)
-    std::vector<double> mach06_x = {
-        1.79391, 1.87824, 1.97955, 2.09547, 2.16077,
-        2.20714, 2.27511, 2.33890, 2.40483, 2.45582};
-    std::vector<double> compressibilityFactorAtMach06 = {
-        0.851152, 0.873564, 0.898809, 0.929923, 0.947980,
-        0.960382, 0.971934, 0.981747, 0.991779, 1.00028};
-
-    // --- 124: Compressibility factor - M_eff = 0.7 --- (13 punti)
-    std::vector<double> mach07_x = {
-        2.57964, 2.66902, 2.79660, 2.95600, 3.06446,
-        3.17716, 3.28786, 3.34536, 3.44580, 3.52481,
-        3.61459, 3.72187, 3.81623};
-    std::vector<double> compressibilityFactorAtMach07 = {
-        0.850484, 0.863355, 0.883198, 0.908923, 0.925497,
-        0.942942, 0.958433, 0.966289, 0.975480, 0.983353,
-        0.991235, 0.995660, 1.00007};
-
 public:
     /// @brief Constructor for the PropellerEfficiencyCalculator class. Initializes the calculator with the necessary aircraft data, disk geometry, speed, revolution per second, and air density. The constructor takes in references to the builder object, disk geometry data, speed of the aircraft, revolution per second of the propeller, and air density at the operating altitude. This allows the calculator to have access to all relevant information needed for accurate propeller efficiency calculations.
     /// @param builder A reference to the BuildAircraft object that contains the aircraft's design.
@@ -346,20 +259,12 @@ public:
         if (builder.getEngineData().getNumberOfEngines() == 1)
         {
 
-            VSPGEOMTRYEXTRACTOR::GeometryExtractor geomExtractor;
-            geomExtractor.extractAllGeoms(builder.getCommonData().getNameOfAircraft(),
-                                          builder.getCommonData().getNameOfAircraft() + "_AllGeomsToCd0.vspscript");
-
-            VSPGEOMTRYEXTRACTOR::AircraftGeometryData allGeomData = geomExtractor.getGeometryData();
-
-            // VSPGEOMTRYEXTRACTOR::GeomInfo fuselageType;
+            // Geometrie e sezioni dalla sessione condivisa con il calcolo del CD0
+            const auto session = VSPGEOMTRYEXTRACTOR::GeometrySession::acquire(builder.getCommonData().getNameOfAircraft(), {});
 
-            VSPGEOMTRYEXTRACTOR::DiametersExtractor fuseExtractor;
+            const VSPGEOMTRYEXTRACTOR::AircraftGeometryData &allGeomData = session->getGeometryData();
 
-            VSPGEOMTRYEXTRACTOR::FuselageDiametersAndXStation fuseData = fuseExtractor.extractFuselageDiameters(
-                builder.getCommonData().getNameOfAircraft(),
-                allGeomData,
-                fuselage.length);
+            VSPGEOMTRYEXTRACTOR::FuselageDiametersAndXStation fuseData = session->getFuselageDiameters(fuselage.length);
 
             for (const auto &geomName : allGeomData.nameGeom)
             {
@@ -401,18 +306,10 @@ public:
 
         else
         {
-            VSPGEOMTRYEXTRACTOR::GeometryExtractor geomExtractor;
-            geomExtractor.extractAllGeoms(builder.getCommonData().getNameOfAircraft(),
-                                          builder.getCommonData().getNameOfAircraft() + "_AllGeomsToCd0.vspscript");
+            // Geometrie e sezioni dalla sessione condivisa con il calcolo del CD0
+            const auto session = VSPGEOMTRYEXTRACTOR::GeometrySession::acquire(builder.getCommonData().getNameOfAircraft(), {});
 
-            VSPGEOMTRYEXTRACTOR::AircraftGeometryData allGeomData = geomExtractor.getGeometryData();
-
-            VSPGEOMTRYEXTRACTOR::DiametersExtractor nacelleExtractor;
-
-            VSPGEOMTRYEXTRACTOR::NacelleDiametersAndXStation nacelleData = nacelleExtractor.extractNacelleDiameters(
-                builder.getCommonData().getNameOfAircraft(),
-                allGeomData,
-                nacelle.length);
+            VSPGEOMTRYEXTRACTOR::NacelleDiametersAndXStation nacelleData = session->getNacelleDiameters(nacelle.length);
 
             double maxNacelleWidth = *std::max_element(nacelleData.allNacelleWidth.begin(), nacelleData.allNacelleWidth.end());
             double maxNacelleHeight = *std::max_element(nacelleData.allNacelleHeights.begin(), nacelleData.allNacelleHeights.end());
@@ -427,17 +324,13 @@ public:
         if (builder.getEngineData().getTypeOfInlet() == TypeOfInlet::SCOOP_INLET)
         {
 
-            Interpolant scoopBFInterpolator(scoop_J, scoop_BF, 3, RegressionMethod::POLYNOMIAL);
-
-            bloackageFactor = (1 - factorToAccountRetardationAirflowTroughPropellerDisk) * scoopBFInterpolator.getYValueFromRegression(propellerAdvanceRatio);
+            bloackageFactor = (1 - factorToAccountRetardationAirflowTroughPropellerDisk) * DIGITIZED_CHARTS::scoopInletBlockageFactor().evaluate(propellerAdvanceRatio);
         }
 
         else if (builder.getEngineData().getTypeOfInlet() == TypeOfInlet::ANULAR_INLET)
         {
 
-            Interpolant annularBFInterpolator(annular_J, annular_BF, 3, RegressionMethod::POLYNOMIAL);
-
-            bloackageFactor = factorToAccountRetardationAirflowTroughPropellerDisk * annularBFInterpolator.getYValueFromRegression(propellerAdvanceRatio);
+            bloackageFactor = factorToAccountRetardationAirflowTroughPropellerDisk * DIGITIZED_CHARTS::annularInletBlockageFactor().evaluate(propellerAdvanceRatio);
         }
 
         // ================== Calculate Fscrubbling ==================
@@ -517,8 +410,9 @@ public:
                 outbordYStationDisk = disk.yloc.front() + disk.diameter.front() / 2.0;
 
                 // Wing
-                chordWingInboard = ChordCalculator(wing).getChordAtEtaStation(2 * inbordYStationDisk / wing.totalProjectedSpan, wing.typeOfWing);
-                chordWingOutboard = ChordCalculator(wing).getChordAtEtaStation(2 * outbordYStationDisk / wing.totalProjectedSpan, wing.typeOfWing);
+                const ChordCalculator wingChordCalculator(wing);
+                chordWingInboard = wingChordCalculator.getChordAtEtaStation(2 * inbordYStationDisk / wing.totalProjectedSpan, wing.typeOfWing);
+                chordWingOutboard = wingChordCalculator.getChordAtEtaStation(2 * outbordYStationDisk / wing.totalProjectedSpan, wing.typeOfWing);
 
                 spanOnWingAffectedBySlipSream = outbordYStationDisk - inbordYStationDisk;
 
@@ -527,8 +421,9 @@ public:
                 if (0.5 * horizontal.totalProjectedSpan > outbordYStationDisk)
                 {
 
-                    chordHorizontalInboard = ChordCalculator(horizontal).getChordAtEtaStation(2 * inbordYStationDisk / horizontal.totalProjectedSpan, horizontal.typeOfWing);
-                    chordHorizontalOutboard = ChordCalculator(horizontal).getChordAtEtaStation(2 * outbordYStationDisk / horizontal.totalProjectedSpan, horizontal.typeOfWing);
+                    const ChordCalculator horizontalChordCalculator(horizontal);
+                    chordHorizontalInboard = horizontalChordCalculator.getChordAtEtaStation(2 * inbordYStationDisk / horizontal.totalProjectedSpan, horizontal.typeOfWing);
+                    chordHorizontalOutboard = horizontalChordCalculator.getChordAtEtaStation(2 * outbordYStationDisk / horizontal.totalProjectedSpan, horizontal.typeOfWing);
 
                     spanOnHorizontalAffectedBySlipSream = outbordYStationDisk - inbordYStationDisk;
                 }
@@ -556,8 +451,9 @@ public:
                 outbordYStationDisk = disk.yloc.front() + disk.diameter.front() / 2.0;
 
                 // Wing
-                chordWingInboard = ChordCalculator(wing).getChordAtEtaStation(2 * inbordYStationDisk / wing.totalProjectedSpan, wing.typeOfWing);
-                chordWingOutboard = ChordCalculator(wing).getChordAtEtaStation(2 * outbordYStationDisk / wing.totalProjectedSpan, wing.typeOfWing);
+                const ChordCalculator wingChordCalculator(wing);
+                chordWingInboard = wingChordCalculator.getChordAtEtaStation(2 * inbordYStationDisk / wing.totalProjectedSpan, wing.typeOfWing);
+                chordWingOutboard = wingChordCalculator.getChordAtEtaStation(2 * outbordYStationDisk / wing.totalProjectedSpan, wing.typeOfWing);
 
                 spanOnWingAffectedBySlipSream = outbordYStationDisk - inbordYStationDisk;
 
@@ -571,23 +467,13 @@ public:
 
         // ================== Compressibility Factor ==================
 
-        Interpolant effectOfBladeCamberInterpolator(integratedLiftCoeffcientValues, deltaMachValues, 2, RegressionMethod::POLYNOMIAL);
-
-        deltaMachDueToTheBladeCamber = effectOfBladeCamberInterpolator.getYValueFromRegression(integratedDesignLiftCoeffcient);
+        deltaMachDueToTheBladeCamber = DIGITIZED_CHARTS::bladeCamberDeltaMach().evaluate(integratedDesignLiftCoeffcient);
 
         effectiveMach = speed / (Atmosphere::ISA::speedOfSound(altitude)) + deltaMachDueToTheBladeCamber; // Effective Mach number at which the propeller operates, accounting for blade camber effects
 
         if (effectiveMach >= 0.3)
         {
-            Interpolant2D compressibilityFactorInterpolator(3, RegressionMethod::POLYNOMIAL);
-
-            compressibilityFactorInterpolator.addCurve(0.3, mach03_x, compressibilityFactorAtMach03);
-            compressibilityFactorInterpolator.addCurve(0.4, mach04_x, compressibilityFactorAtMach04);
-            compressibilityFactorInterpolator.addCurve(0.5, mach05_x, compressibilityFactorAtMach05);
-            compressibilityFactorInterpolator.addCurve(0.6, mach06_x, compressibilityFactorAtMach06);
-            compressibilityFactorInterpolator.addCurve(0.7, mach07_x, compressibilityFactorAtMach07);
-
-            compressibilityFactor = compressibilityFactorInterpolator.interpolate(propellerAdvanceRatio, effectiveMach);
+            compressibilityFactor = DIGITIZED_CHARTS::propellerCompressibilityFactor().interpolate(propellerAdvanceRatio, effectiveMach);
         }
         else
         {
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include "RegressionMethod.h"
+
+/**
+ * @brief Fitted regression model reduced to its method and coefficients
+ *
+ * A RegressionModel is the "evaluation half" of an Interpolant: once the
+ * least-squares problem has been solved, only the coefficients are needed to
+ * answer queries. Storing this compact form lets chart interpolators fit a
+ * curve once and evaluate it many times without copying the raw data or
+ * allocating memory.
+ *
+ * Coefficient layout of the stored model:
+ * - LINEAR      : [Slope, Intercept]
+ * - POLYNOMIAL  : [q_n, q_(n-1), ..., q_1, q_0] in the scaled variable
+ *                 z = (x - center) / scale, where the fit is solved and evaluated
+ * - EXPONENTIAL : [A, B] where y = A * exp(B * x)
+ * - POWER       : [A, B] where y = A * x^B
+ * - LOGARITHMIC : [A, B] where y = A * ln(x) + B
+ * - CONSTANT    : unused, the query value is returned unchanged
+ *
+ * Interpolant::getCoefficients() and monomialCoefficients() give the same
+ * layout except for POLYNOMIAL, which they expand in x as [p_n, ..., p_1, p_0].
+ */
+struct RegressionModel
+{
+    RegressionMethod method = RegressionMethod::LINEAR;
+    std::vector<double> coefficients;
+    double center = 0.0; // Centro delle ascisse del fit polinomiale
+    double scale = 1.0;  // Semiampiezza delle ascisse del fit polinomiale
+
+    /**
+     * @brief Coefficients in the public layout of Interpolant::getCoefficients()
+     *
+     * For POLYNOMIAL the scaled form is expanded in x, [p_n, ..., p_1, p_0]:
+     * meant for reporting and for callers that need the monomials, while
+     * evaluate() keeps using the better conditioned scaled form.
+     *
+     * @return std::vector<double> Coefficients with polynomials in x
+     */
+    std::vector<double> monomialCoefficients() const
+    {
+        if (method != RegressionMethod::POLYNOMIAL || coefficients.empty())
+        {
+            return coefficients;
+        }
+
+        // Horner sulla composizione q((x - center) / scale), coefficienti crescenti p_0 ... p_n
+        const size_t n = coefficients.size() - 1;
+        std::vector<double> ascending(n + 1, 0.0);
+        for (size_t j = 0; j <= n; ++j)
+        {
+            for (size_t d = j; d >= 1; --d)
+            {
+                ascending[d] = (ascending[d - 1] - ascending[d] * center) / scale;
+            }
+            ascending[0] = -ascending[0] * center / scale + coefficients[j];
+        }
+        return std::vector<double>(ascending.rbegin(), ascending.rend());
+    }
+
+    /**
+     * @brief Evaluate the fitted model at x
+     *
+     * Polynomials are evaluated with Horner's scheme in the scaled variable z,
+     * where the fit was solved, so no std::pow call is made per term and no
+     * accuracy is lost to a change of basis.
+     *
+     * @param x Query abscissa
+     * @return double Model output at x
+     */
+    double evaluate(double x) const noexcept
+    {
+        return evaluate(method, coefficients.data(), coefficients.size(), x, center, scale);
+    }
+
+    /**
+     * @brief Evaluate a model whose coefficients live in external storage
+     *
+     * Used by the chart interpolators, which keep the coefficients of all their
+     * curves in one contiguous array.
+     *
+     * @param method Regression method of the model
+     * @param coefficients Pointer to the coefficients (layout as above)
+     * @param count Number of coefficients
+     * @param x Query abscissa
+     * @param center Center of the polynomial abscissae (POLYNOMIAL only)
+     * @param scale Half-range of the polynomial abscissae (POLYNOMIAL only)
+     * @return double Model output at x
+     */
+    static double evaluate(RegressionMethod method,
+                           const double* coefficients,
+                           size_t count,
+                           double x,
+                           double center = 0.0,
+                           double scale = 1.0) noexcept
+    {
+        switch (method)
+        {
+        case RegressionMethod::LINEAR:
+            return coefficients[0] * x + coefficients[1];
+
+        case RegressionMethod::POLYNOMIAL:
+        {
+            const double z = (x - center) / scale;
+            double y = 0.0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                y = y * z + coefficients[i];
+            }
+            return y;
+        }
+
+        case RegressionMethod::EXPONENTIAL:
+            return coefficients[0] * std::exp(coefficients[1] * x);
+
+        case RegressionMethod::POWER:
+            return coefficients[0] * std::pow(x, coefficients[1]);
+
+        case RegressionMethod::LOGARITHMIC:
+            return coefficients[0] * std::log(x) + coefficients[1];
+
+        case RegressionMethod::CONSTANT:
+            return x;
+
+        default:
+            return 0.0;
+        }
+    }
+};
@@ -10,9 +10,11 @@
 #include <filesystem>
 #include <array>
 #include <memory>
+#include <future>
 #include <iostream>
 #include "VSPGEOMETRYEXTRACTOR.h"
 #include "VSPAeroGenerator.h"
+#include "VSPAeroScheduler.h"
 #include "VSPScriptGenerator.h"
 #include "READPOLARFILE.h"
 #include "ControlSurfaceBuilder.h"
@@ -22,6 +24,9 @@ namespace SILENTORCOMPONENT
 {
     struct AerodynamicCoefficients
     {
+        std::vector<double> machNumber;
+        std::vector<double> sideslipAngle;
+        std::vector<double> angleOfAttack;
         std::vector<double> liftCoefficient;
         std::vector<double> pitchingMomentCoefficient;
     };
@@ -44,6 +49,8 @@ namespace SILENTORCOMPONENT
 
         std::string movablesDetected;
 
+        std::future<VSP::VSPAeroResult> pendingAnalysis;
+
         std::filesystem::path sourceAircraftFilePath;
         std::filesystem::path copyAircraftFilePath;
 
@@ -114,31 +121,27 @@ namespace SILENTORCOMPONENT
         //     }
         // }
 
-        int executeCommand(const std::string &command, int chooseLauncher, std::string vspExecutable = "")
+        /// @brief Stem of the degenerate geometry files, one per script so that several
+        /// components can be analysed at the same time.
+        inline std::string degenGeomStem() const
         {
-            // Salva e forza il working directory corretto
-            std::filesystem::path originalPath = std::filesystem::current_path();
-            std::filesystem::current_path(parentFolder); // <- forza CWD alla cartella del progetto
+            return nameOfAircrfat + "_copy_" + std::filesystem::path(filenameVspScript).stem().string() + "_DegenGeom";
+        }
 
-            int ret = -1;
-            if (chooseLauncher == 1)
-            {
-                ret = system(command.c_str());
-                if (ret != 0)
-                    std::cerr << "[ERROR] VSPScript failed (ret=" << ret << "): " << command << std::endl;
-            }
-            else if (chooseLauncher == 2)
-            {
-                ret = system(command.c_str());
-                if (ret != 0)
-                    std::cerr << "[ERROR] VSPAERO failed (ret=" << ret << "): " << command << std::endl;
-            }
-            else
+        int executeCommand(const std::string &command, int chooseLauncher, std::string vspExecutable = "")
+        {
+            if (chooseLauncher != 1 && chooseLauncher != 2)
             {
                 std::cerr << "[ERROR] executeCommand: invalid chooseLauncher" << std::endl;
+                return 1;
             }
 
-            std::filesystem::current_path(originalPath); // ripristina
+            // Il processo figlio parte nella cartella del progetto: il CWD globale non cambia
+            int ret = VSP::runInDirectory(command, parentFolder);
+            if (ret != 0)
+                std::cerr << "[ERROR] " << (chooseLauncher == 1 ? "VSPScript" : "VSPAERO")
+                          << " failed (ret=" << ret << "): " << command << std::endl;
+
             return (ret == 0) ? 0 : 1;
         }
 
@@ -202,6 +205,12 @@ namespace SILENTORCOMPONENT
 
             try {
 
+            // Un caso ancora in coda legge la geometria degenerata: si attende prima di rimuoverla
+            if (pendingAnalysis.valid())
+            {
+                pendingAnalysis.wait();
+            }
+
             // if (std::filesystem::exists(copyAircraftFilePath))
             // {
             //     std::filesystem::remove(copyAircraftFilePath);
@@ -344,11 +353,11 @@ namespace SILENTORCOMPONENT
                 }
             }
 
-            writeCommand("SetComputationFileName(DEGEN_GEOM_CSV_TYPE,\"" + nameOfAircrfat + "_copy_DegenGeom.csv\");");
+            writeCommand("SetComputationFileName(DEGEN_GEOM_CSV_TYPE,\"" + degenGeomStem() + ".csv\");");
             writeCommand("ComputeDegenGeom(SET_SHOWN,DEGEN_GEOM_CSV_TYPE);");
             file << "\r\n";
 
-            writeCommand("SetComputationFileName(DEGEN_GEOM_M_TYPE,\"" + nameOfAircrfat + "_copy_DegenGeom.m\");");
+            writeCommand("SetComputationFileName(DEGEN_GEOM_M_TYPE,\"" + degenGeomStem() + ".m\");");
             writeCommand("ComputeDegenGeom(SET_SHOWN,DEGEN_GEOM_M_TYPE);");
             file << "\r\n";
 
@@ -362,57 +371,58 @@ namespace SILENTORCOMPONENT
             executeCommand("vspscript.exe -script " + filenameVspScript, 1);
         }
 
-        // Esegue lo script di wetted area e cattura i risultati
+        /// @brief Queues the VSPAERO analysis of the current degenerate geometry and returns at once;
+        /// waitAnalysis() collects the results. Several components can be queued before waiting.
+        /// @param settings Aerodynamic settings of the analysis.
+        /// @param vspExecutable The VSPAERO executable to use (default is "vspaero.exe").
+        void submitAnalysis(VSP::AeroSettings settings,
+                            const std::string &vspExecutable = "vspaero.exe")
+        {
+            // Caso isolato in una cartella propria: più analisi possono girare insieme
+            VSP::VSPAeroJob job;
+            job.geometryStem = std::filesystem::path(parentFolder) / degenGeomStem();
+            job.settings = settings;
+            job.controls = VSP::ControlSurfaceBuilder::buildControlSurfaces(this->silentorAC, settings.Symmetry);
+            job.rotorConfig = "P"; // Config = propeller
+            job.vspaeroExecutable = vspExecutable;
+
+            pendingAnalysis = VSP::VSPAeroScheduler::shared().submit(std::move(job));
+        }
 
-        /// @brief Executes the wetted area script and captures the results from the terminal output.
-        /// @param nameOfTheFileToWetArea Name of the script file that calculates the analysis - no one extension
-        /// @param vspExecutable The VSP executable to use (mandatory is "vspscript.exe").
-        void executeAnalysis(VSP::AeroSettings settings,
-                             const std::string &vspExecutable = "vspaero.exe")
+        /// @brief Waits for the analysis queued by submitAnalysis() and stores its coefficients.
+        void waitAnalysis()
         {
+            if (!pendingAnalysis.valid())
+            {
+                throw std::runtime_error("SilentorComponent: no analysis submitted");
+            }
 
+            aeroCoeffs.machNumber.clear();
+            aeroCoeffs.sideslipAngle.clear();
+            aeroCoeffs.angleOfAttack.clear();
             aeroCoeffs.liftCoefficient.clear();
+            aeroCoeffs.pitchingMomentCoefficient.clear();
 
-            VSP::VSPAeroGenerator vspaero(nameOfAircrfat + "_copy");
-
-            vspaero.writeSettings(settings);
-
-            vspaero.writeRotors(settings, "P"); // Config = propeller
-
-            auto controls = VSP::ControlSurfaceBuilder::buildControlSurfaces(this->silentorAC, settings.Symmetry);
-            vspaero.writeControlSurfaces(controls);
-
-            vspaero.writeFooter(settings);
-            std::cout << "\n ✓ VSPAERO file generated: MyAircraft_DegenGeom.vspaero" << std::endl;
-            // // close file .VSPAERO mandatory
-            // vspaero.close();
-
-            // // Costruisci il comando
-            // std::string command = vspExecutable + " -omp 4 " + nameOfAircrfat + "_copy_DegenGeom";
-
-            // // Esegui l'analisi
-            // executeCommand(command,2);
+            const VSP::VSPAeroResult result = pendingAnalysis.get();
 
-            // In executeAnalysis
-            vspaero.close();
-
-            std::filesystem::path degenGeomPath = std::filesystem::path(parentFolder) / (nameOfAircrfat + "_copy_DegenGeom");
-            std::string command = vspExecutable + " -omp 4 \"" + degenGeomPath.string() + "\"";
-            executeCommand(command, 2);
-
-            VSPPolar::PolarReader reader;
-            reader.readFile(nameOfAircrfat + "_copy_DegenGeom.polar");
-            const auto &polarData = reader.getData();
-            const auto &headers = reader.getHeaders();
-
-            // std::cout << "\n--- POLAR DATA ---" << std::endl;
-            for (const auto &point : polarData)
+            for (const auto &point : result.polar)
             {
+                aeroCoeffs.machNumber.push_back(point.Mach);
+                aeroCoeffs.sideslipAngle.push_back(point.Beta);
+                aeroCoeffs.angleOfAttack.push_back(point.AoA);
                 aeroCoeffs.liftCoefficient.push_back(point.CL);
                 aeroCoeffs.pitchingMomentCoefficient.push_back(point.CMm);
             }
+        }
 
-            
+        /// @brief Runs the VSPAERO analysis of the current degenerate geometry and stores its coefficients.
+        /// @param settings Aerodynamic settings of the analysis.
+        /// @param vspExecutable The VSPAERO executable to use (default is "vspaero.exe").
+        void executeAnalysis(VSP::AeroSettings settings,
+                             const std::string &vspExecutable = "vspaero.exe")
+        {
+            submitAnalysis(settings, vspExecutable);
+            waitAnalysis();
         }
 
         // Getters results
@@ -0,0 +1,319 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+#include "TabulatedMethod.h"
+
+/**
+ * @brief Exact piecewise interpolation of tabulated data
+ *
+ * Unlike Interpolant, which fits a least-squares model through the samples,
+ * TabulatedInterpolant passes through every sample. It is meant for geometric
+ * station data (fuselage widths, chord distributions, radii of gyration) where
+ * the tabulated values are exact and must be reproduced.
+ *
+ * All the work that depends only on the table is done once in the constructor:
+ * - samples are sorted by x and duplicated abscissae are merged pairwise in
+ *   input order, y <- (y + y_dup) / 2, as the MomentOfInertiaCalculator lookup did;
+ * - interval widths and secant slopes are stored;
+ * - for PCHIP and NATURAL_SPLINE the nodal derivatives are computed, so both
+ *   schemes are evaluated with the same cubic Hermite kernel;
+ * - uniform grids are detected, so the interval is found with a direct index
+ *   computation (O(1)); irregular grids use a binary search (O(log n)).
+ *
+ * Example:
+ * @code
+ * TabulatedInterpolant chord(eta, chords, TabulatedMethod::LINEAR);
+ * double c = chord.evaluate(0.35);
+ * @endcode
+ */
+class TabulatedInterpolant
+{
+private:
+    TabulatedMethod method = TabulatedMethod::LINEAR;
+    TabulatedExtrapolation extrapolation = TabulatedExtrapolation::LINEAR;
+
+    std::vector<double> xs;      // Sorted, unique abscissae
+    std::vector<double> ys;      // Ordinates at xs
+    std::vector<double> h;       // Interval widths, h[i] = xs[i+1] - xs[i]
+    std::vector<double> delta;   // Secant slopes on each interval
+    std::vector<double> d;       // Nodal derivatives (cubic schemes only)
+
+    // Uniform grid shortcut
+    bool uniform = false;
+    double invStep = 0.0;
+
+    // Tolerance used to merge duplicates (absolute) and to detect uniform grids (relative)
+    static constexpr double tolerance = 1e-12;
+
+    // Sort the samples and merge duplicated abscissae
+    void sortAndMerge(const std::vector<double>& x, const std::vector<double>& y)
+    {
+        const size_t n = x.size();
+        std::vector<size_t> idx(n);
+        std::iota(idx.begin(), idx.end(), 0);
+        std::stable_sort(idx.begin(), idx.end(), [&](size_t a, size_t b) { return x[a] < x[b]; });
+
+        xs.clear();
+        ys.clear();
+        xs.reserve(n);
+        ys.reserve(n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const double xi = x[idx[i]];
+            const double yi = y[idx[i]];
+            if (!xs.empty() && std::abs(xi - xs.back()) < tolerance)
+            {
+                // Media a coppie con il valore già unito (non media aritmetica di tutti i duplicati)
+                ys.back() = 0.5 * (ys.back() + yi);
+            }
+            else
+            {
+                xs.push_back(xi);
+                ys.push_back(yi);
+            }
+        }
+    }
+
+    // One-sided three-point end derivative with the Fritsch-Carlson shape constraints
+    static double pchipEndDerivative(double h0, double h1, double del0, double del1)
+    {
+        double slope = ((2.0 * h0 + h1) * del0 - h0 * del1) / (h0 + h1);
+        // sign(slope) != sign(del0) come in MATLAB pchip: su un tratto di estremità piatto
+        // (del0 = 0) la pendenza è nulla, altrimenti la curva scende sotto i campioni
+        if (slope * del0 <= 0.0)
+        {
+            slope = 0.0;
+        }
+        else if (del0 * del1 < 0.0 && std::abs(slope) > 3.0 * std::abs(del0))
+        {
+            slope = 3.0 * del0;
+        }
+        return slope;
+    }
+
+    // Nodal derivatives of the shape-preserving cubic Hermite interpolant
+    void computePchipDerivatives()
+    {
+        const size_t m = xs.size();
+        d.assign(m, 0.0);
+
+        if (m == 2)
+        {
+            d[0] = d[1] = delta[0];
+            return;
+        }
+
+        d[0] = pchipEndDerivative(h[0], h[1], delta[0], delta[1]);
+        d[m - 1] = pchipEndDerivative(h[m - 2], h[m - 3], delta[m - 2], delta[m - 3]);
+
+        for (size_t i = 1; i < m - 1; ++i)
+        {
+            if (delta[i - 1] * delta[i] <= 0.0)
+            {
+                // Local extremum: zero derivative keeps the curve monotone
+                d[i] = 0.0;
+            }
+            else
+            {
+                // Weighted harmonic mean of the adjacent secants
+                const double w1 = 2.0 * h[i] + h[i - 1];
+                const double w2 = 2.0 * h[i - 1] + h[i];
+                d[i] = (w1 + w2) / (w1 / delta[i - 1] + w2 / delta[i]);
+            }
+        }
+    }
+
+    // Nodal derivatives of the natural cubic spline (Thomas algorithm on the second derivatives)
+    void computeSplineDerivatives()
+    {
+        const size_t m = xs.size();
+        d.assign(m, 0.0);
+
+        if (m == 2)
+        {
+            d[0] = d[1] = delta[0];
+            return;
+        }
+
+        // Second derivatives M, with M[0] = M[m-1] = 0
+        std::vector<double> M(m, 0.0);
+        std::vector<double> c(m, 0.0);   // Modified super-diagonal
+        std::vector<double> r(m, 0.0);   // Modified right-hand side
+
+        for (size_t i = 1; i < m - 1; ++i)
+        {
+            const double diag = 2.0 * (h[i - 1] + h[i]) - h[i - 1] * c[i - 1];
+            const double rhs = 6.0 * (delta[i] - delta[i - 1]) - h[i - 1] * r[i - 1];
+            c[i] = h[i] / diag;
+            r[i] = rhs / diag;
+        }
+        for (size_t i = m - 2; i >= 1; --i)
+        {
+            M[i] = r[i] - c[i] * M[i + 1];
+        }
+
+        // The spline restricted to an interval is the cubic Hermite with these slopes
+        for (size_t i = 0; i < m - 1; ++i)
+        {
+            d[i] = delta[i] - h[i] * (2.0 * M[i] + M[i + 1]) / 6.0;
+        }
+        d[m - 1] = delta[m - 2] + h[m - 2] * (M[m - 2] + 2.0 * M[m - 1]) / 6.0;
+    }
+
+    // Index k of the interval [xs[k], xs[k+1]] containing xq (xq inside the table)
+    size_t locate(double xq) const
+    {
+        const size_t last = xs.size() - 2;
+        if (uniform)
+        {
+            const size_t k = static_cast<size_t>((xq - xs.front()) * invStep);
+            return std::min(k, last);
+        }
+        const auto it = std::upper_bound(xs.begin() + 1, xs.end() - 1, xq);
+        return static_cast<size_t>(it - xs.begin()) - 1;
+    }
+
+public:
+    TabulatedInterpolant() = default;
+
+    /**
+     * @brief Builds the interpolant and precomputes everything that depends on the table.
+     * @param x Sample abscissae (any order, duplicates are merged pairwise).
+     * @param y Sample ordinates.
+     * @param method Interpolation scheme.
+     * @param extrapolation Behaviour outside the tabulated range.
+     * @throws std::invalid_argument If the data is empty or x and y differ in size.
+     */
+    TabulatedInterpolant(const std::vector<double>& x,
+                         const std::vector<double>& y,
+                         TabulatedMethod method = TabulatedMethod::PCHIP,
+                         TabulatedExtrapolation extrapolation = TabulatedExtrapolation::LINEAR)
+        : method(method), extrapolation(extrapolation)
+    {
+        if (x.empty() || x.size() != y.size())
+        {
+            throw std::invalid_argument("TabulatedInterpolant: x and y must be non-empty and of the same size");
+        }
+
+        sortAndMerge(x, y);
+
+        const size_t m = xs.size();
+        if (m < 2)
+        {
+            return;
+        }
+
+        h.resize(m - 1);
+        delta.resize(m - 1);
+        for (size_t i = 0; i < m - 1; ++i)
+        {
+            h[i] = xs[i + 1] - xs[i];
+            delta[i] = (ys[i + 1] - ys[i]) / h[i];
+        }
+
+        const double step = (xs.back() - xs.front()) / static_cast<double>(m - 1);
+        uniform = std::all_of(h.begin(), h.end(), [&](double hi) {
+            return std::abs(hi - step) <= 1e3 * tolerance * step;
+        });
+        invStep = 1.0 / step;
+
+        switch (method)
+        {
+        case TabulatedMethod::PCHIP:
+            computePchipDerivatives();
+            break;
+        case TabulatedMethod::NATURAL_SPLINE:
+            computeSplineDerivatives();
+            break;
+        default:
+            break;
+        }
+    }
+
+    /**
+     * @brief Evaluates the interpolant at xq.
+     * @param xq Query abscissa.
+     * @return Interpolated (or extrapolated) value.
+     */
+    double evaluate(double xq) const
+    {
+        const size_t m = xs.size();
+        if (m == 0)
+        {
+            return 0.0;
+        }
+        if (m == 1)
+        {
+            return ys[0];
+        }
+
+        // Outside the table: secant of the edge interval, or the edge value
+        if (xq <= xs.front())
+        {
+            return extrapolation == TabulatedExtrapolation::LINEAR
+                ? ys.front() + delta.front() * (xq - xs.front())
+                : ys.front();
+        }
+        if (xq >= xs.back())
+        {
+            return extrapolation == TabulatedExtrapolation::LINEAR
+                ? ys.back() + delta.back() * (xq - xs.back())
+                : ys.back();
+        }
+
+        const size_t k = locate(xq);
+        const double s = xq - xs[k];
+
+        if (method == TabulatedMethod::LINEAR)
+        {
+            return ys[k] + delta[k] * s;
+        }
+
+        // Cubic Hermite on [xs[k], xs[k+1]] in Newton form
+        const double c2 = (3.0 * delta[k] - 2.0 * d[k] - d[k + 1]) / h[k];
+        const double c3 = (d[k] + d[k + 1] - 2.0 * delta[k]) / (h[k] * h[k]);
+        return ys[k] + s * (d[k] + s * (c2 + s * c3));
+    }
+
+    /**
+     * @brief Evaluates the interpolant at n query points.
+     * @param xq Pointer to n query abscissae.
+     * @param yq Pointer to n output values (written).
+     * @param n Number of query points.
+     */
+    void evaluate(const double* xq, double* yq, size_t n) const
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            yq[i] = evaluate(xq[i]);
+        }
+    }
+
+    /**
+     * @brief Evaluates the interpolant at every query point of a vector.
+     * @param xq Query abscissae.
+     * @return Interpolated values, one per query point.
+     */
+    std::vector<double> evaluate(const std::vector<double>& xq) const
+    {
+        std::vector<double> yq(xq.size());
+        evaluate(xq.data(), yq.data(), xq.size());
+        return yq;
+    }
+
+    // Getters
+    TabulatedMethod getMethod() const { return method; }
+    TabulatedExtrapolation getExtrapolation() const { return extrapolation; }
+    const std::vector<double>& getXValues() const { return xs; }
+    const std::vector<double>& getYValues() const { return ys; }
+    const std::vector<double>& getDerivatives() const { return d; }
+    bool isUniform() const { return uniform; }
+    double getMinX() const { return xs.front(); }
+    double getMaxX() const { return xs.back(); }
+};
@@ -0,0 +1,17 @@
+#ifndef TABULATED_METHOD_H
+#define TABULATED_METHOD_H
+
+// Piecewise interpolation schemes available in TabulatedInterpolant
+enum class TabulatedMethod {
+    LINEAR,         // Piecewise linear through the samples
+    PCHIP,          // Shape-preserving piecewise cubic Hermite (Fritsch-Carlson)
+    NATURAL_SPLINE  // C2 cubic spline with zero second derivative at both ends
+};
+
+// Behaviour of TabulatedInterpolant outside [x_min, x_max]
+enum class TabulatedExtrapolation {
+    LINEAR,         // Extends the secant of the first/last interval
+    CLAMP           // Returns the first/last sample value
+};
+
+#endif
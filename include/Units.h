@@ -0,0 +1,261 @@
+#ifndef UNITS_H
+#define UNITS_H
+
+#include <cstddef>
+#include <type_traits>
+#include "EnumLENGTH.h"
+#include "EnumMASS.h"
+#include "EnumSPEED.h"
+#include "EnumAREA.h"
+#include "EnumFORCE.h"
+#include "EnumPOWER.h"
+#include "EnumPressure.h"
+#include "EnumDENSITY.h"
+#include "EnumAngle.h"
+
+// =============================================================================
+//  UNITS  —  grandezze tipizzate con fattori di conversione constexpr
+//
+//  Ogni unità è un tipo con la sua dimensione e il fattore verso SI; una
+//  Quantity<Unit> è un double con l'unità nel tipo. La conversione tra unità
+//  della stessa dimensione è una sola moltiplicazione per una costante nota a
+//  compile time; unità di dimensioni diverse non si convertono (errore di
+//  compilazione):
+//
+//    UNITS::Length<UNITS::m>  d(1.2);
+//    UNITS::Length<UNITS::ft> dFt = d;           // 3.937 ft
+//    double x = UNITS::convert<UNITS::m, UNITS::ft>(1.2);
+//    UNITS::Length<UNITS::kg> e(1.0);            // non compila: kg non è una lunghezza
+//
+//  Per il codice che usa ancora gli enum Length, Mass, Speed, ... c'è
+//  UNITS::factor(from, to), constexpr, con gli stessi fattori dei tipi.
+//
+//  Nota: i fattori sono quelli esatti delle definizioni (1 ft = 0.3048 m,
+//  1 lb = 0.45359237 kg, ...). Per FT<->NMI, KG<->LB, le SLUG e DEG<->RAD le
+//  classi Conv* usano valori arrotondati: le differenze sono sotto 1e-5
+//  relativo (DEG<->RAD: Conv* usa 57.3).
+// =============================================================================
+
+namespace UNITS {
+
+// ── Dimensioni ───────────────────────────────────────────────────────────────
+struct LengthDimension {};
+struct MassDimension {};
+struct SpeedDimension {};
+struct AreaDimension {};
+struct ForceDimension {};
+struct PowerDimension {};
+struct PressureDimension {};
+struct DensityDimension {};
+struct AngleDimension {};
+
+// ── Unità: dimensione e fattore verso l'unità SI ─────────────────────────────
+struct m       { using dimension = LengthDimension;   static constexpr double toSI = 1.0; };
+struct ft      { using dimension = LengthDimension;   static constexpr double toSI = 0.3048; };
+struct nmi     { using dimension = LengthDimension;   static constexpr double toSI = 1852.0; };
+
+struct kg      { using dimension = MassDimension;     static constexpr double toSI = 1.0; };
+struct lb      { using dimension = MassDimension;     static constexpr double toSI = 0.45359237; };
+struct slug    { using dimension = MassDimension;     static constexpr double toSI = 14.59390294; };
+
+struct mps     { using dimension = SpeedDimension;    static constexpr double toSI = 1.0; };
+struct fps     { using dimension = SpeedDimension;    static constexpr double toSI = 0.3048; };
+struct fpm     { using dimension = SpeedDimension;    static constexpr double toSI = 0.3048 / 60.0; };
+struct kmh     { using dimension = SpeedDimension;    static constexpr double toSI = 1.0 / 3.6; };
+struct kt      { using dimension = SpeedDimension;    static constexpr double toSI = 1852.0 / 3600.0; };
+
+struct m2      { using dimension = AreaDimension;     static constexpr double toSI = 1.0; };
+struct ft2     { using dimension = AreaDimension;     static constexpr double toSI = 0.3048 * 0.3048; };
+
+struct N       { using dimension = ForceDimension;    static constexpr double toSI = 1.0; };
+struct lbf     { using dimension = ForceDimension;    static constexpr double toSI = 4.4482216152605; };
+
+struct W       { using dimension = PowerDimension;    static constexpr double toSI = 1.0; };
+struct hp      { using dimension = PowerDimension;    static constexpr double toSI = 745.69987158227022; };
+
+struct Pa      { using dimension = PressureDimension; static constexpr double toSI = 1.0; };
+struct psf     { using dimension = PressureDimension; static constexpr double toSI = 47.880258980335840; };
+
+struct kgm3    { using dimension = DensityDimension;  static constexpr double toSI = 1.0; };
+struct slugft3 { using dimension = DensityDimension;  static constexpr double toSI = 515.37881852553; };
+
+struct rad     { using dimension = AngleDimension;    static constexpr double toSI = 1.0; };
+struct deg     { using dimension = AngleDimension;    static constexpr double toSI = 3.14159265358979323846 / 180.0; };
+
+/**
+ * @brief Conversion factor between two units of the same dimension
+ * @tparam From Source unit
+ * @tparam To Target unit
+ */
+template <typename From, typename To>
+constexpr double ratio() {
+    static_assert(std::is_same_v<typename From::dimension, typename To::dimension>,
+                  "UNITS: conversione tra dimensioni diverse");
+    return From::toSI / To::toSI;
+}
+
+/**
+ * @brief Converts a raw value: a single multiplication by a compile-time constant
+ */
+template <typename From, typename To>
+constexpr double convert(double value) {
+    return value * ratio<From, To>();
+}
+
+/**
+ * @brief Multiplies n contiguous values by a factor in place, without allocating
+ */
+inline void scale(double* data, size_t n, double factor) noexcept {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t i = 0; i < n; ++i) {
+        data[i] *= factor;
+    }
+}
+
+/**
+ * @brief Writes dst[i] = src[i] * factor; src and dst may be the same array
+ */
+inline void scale(const double* src, double* dst, size_t n, double factor) noexcept {
+    if (src == dst) {
+        scale(dst, n, factor);
+        return;
+    }
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = src[i] * factor;
+    }
+}
+
+/**
+ * @brief Bulk in-place conversion of n raw values (one compile-time factor)
+ */
+template <typename From, typename To>
+void convert(double* data, size_t n) noexcept {
+    scale(data, n, ratio<From, To>());
+}
+
+/**
+ * @brief Bulk out-of-place conversion of n raw values (one compile-time factor)
+ */
+template <typename From, typename To>
+void convert(const double* src, double* dst, size_t n) noexcept {
+    scale(src, dst, n, ratio<From, To>());
+}
+
+/**
+ * @brief Value with its unit encoded in the type
+ * @tparam Unit Unit tag (m, ft, kg, ...)
+ */
+template <typename Unit>
+class Quantity {
+private:
+    double v = 0.0;
+
+public:
+    using unit = Unit;
+    using dimension = typename Unit::dimension;
+
+    constexpr Quantity() = default;
+    constexpr explicit Quantity(double value) : v(value) {}
+
+    /// Conversione implicita da un'altra unità della stessa dimensione
+    template <typename Other,
+              typename = std::enable_if_t<std::is_same_v<typename Other::dimension, dimension>>>
+    constexpr Quantity(Quantity<Other> other) : v(other.value() * ratio<Other, Unit>()) {}
+
+    /// Valore numerico nell'unità del tipo
+    constexpr double value() const { return v; }
+
+    /// Valore convertito in un'altra unità
+    template <typename To>
+    constexpr Quantity<To> to() const { return Quantity<To>(v * ratio<Unit, To>()); }
+
+    constexpr Quantity operator+(Quantity o) const { return Quantity(v + o.v); }
+    constexpr Quantity operator-(Quantity o) const { return Quantity(v - o.v); }
+    constexpr Quantity operator-() const { return Quantity(-v); }
+    constexpr Quantity operator*(double s) const { return Quantity(v * s); }
+    constexpr Quantity operator/(double s) const { return Quantity(v / s); }
+    constexpr double operator/(Quantity o) const { return v / o.v; }   // Rapporto adimensionale
+
+    Quantity& operator+=(Quantity o) { v += o.v; return *this; }
+    Quantity& operator-=(Quantity o) { v -= o.v; return *this; }
+    Quantity& operator*=(double s) { v *= s; return *this; }
+    Quantity& operator/=(double s) { v /= s; return *this; }
+
+    constexpr bool operator==(Quantity o) const { return v == o.v; }
+    constexpr bool operator!=(Quantity o) const { return v != o.v; }
+    constexpr bool operator<(Quantity o) const { return v < o.v; }
+    constexpr bool operator<=(Quantity o) const { return v <= o.v; }
+    constexpr bool operator>(Quantity o) const { return v > o.v; }
+    constexpr bool operator>=(Quantity o) const { return v >= o.v; }
+};
+
+template <typename Unit>
+constexpr Quantity<Unit> operator*(double s, Quantity<Unit> q) { return q * s; }
+
+// ── Alias per dimensione: l'unità deve appartenere alla dimensione ──────────
+template <typename Unit, typename Dimension>
+using QuantityOf = std::enable_if_t<std::is_same_v<typename Unit::dimension, Dimension>, Quantity<Unit>>;
+
+template <typename Unit> using Length   = QuantityOf<Unit, LengthDimension>;
+template <typename Unit> using Mass     = QuantityOf<Unit, MassDimension>;
+template <typename Unit> using Speed    = QuantityOf<Unit, SpeedDimension>;
+template <typename Unit> using Area     = QuantityOf<Unit, AreaDimension>;
+template <typename Unit> using Force    = QuantityOf<Unit, ForceDimension>;
+template <typename Unit> using Power    = QuantityOf<Unit, PowerDimension>;
+template <typename Unit> using Pressure = QuantityOf<Unit, PressureDimension>;
+template <typename Unit> using Density  = QuantityOf<Unit, DensityDimension>;
+template <typename Unit> using Angle    = QuantityOf<Unit, AngleDimension>;
+
+// ── Adattatori per gli enum esistenti ────────────────────────────────────────
+constexpr double toSI(::Length u) {
+    switch (u) {
+    case ::Length::FT:  return ft::toSI;
+    case ::Length::NMI: return nmi::toSI;
+    default:            return m::toSI;
+    }
+}
+
+constexpr double toSI(::Mass u) {
+    switch (u) {
+    case ::Mass::LB:   return lb::toSI;
+    case ::Mass::SLUG: return slug::toSI;
+    default:           return kg::toSI;
+    }
+}
+
+constexpr double toSI(::Speed u) {
+    switch (u) {
+    case ::Speed::FT_TO_S:   return fps::toSI;
+    case ::Speed::FT_TO_MIN: return fpm::toSI;
+    case ::Speed::KM_TO_H:   return kmh::toSI;
+    case ::Speed::KTS:       return kt::toSI;
+    default:                 return mps::toSI;
+    }
+}
+
+constexpr double toSI(::Area u)     { return u == ::Area::SQUARE_FEET ? ft2::toSI : m2::toSI; }
+constexpr double toSI(::Force u)    { return u == ::Force::POUND_FORCE ? lbf::toSI : N::toSI; }
+constexpr double toSI(::Power u)    { return u == ::Power::HP ? hp::toSI : W::toSI; }
+constexpr double toSI(::Pressure u) { return u == ::Pressure::PSF ? psf::toSI : Pa::toSI; }
+constexpr double toSI(::Density u)  { return u == ::Density::SLUGS_TO_FT3 ? slugft3::toSI : kgm3::toSI; }
+constexpr double toSI(::Angle u)    { return u == ::Angle::DEG ? deg::toSI : rad::toSI; }
+
+/**
+ * @brief Conversion factor between two enum units (Length, Mass, Speed, ...)
+ *
+ * constexpr: with constant arguments it folds to a literal, with runtime
+ * arguments it is a table-like switch instead of the if/else chains of Conv*.
+ */
+template <typename UnitEnum>
+constexpr double factor(UnitEnum from, UnitEnum to) {
+    return toSI(from) / toSI(to);
+}
+
+} // namespace UNITS
+
+#endif
@@ -0,0 +1,492 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <atomic>
+#include <map>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <iostream>
+#include "VSPAeroGenerator.h"
+#include "READPOLARFILE.h"
+#include "PROCESSRUNNER.h"
+#include "FNV1AHASH.h"
+
+// =============================================================================
+//  VSPAeroScheduler  —  esecuzione concorrente di casi VSPAERO
+//
+//  Ogni caso gira in una cartella di lavoro propria (<workRoot>/job_<n>) con
+//  uno stem fisso: la geometria degenerata viene collegata o copiata lì, il
+//  .vspaero viene scritto lì e VSPAERO parte con la cartella come working
+//  directory del solo processo figlio. Il CWD globale non viene mai toccato,
+//  quindi più casi (e più SilentorComponent) possono girare insieme.
+//
+//    VSP::VSPAeroScheduler scheduler;                 // K e -omp dal numero di core
+//    auto f = scheduler.submit({parent / "MyAC_copy_DegenGeom", settings, controls});
+//    const auto& polar = f.get().polar;
+//
+//  Cache dei risultati: la chiave è l'hash FNV-1a dei file di ingresso del
+//  solutore (geometria degenerata e .vspaero scritto da VSPAeroGenerator,
+//  che è la serializzazione canonica di AeroSettings e delle deflessioni)
+//  più il nome dell'eseguibile. .polar e .lod vengono conservati in
+//  <cacheDirectory>/<chiave>.*: un caso già risolto, anche da un'esecuzione
+//  precedente del programma, non lancia VSPAERO.
+// =============================================================================
+
+namespace VSP {
+
+/**
+ * @brief Runs a shell command with the given working directory for the child only
+ * @param command Command line to execute
+ * @param directory Working directory of the launched process
+ * @return int Exit code of the command; -1 if it could not start, timed out or was killed
+ */
+inline int runInDirectory(const std::string& command, const std::filesystem::path& directory) {
+    PROCESS::ProcessOptions options = PROCESS::defaults();
+    options.workingDirectory = directory;
+    options.captureOutput = false;
+    const PROCESS::ProcessResult result = PROCESS::runShell(command, options);
+    if (!result.started) {
+        std::cerr << "[ERROR] " << result.error << std::endl;
+    }
+    else if (result.timedOut) {
+        std::cerr << "[ERROR] Timed out after " << result.elapsedSeconds << " s: " << command << std::endl;
+    }
+    return (result.started && !result.timedOut && result.signal == 0) ? result.exitCode : -1;
+}
+
+/**
+ * @brief One VSPAERO case
+ */
+struct VSPAeroJob {
+    std::filesystem::path geometryStem;     // Es. <cartella>/<nome>_copy_DegenGeom, senza estensione
+    AeroSettings settings;
+    std::vector<ControlSurface> controls;
+    std::string rotorConfig = "P";          // Config passata a writeRotors
+    std::string vspaeroExecutable;          // Vuoto = quello dello scheduler
+};
+
+/**
+ * @brief Parsed output of one VSPAERO case
+ */
+struct VSPAeroResult {
+    std::vector<VSPPolar::PolarPoint> polar;
+    std::vector<std::string> headers;
+    int exitCode = 0;
+    std::filesystem::path workingDirectory;  // Vuoto se la cartella è stata rimossa
+    std::filesystem::path loadFile;          // .lod del caso (in cache o nella cartella conservata), se esiste
+    bool fromCache = false;                  // true se VSPAERO non è stato lanciato
+};
+
+/**
+ * @brief Concurrency, executable and working directory settings of a VSPAeroScheduler
+ */
+struct VSPAeroSchedulerOptions {
+    size_t concurrentJobs = 0;          // K; 0 = dal numero di core
+    int threadsPerJob = 0;              // -omp di ogni caso; 0 = dal numero di core
+    std::string vspaeroExecutable = "vspaero.exe";
+    std::filesystem::path workRoot;     // Vuoto = <temp>/vspaero_jobs
+    bool keepWorkingDirectories = false;
+    double timeoutSeconds = 0.0;          // Tempo massimo di un tentativo di VSPAERO; 0 = nessun limite
+    int retries = 0;                      // Tentativi aggiuntivi se VSPAERO fallisce o va in timeout
+    bool useResultCache = true;
+    std::filesystem::path cacheDirectory; // Vuoto = <temp>/vspaero_cache
+};
+
+class VSPAeroScheduler {
+public:
+    using Options = VSPAeroSchedulerOptions;
+
+    /**
+     * @brief Starts the worker threads
+     * @param options Concurrency, executable and working directory settings
+     */
+    inline explicit VSPAeroScheduler(Options options = Options()) : options(std::move(options)) {
+        if (this->options.workRoot.empty()) {
+            this->options.workRoot = std::filesystem::temp_directory_path() / "vspaero_jobs";
+        }
+        std::filesystem::create_directories(this->options.workRoot);
+        if (this->options.useResultCache) {
+            if (this->options.cacheDirectory.empty()) {
+                this->options.cacheDirectory = std::filesystem::temp_directory_path() / "vspaero_cache";
+            }
+            std::filesystem::create_directories(this->options.cacheDirectory);
+        }
+
+        chooseConcurrency(std::thread::hardware_concurrency(),
+                          this->options.concurrentJobs, this->options.threadsPerJob);
+
+        for (size_t i = 0; i < this->options.concurrentJobs; ++i) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    /**
+     * @brief Completes the queued jobs and joins the workers
+     */
+    inline ~VSPAeroScheduler() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    VSPAeroScheduler(const VSPAeroScheduler&) = delete;
+    VSPAeroScheduler& operator=(const VSPAeroScheduler&) = delete;
+
+    /**
+     * @brief Shared scheduler with the default options, created on first use
+     */
+    static VSPAeroScheduler& shared() {
+        static VSPAeroScheduler instance;
+        return instance;
+    }
+
+    /**
+     * @brief Splits the cores between K jobs and the -omp threads of each job
+     *
+     * With both values unset each job keeps the historical -omp 4 (or fewer
+     * on small machines) and K = cores / 4; with one value set the other one
+     * takes the remaining cores. Both are at least 1.
+     *
+     * @param cores Available hardware threads (0 if unknown)
+     * @param jobs In/out: concurrent jobs, 0 = automatic
+     * @param threads In/out: -omp threads per job, 0 = automatic
+     */
+    static void chooseConcurrency(unsigned cores, size_t& jobs, int& threads) {
+        const size_t n = std::max<size_t>(cores, 1);
+        if (jobs == 0 && threads <= 0) {
+            threads = static_cast<int>(std::min<size_t>(4, n));
+            jobs = std::max<size_t>(1, n / static_cast<size_t>(threads));
+        }
+        else if (jobs == 0) {
+            jobs = std::max<size_t>(1, n / static_cast<size_t>(threads));
+        }
+        else if (threads <= 0) {
+            threads = static_cast<int>(std::max<size_t>(1, n / jobs));
+        }
+    }
+
+    /**
+     * @brief Queues a case
+     * @param job Geometry, settings and control surfaces of the case
+     * @return std::future<VSPAeroResult> Parsed polar; get() rethrows std::runtime_error
+     *         if the files cannot be staged or VSPAERO produces no polar
+     */
+    inline std::future<VSPAeroResult> submit(VSPAeroJob job) {
+        auto task = std::make_shared<std::packaged_task<VSPAeroResult()>>(
+            [this, job = std::move(job)] { return run(job); });
+        std::future<VSPAeroResult> result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (stopping) {
+                throw std::runtime_error("VSPAeroScheduler: submit after shutdown");
+            }
+            queue.emplace_back([task] { (*task)(); });
+        }
+        wakeUp.notify_one();
+        return result;
+    }
+
+    /**
+     * @brief Queues several cases, results in the same order
+     */
+    inline std::vector<std::future<VSPAeroResult>> submit(std::vector<VSPAeroJob> jobs) {
+        std::vector<std::future<VSPAeroResult>> results;
+        results.reserve(jobs.size());
+        for (auto& job : jobs) {
+            results.push_back(submit(std::move(job)));
+        }
+        return results;
+    }
+
+    /**
+     * @brief Drops the in-memory results; with removeFiles also the persisted ones
+     */
+    inline void clearCache(bool removeFiles = false) {
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            cache.clear();
+        }
+        if (removeFiles && !options.cacheDirectory.empty()) {
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator(options.cacheDirectory, ec)) {
+                std::filesystem::remove(entry.path(), ec);
+            }
+        }
+    }
+
+    // Getters
+    size_t getConcurrentJobs() const { return options.concurrentJobs; }
+    int getThreadsPerJob() const { return options.threadsPerJob; }
+    const std::filesystem::path& getWorkRoot() const { return options.workRoot; }
+    const std::filesystem::path& getCacheDirectory() const { return options.cacheDirectory; }
+
+private:
+    Options options;
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> queue;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    bool stopping = false;
+
+    std::mutex cacheMutex;
+    std::map<std::uint64_t, VSPAeroResult> cache;   // Risultati già letti, per chiave
+
+    static constexpr const char* stem = "case";   // File del caso: case_DegenGeom.*
+
+    inline void workerLoop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeUp.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (queue.empty()) {
+                    return;   // stopping e coda vuota
+                }
+                task = std::move(queue.front());
+                queue.pop_front();
+            }
+            task();
+        }
+    }
+
+    /**
+     * @brief Creates a fresh job_<n> directory, unique also across schedulers
+     */
+    inline std::filesystem::path makeWorkingDirectory() {
+        static std::atomic<unsigned long> counter{0};
+        for (;;) {
+            const auto dir = options.workRoot / ("job_" + std::to_string(counter++));
+            if (std::filesystem::create_directory(dir)) {
+                return dir;
+            }
+        }
+    }
+
+    /**
+     * @brief Links (or copies) the degenerate geometry files into the job directory
+     */
+    static void stageGeometry(const std::filesystem::path& geometryStem, const std::filesystem::path& dir) {
+        bool staged = false;
+        for (const char* extension : {".csv", ".m", ".vspgeom"}) {
+            std::filesystem::path source = geometryStem;
+            source += extension;
+            if (!std::filesystem::exists(source)) {
+                continue;
+            }
+            const auto target = dir / (std::string(stem) + "_DegenGeom" + extension);
+            std::error_code ec;
+            std::filesystem::create_hard_link(source, target, ec);
+            if (ec) {
+                std::filesystem::copy_file(source, target, std::filesystem::copy_options::overwrite_existing);
+            }
+            staged = true;
+        }
+        if (!staged) {
+            throw std::runtime_error("VSPAeroScheduler: no degenerate geometry for " + geometryStem.string());
+        }
+    }
+
+    static void hashField(const std::string& text, std::uint64_t& hash) {
+        const unsigned char separator = 0xff;   // Separatore tra i campi
+        hash = FNV1A::hashString(text, hash);
+        hash = FNV1A::hashBytes(&separator, 1, hash);
+    }
+
+    /**
+     * @brief Key of a staged case: solver input files plus the executable
+     * @return false if an input file cannot be read (case not cacheable)
+     */
+    static bool caseKey(const std::filesystem::path& dir, const std::string& executable, std::uint64_t& key) {
+        key = FNV1A::offsetBasis;
+        hashField("VSPAERORESULT 1", key);
+        hashField(executable, key);
+        for (const char* extension : {".csv", ".m", ".vspgeom", ".vspaero"}) {
+            const auto path = dir / (std::string(stem) + "_DegenGeom" + extension);
+            if (!std::filesystem::exists(path)) {
+                continue;
+            }
+            hashField(extension, key);
+            if (!FNV1A::hashFile(path.string(), key)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline std::filesystem::path cachePath(std::uint64_t key, const char* extension) const {
+        char name[17];
+        std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+        return options.cacheDirectory / (std::string(name) + extension);
+    }
+
+    /**
+     * @brief Looks up a key in memory, then on disk
+     */
+    inline bool loadCached(std::uint64_t key, VSPAeroResult& result) {
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            const auto it = cache.find(key);
+            if (it != cache.end()) {
+                result = it->second;
+                return true;
+            }
+        }
+
+        const auto polarPath = cachePath(key, ".polar");
+        if (!std::filesystem::exists(polarPath)) {
+            return false;
+        }
+        try {
+            VSPPolar::PolarReader reader;
+            reader.readFile(polarPath.string());
+            result.polar = reader.getData();
+            result.headers = reader.getHeaders();
+        }
+        catch (const std::exception&) {
+            return false;   // Voce rovinata: si ricalcola e si sovrascrive
+        }
+        const auto loadPath = cachePath(key, ".lod");
+        if (std::filesystem::exists(loadPath)) {
+            result.loadFile = loadPath;
+        }
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cache[key] = result;
+        return true;
+    }
+
+    /**
+     * @brief Persists the outputs of a solved case (copy to .tmp, then rename)
+     */
+    inline void storeCached(std::uint64_t key, const std::filesystem::path& dir, VSPAeroResult& result) {
+        for (const char* extension : {".polar", ".lod"}) {
+            const auto source = dir / (std::string(stem) + "_DegenGeom" + extension);
+            if (!std::filesystem::exists(source)) {
+                continue;
+            }
+            const auto target = cachePath(key, extension);
+            std::filesystem::path tmp = target;
+            tmp += ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+            std::error_code ec;
+            std::filesystem::copy_file(source, tmp, std::filesystem::copy_options::overwrite_existing, ec);
+            if (!ec) {
+                std::filesystem::rename(tmp, target, ec);
+            }
+            if (ec) {
+                std::filesystem::remove(tmp, ec);
+                std::cerr << "[WARNING] VSPAeroScheduler: cannot cache " << target.string() << std::endl;
+                continue;
+            }
+            if (std::string(extension) == ".lod") {
+                result.loadFile = target;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cache[key] = result;
+    }
+
+    inline VSPAeroResult run(const VSPAeroJob& job) {
+        const std::filesystem::path dir = makeWorkingDirectory();
+        VSPAeroResult result;
+
+        try {
+            stageGeometry(job.geometryStem, dir);
+
+            {
+                VSPAeroGenerator vspaero((dir / stem).string());
+                vspaero.writeSettings(job.settings);
+                vspaero.writeRotors(job.settings, job.rotorConfig);
+                vspaero.writeControlSurfaces(job.controls);
+                vspaero.writeFooter(job.settings);
+            }
+
+            const std::string caseName = std::string(stem) + "_DegenGeom";
+            const std::string& executable = job.vspaeroExecutable.empty() ? options.vspaeroExecutable
+                                                                          : job.vspaeroExecutable;
+
+            std::uint64_t key = 0;
+            const bool cacheable = options.useResultCache && caseKey(dir, executable, key);
+            if (cacheable && loadCached(key, result)) {
+                result.fromCache = true;
+                std::error_code ec;
+                std::filesystem::remove_all(dir, ec);
+                return result;
+            }
+
+            const std::string command = executable + " -omp " +
+                                        std::to_string(options.threadsPerJob) + " " + caseName;
+            PROCESS::ProcessOptions process;
+            process.workingDirectory = dir;
+            process.timeoutSeconds = options.timeoutSeconds;
+            process.retries = options.retries;
+            process.captureOutput = false;   // Il log di VSPAERO non serve: si legge il .polar
+            const PROCESS::ProcessResult launched = PROCESS::runShell(command, process);
+            if (!launched.started) {
+                throw std::runtime_error("VSPAERO not started: " + launched.error);
+            }
+            if (launched.timedOut) {
+                throw std::runtime_error("VSPAERO timed out after " + std::to_string(launched.elapsedSeconds) +
+                                         " s (" + std::to_string(launched.attempts) + " attempts) in " + dir.string());
+            }
+            result.exitCode = launched.signal == 0 ? launched.exitCode : -1;
+
+            const auto polarPath = dir / (caseName + ".polar");
+            if (!std::filesystem::exists(polarPath)) {
+                throw std::runtime_error("VSPAERO produced no polar (ret=" + std::to_string(result.exitCode) +
+                                         ") in " + dir.string());
+            }
+            if (result.exitCode != 0) {
+                std::cerr << "[WARNING] VSPAERO returned " << result.exitCode << " in " << dir.string() << std::endl;
+            }
+
+            VSPPolar::PolarReader reader;
+            reader.readFile(polarPath.string());
+            result.polar = reader.getData();
+            result.headers = reader.getHeaders();
+
+            const auto loadPath = dir / (caseName + ".lod");
+            if (options.keepWorkingDirectories && std::filesystem::exists(loadPath)) {
+                result.loadFile = loadPath;
+            }
+            // Solo i casi riusciti: un polar parziale non deve sopravvivere in cache
+            if (cacheable && result.exitCode == 0 && !result.polar.empty()) {
+                storeCached(key, dir, result);
+            }
+        }
+        catch (...) {
+            if (!options.keepWorkingDirectories) {
+                std::error_code ec;
+                std::filesystem::remove_all(dir, ec);
+            }
+            throw;
+        }
+
+        if (options.keepWorkingDirectories) {
+            result.workingDirectory = dir;
+        }
+        else {
+            std::error_code ec;
+            std::filesystem::remove_all(dir, ec);
+        }
+        return result;
+    }
+};
+
+} // namespace VSP
@@ -8,6 +8,14 @@
 #include <sstream>
 #include <algorithm>
 #include <filesystem>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include "PROCESSRUNNER.h"
+#include "FNV1AHASH.h"
 
 
 namespace VSPGEOMTRYEXTRACTOR
@@ -30,12 +38,161 @@ namespace VSPGEOMTRYEXTRACTOR
 
     };
 
+    /// @brief Process-wide cache of the geometry data, keyed by the content hash of the .vsp3 file.
+    ///
+    /// The geometry list depends only on the content of the .vsp3, so every analysis that
+    /// asks for the same unchanged file reuses the first result instead of launching
+    /// vspscript again. With setPersistent(true) the result is also written next to the
+    /// .vsp3 ("<aircraft>.vsp3.geoms") and reused by later runs; the file stores the
+    /// content hash and is ignored as soon as the .vsp3 changes.
+    class GeometryCache
+    {
+    private:
+        struct State
+        {
+            std::mutex mutex;
+            std::map<std::uint64_t, AircraftGeometryData> entries;
+            bool persistent = false;
+        };
+
+        static State &state()
+        {
+            static State instance;
+            return instance;
+        }
+
+    public:
+        /// @brief 64-bit FNV-1a hash of a whole file.
+        /// @param path The file to hash.
+        /// @param hash Output hash.
+        /// @return false if the file cannot be read.
+        static bool hashFile(const std::string &path, std::uint64_t &hash)
+        {
+            hash = FNV1A::offsetBasis;
+            return FNV1A::hashFile(path, hash);
+        }
+
+        /// @brief Looks up the geometry data of a .vsp3 content hash.
+        /// @return true if found (data is then filled in).
+        static bool find(std::uint64_t hash, AircraftGeometryData &data)
+        {
+            std::lock_guard<std::mutex> lock(state().mutex);
+            auto it = state().entries.find(hash);
+            if (it == state().entries.end())
+            {
+                return false;
+            }
+            data = it->second;
+            return true;
+        }
+
+        /// @brief Stores the geometry data of a .vsp3 content hash.
+        static void store(std::uint64_t hash, const AircraftGeometryData &data)
+        {
+            std::lock_guard<std::mutex> lock(state().mutex);
+            state().entries[hash] = data;
+        }
+
+        /// @brief Empties the in-process cache (the files on disk are left untouched).
+        static void clear()
+        {
+            std::lock_guard<std::mutex> lock(state().mutex);
+            state().entries.clear();
+        }
+
+        /// @brief Enables or disables the on-disk copy of the cache (disabled by default).
+        static void setPersistent(bool enabled)
+        {
+            std::lock_guard<std::mutex> lock(state().mutex);
+            state().persistent = enabled;
+        }
+
+        static bool isPersistent()
+        {
+            std::lock_guard<std::mutex> lock(state().mutex);
+            return state().persistent;
+        }
+
+        /// @brief Path of the on-disk cache associated with a .vsp3 file.
+        static std::string cachePathFor(const std::string &vsp3Path)
+        {
+            return vsp3Path + ".geoms";
+        }
+    };
+
+    class GeometrySession;
+
     class GeometryExtractor
     {
+        friend class GeometrySession; // Riusa l'esecuzione di vspscript e il parser degli ID
+
     private:
         std::ofstream file;
         std::string parentFolder;
         AircraftGeometryData geometryData;
+        bool fromCache = false;
+
+        // Prima riga del file di cache su disco, seguita dall'hash del .vsp3 in esadecimale
+        static constexpr const char *cacheHeader = "VSPGEOMCACHE 1";
+
+        /// @brief Reads the on-disk cache if it matches the given .vsp3 content hash.
+        inline bool loadPersistentCache(const std::string &vsp3Path, std::uint64_t hash)
+        {
+            std::ifstream in(GeometryCache::cachePathFor(vsp3Path), std::ios::binary);
+            if (!in.is_open())
+            {
+                return false;
+            }
+
+            std::string header, storedHash;
+            if (!std::getline(in, header) || header != cacheHeader || !std::getline(in, storedHash))
+            {
+                return false;
+            }
+            if (std::strtoull(storedHash.c_str(), nullptr, 16) != hash)
+            {
+                return false;
+            }
+
+            // Il resto del file è l'output CSV dello script
+            std::ostringstream body;
+            body << in.rdbuf();
+            parseGeomOutput(body.str());
+            return !geometryData.allGeoms.empty();
+        }
+
+        /// @brief Writes the on-disk cache (best effort: failures are ignored).
+        inline void savePersistentCache(const std::string &vsp3Path, std::uint64_t hash) const
+        {
+            const std::string path = GeometryCache::cachePathFor(vsp3Path);
+            const std::string temporary = path + ".tmp";
+            {
+                std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+                if (!out.is_open())
+                {
+                    return;
+                }
+                char hex[17];
+                std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+                out << cacheHeader << "\n" << hex << "\n";
+                for (const auto &geom : geometryData.allGeoms)
+                {
+                    out << geom.name << "," << geom.id << "," << geom.nameOfComponent << "\n";
+                }
+                if (!out)
+                {
+                    return;
+                }
+            }
+
+            // Rename atomico: un lettore concorrente vede il file vecchio o quello nuovo, mai metà
+            std::error_code ec;
+            std::filesystem::rename(temporary, path, ec);
+            if (ec)
+            {
+                std::filesystem::remove(temporary, ec);
+            }
+        }
 
         inline void writeComment(const std::string &comment)
         {
@@ -71,37 +228,8 @@ namespace VSPGEOMTRYEXTRACTOR
 
         inline std::string executeCommand(const std::string &command)
         {
-            std::string result;
-
-#ifdef _WIN32
-            std::array<char, 128> buffer;
-            std::unique_ptr<FILE, decltype(&_pclose)> pipe(_popen(command.c_str(), "r"), _pclose);
-
-            if (!pipe)
-            {
-                throw std::runtime_error("popen() failed!");
-            }
-
-            while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr)
-            {
-                result += buffer.data();
-            }
-#else
-            std::array<char, 128> buffer;
-            std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(command.c_str(), "r"), pclose);
-
-            if (!pipe)
-            {
-                throw std::runtime_error("popen() failed!");
-            }
-
-            while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr)
-            {
-                result += buffer.data();
-            }
-#endif
-
-            return result;
+            // posix_spawn/CreateProcess con pipe a blocchi grandi; timeout da PROCESS::defaults()
+            return PROCESS::captureOutput(command);
         }
 
         /// @brief Parses the output from the VSP script execution to extract geometry information and populate the AircraftGeometryData structure.
@@ -182,8 +310,31 @@ namespace VSPGEOMTRYEXTRACTOR
         /// @brief Generates a script that prints geometry data such as id, name and nameOfComponents.
         /// @param nameOfAircraft The name of the aircraft.
         /// @param filename The name of the file with the extension .vspscript.
+        ///
+        /// The result is cached by the content hash of the .vsp3 file (see GeometryCache): while the
+        /// file is unchanged, later calls return the cached data without writing or running the script.
         inline void extractAllGeoms(const std::string &nameOfAircraft, const std::string &filename)
         {
+            fromCache = false;
+
+            // Hash del .vsp3: se non è leggibile si procede senza cache
+            const std::string vsp3Path = (std::filesystem::path(parentFolder) / (nameOfAircraft + ".vsp3")).string();
+            std::uint64_t vsp3Hash = 0;
+            const bool cacheable = GeometryCache::hashFile(vsp3Path, vsp3Hash);
+            const bool persistent = cacheable && GeometryCache::isPersistent();
+
+            if (cacheable && GeometryCache::find(vsp3Hash, geometryData))
+            {
+                fromCache = true;
+                return;
+            }
+            if (persistent && loadPersistentCache(vsp3Path, vsp3Hash))
+            {
+                GeometryCache::store(vsp3Hash, geometryData);
+                fromCache = true;
+                return;
+            }
+
             if (file.is_open())
             {
                 file.close();
@@ -232,6 +383,16 @@ namespace VSPGEOMTRYEXTRACTOR
 
             // Executes the script and captures the geometry data
             executeAndCaptureGeomIds(filename);
+
+            // Un risultato vuoto (vspscript non trovato, errore nello script) non va in cache
+            if (cacheable && !geometryData.allGeoms.empty())
+            {
+                GeometryCache::store(vsp3Hash, geometryData);
+                if (persistent)
+                {
+                    savePersistentCache(vsp3Path, vsp3Hash);
+                }
+            }
         }
 
         /// @brief Executes the script and automatically captures the geometry data from the terminal output.
@@ -256,6 +417,12 @@ namespace VSPGEOMTRYEXTRACTOR
         {
             return geometryData;
         }
+
+        /// @brief Tells whether the last extractAllGeoms() was answered by the cache.
+        inline bool isFromCache() const
+        {
+            return fromCache;
+        }
     };
 
 } // namespace VSP
\ No newline at end of file
@@ -0,0 +1,394 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <cstdint>
+#include <stdexcept>
+#include <filesystem>
+#include <algorithm>
+#include <iostream>
+#include "VSPGEOMETRYEXTRACTOR.h"
+#include "DELTAXANDDIAMETERS.h"
+
+namespace VSPGEOMTRYEXTRACTOR
+{
+    /// @brief Collects in a single vspscript run everything the calculators read from the .vsp3 model:
+    /// the geometry IDs, the wetted area of every requested component and the section data
+    /// (widths, heights, x stations) of the fuselage and of the nacelle.
+    ///
+    /// Each separate query used to launch vspscript and reload the .vsp3 (about 1 s each);
+    /// the session pays that cost once. acquire() shares the result among all the callers
+    /// while the .vsp3 content is unchanged (same content hash as GeometryCache).
+    ///
+    /// Output of the generated script, parsed by section:
+    ///   BEGIN_GEOMS / END_GEOMS                         name,id,nameOfComponent lines
+    ///   WET_AREA[<nameOfComponent>]: <value>            one line per component found
+    ///   BEGIN_FUSELAGE_SECTIONS / END_FUSELAGE_SECTIONS TYPE: line + DiametersExtractor output
+    ///   BEGIN_NACELLE_SECTIONS / END_NACELLE_SECTIONS   TYPE: line + DiametersExtractor output
+    class GeometrySession
+    {
+    private:
+        std::string nameOfAircraft;
+        std::string parentFolder;
+        std::vector<std::string> wettedAreaComponents;
+
+        AircraftGeometryData geometryData;
+        std::map<std::string, double> wettedAreas;
+        std::string fuselageType;
+        std::string fuselageOutput;
+        std::string nacelleType;
+        std::string nacelleOutput;
+        bool executed = false;
+
+        struct SharedState
+        {
+            std::mutex mutex;
+            std::map<std::uint64_t, std::shared_ptr<const GeometrySession>> sessions;
+        };
+
+        static SharedState &shared()
+        {
+            static SharedState instance;
+            return instance;
+        }
+
+        inline std::string vsp3Path() const
+        {
+            return (std::filesystem::path(parentFolder) / (nameOfAircraft + ".vsp3")).string();
+        }
+
+        /// @brief Writes the script that finds a component by lower-case name (exact or by prefix)
+        /// and prints its section data with the same script bodies as DiametersExtractor.
+        inline void writeSectionsQuery(DiametersExtractor &writer, const std::string &tag,
+                                       const std::string &condition)
+        {
+            writer.writeComment(tag + " sections");
+            writer.writeCommand("{");
+            writer.writeCommand("string componentId = \"\";");
+            writer.writeCommand("for (uint i = 0; i < geom_ids.length(); i++)");
+            writer.writeCommand("{");
+            writer.writeCommand("    string lowerName = toLower(GetGeomName(geom_ids[i]));");
+            writer.writeCommand("    if (" + condition + ") { componentId = geom_ids[i]; break; }");
+            writer.writeCommand("}");
+            writer.writeCommand("Print(\"BEGIN_" + tag + "_SECTIONS\");");
+            writer.writeCommand("if (componentId != \"\")");
+            writer.writeCommand("{");
+            writer.writeCommand("string componentType = GetGeomTypeName(componentId);");
+            writer.writeCommand("Print(\"TYPE: \" + componentType);");
+            writer.writeCommand("if (componentType == \"Fuselage\")");
+            writer.writeCommand("{");
+            writer.writeFuselageTypeScript("componentId", true);
+            writer.writeCommand("}");
+            writer.writeCommand("else if (componentType == \"Stack\")");
+            writer.writeCommand("{");
+            writer.writeStackTypeScript("componentId", true);
+            writer.writeCommand("}");
+            writer.writeCommand("else");
+            writer.writeCommand("{");
+            writer.writeCustomFuselageScript("componentId", true);
+            writer.writeCommand("}");
+            writer.writeCommand("}");
+            writer.writeCommand("Print(\"END_" + tag + "_SECTIONS\");");
+            writer.writeCommand("}");
+            writer.file << "\r\n";
+        }
+
+        /// @brief Generates the combined script.
+        inline void writeScript(const std::string &scriptFilename)
+        {
+            DiametersExtractor writer(parentFolder);
+            writer.file.open(scriptFilename);
+            if (!writer.file.is_open())
+            {
+                throw std::runtime_error("Cannot open file: " + scriptFilename);
+            }
+
+            // Minuscolo ASCII, per riconoscere fusoliera e gondola come fa DiametersExtractor
+            writer.writeCommand("string toLower(string s)");
+            writer.writeCommand("{");
+            writer.writeCommand("    for (uint i = 0; i < s.length(); i++)");
+            writer.writeCommand("    {");
+            writer.writeCommand("        if (s[i] >= 65 && s[i] <= 90) { s[i] = s[i] + 32; }");
+            writer.writeCommand("    }");
+            writer.writeCommand("    return s;");
+            writer.writeCommand("}");
+            writer.file << "\r\n";
+
+            writer.file << "void main(){\r\n";
+
+            writer.writeComment("Load the VSP3 file");
+            writer.writeCommand("string fnamePreset = \"" + writer.replaceBackslash(parentFolder + "\\" + nameOfAircraft + ".vsp3") + "\";");
+            writer.writeCommand("ReadVSPFile(fnamePreset);");
+            writer.writeCommand("Update();");
+            writer.file << "\r\n";
+
+            writer.writeComment("Geometry information in CSV format: name,id,nameOfComponent");
+            writer.writeCommand("array<string> geom_ids = FindGeoms();");
+            writer.writeCommand("Print(\"BEGIN_GEOMS\");");
+            writer.writeCommand("for (uint i = 0; i < geom_ids.length(); i++)");
+            writer.writeCommand("{");
+            writer.writeCommand("    Print(GetGeomTypeName(geom_ids[i]) + \",\" + geom_ids[i] + \",\" + GetGeomName(geom_ids[i]));");
+            writer.writeCommand("}");
+            writer.writeCommand("Print(\"END_GEOMS\");");
+            writer.file << "\r\n";
+
+            // Un CompGeom per componente, con visibile solo quel componente (come WettedArea);
+            // la mesh generata viene eliminata per non entrare nel calcolo successivo
+            writer.writeComment("Wetted area of every requested component");
+            writer.writeCommand("array<string> targets;");
+            for (const auto &component : wettedAreaComponents)
+            {
+                writer.writeCommand("targets.insertLast(\"" + component + "\");");
+            }
+            writer.writeCommand("for (uint t = 0; t < targets.length(); t++)");
+            writer.writeCommand("{");
+            writer.writeCommand("    bool found = false;");
+            writer.writeCommand("    for (uint i = 0; i < geom_ids.length(); i++)");
+            writer.writeCommand("    {");
+            writer.writeCommand("        bool isTarget = GetGeomName(geom_ids[i]) == targets[t];");
+            writer.writeCommand("        SetSetFlag(geom_ids[i], SET_SHOWN, isTarget);");
+            writer.writeCommand("        if (isTarget) { found = true; }");
+            writer.writeCommand("    }");
+            writer.writeCommand("    if (!found) { continue; }");
+            writer.writeCommand("    string mesh_id = ComputeCompGeom( SET_SHOWN, false, 0 );");
+            writer.writeCommand("    string comp_res_id = FindLatestResultsID( \"Comp_Geom\" );");
+            writer.writeCommand("    array<double> @double_arr = GetDoubleResults( comp_res_id, \"Wet_Area\" );");
+            writer.writeCommand("    if (double_arr.length() > 0) { Print(\"WET_AREA[\" + targets[t] + \"]: \" + double_arr[0]); }");
+            writer.writeCommand("    DeleteGeom(mesh_id);");
+            writer.writeCommand("}");
+            writer.file << "\r\n";
+
+            writeSectionsQuery(writer, "FUSELAGE", "lowerName == \"fuselage\" || lowerName == \"transportfuse\"");
+            writeSectionsQuery(writer, "NACELLE", "lowerName.substr(0, 3) == \"nac\"");
+
+            writer.file << "}\r\n";
+            writer.file.close();
+        }
+
+        /// @brief Returns the text between two marker lines (empty if the markers are missing).
+        static std::string between(const std::string &output, const std::string &begin, const std::string &end)
+        {
+            const size_t start = output.find(begin);
+            if (start == std::string::npos)
+            {
+                return "";
+            }
+            const size_t from = output.find('\n', start);
+            const size_t to = output.find(end, start);
+            if (from == std::string::npos || to == std::string::npos || to < from)
+            {
+                return "";
+            }
+            return output.substr(from + 1, to - from - 1);
+        }
+
+        /// @brief Extracts the "TYPE: <type>" line of a section block.
+        static std::string typeOf(const std::string &block)
+        {
+            std::istringstream stream(block);
+            std::string line;
+            while (std::getline(stream, line))
+            {
+                if (line.rfind("TYPE:", 0) == 0)
+                {
+                    line = line.substr(5);
+                    line.erase(std::remove_if(line.begin(), line.end(), ::isspace), line.end());
+                    return line;
+                }
+            }
+            return "";
+        }
+
+        inline void parseOutput(const std::string &output)
+        {
+            GeometryExtractor parser(parentFolder);
+            parser.parseGeomOutput(between(output, "BEGIN_GEOMS", "END_GEOMS"));
+            geometryData = parser.getGeometryData();
+
+            wettedAreas.clear();
+            std::istringstream stream(output);
+            std::string line;
+            while (std::getline(stream, line))
+            {
+                if (line.rfind("WET_AREA[", 0) != 0)
+                {
+                    continue;
+                }
+                const size_t close = line.find("]:");
+                if (close == std::string::npos)
+                {
+                    continue;
+                }
+                try
+                {
+                    wettedAreas[line.substr(9, close - 9)] = std::stod(line.substr(close + 2));
+                }
+                catch (...)
+                {
+                    // Valore non numerico: il componente resta senza area, come in WettedArea
+                }
+            }
+
+            fuselageOutput = between(output, "BEGIN_FUSELAGE_SECTIONS", "END_FUSELAGE_SECTIONS");
+            fuselageType = typeOf(fuselageOutput);
+            nacelleOutput = between(output, "BEGIN_NACELLE_SECTIONS", "END_NACELLE_SECTIONS");
+            nacelleType = typeOf(nacelleOutput);
+        }
+
+    public:
+        /// @brief Constructor
+        /// @param nameOfAircraft The name of the aircraft (the .vsp3 file without extension).
+        /// @param wettedAreaComponents Names of the components (GetGeomName) whose wetted area is needed.
+        /// @param parentFolderPath The path to the parent folder (optional).
+        inline GeometrySession(const std::string &nameOfAircraft,
+                               const std::vector<std::string> &wettedAreaComponents,
+                               const std::string &parentFolderPath = "")
+            : nameOfAircraft(nameOfAircraft),
+              wettedAreaComponents(wettedAreaComponents)
+        {
+            parentFolder = parentFolderPath.empty() ? std::filesystem::current_path().string() : parentFolderPath;
+        }
+
+        /// @brief Writes the combined script, runs it once and parses all the results.
+        /// @param vspExecutable The VSP executable to use (default is "vspscript.exe").
+        inline void run(const std::string &vspExecutable = "vspscript.exe")
+        {
+            const std::string scriptFilename = nameOfAircraft + "_GeometrySession.vspscript";
+            writeScript(scriptFilename);
+
+            GeometryExtractor launcher(parentFolder);
+            const std::string output = launcher.executeCommand(vspExecutable + " -script \"" + scriptFilename + "\"");
+            parseOutput(output);
+            executed = true;
+
+            std::error_code ec;
+            std::filesystem::remove(scriptFilename, ec);
+
+            if (geometryData.allGeoms.empty())
+            {
+                std::cerr << "[WARNING] GeometrySession: no geometry read from " << vsp3Path()
+                          << " (is " << vspExecutable << " available?); wetted areas will read 0" << std::endl;
+            }
+
+            // Le chiamate successive a extractAllGeoms sullo stesso .vsp3 non lanciano altri script
+            std::uint64_t hash = 0;
+            if (!geometryData.allGeoms.empty() && GeometryCache::hashFile(vsp3Path(), hash))
+            {
+                GeometryCache::store(hash, geometryData);
+            }
+        }
+
+        /// @brief Returns the session of the current .vsp3 content, running a new one only if
+        /// no session exists yet or some of the requested wetted areas were not measured.
+        /// @param nameOfAircraft The name of the aircraft.
+        /// @param wettedAreaComponents Names of the components whose wetted area is needed.
+        /// @param parentFolderPath The path to the parent folder (optional).
+        /// @return Shared, read-only session results.
+        static std::shared_ptr<const GeometrySession> acquire(const std::string &nameOfAircraft,
+                                                              const std::vector<std::string> &wettedAreaComponents,
+                                                              const std::string &parentFolderPath = "")
+        {
+            auto session = std::make_shared<GeometrySession>(nameOfAircraft, wettedAreaComponents, parentFolderPath);
+
+            std::uint64_t hash = 0;
+            if (!GeometryCache::hashFile(session->vsp3Path(), hash))
+            {
+                session->run();
+                return session;
+            }
+
+            // Il lock copre anche l'esecuzione: chi arriva nel frattempo attende invece di lanciare un doppione
+            std::lock_guard<std::mutex> lock(shared().mutex);
+            auto it = shared().sessions.find(hash);
+            if (it != shared().sessions.end())
+            {
+                // Nuova sessione solo se manca qualche componente, con l'unione dei componenti richiesti
+                std::vector<std::string> components = it->second->wettedAreaComponents;
+                for (const auto &component : wettedAreaComponents)
+                {
+                    if (std::find(components.begin(), components.end(), component) == components.end())
+                    {
+                        components.push_back(component);
+                    }
+                }
+                if (components.size() == it->second->wettedAreaComponents.size())
+                {
+                    return it->second;
+                }
+                session->wettedAreaComponents = components;
+            }
+
+            session->run();
+
+            // Una sessione vuota (vspscript assente o fallito) non si condivide: la prossima chiamata riprova
+            if (!session->geometryData.allGeoms.empty())
+            {
+                shared().sessions[hash] = session;
+            }
+            return session;
+        }
+
+        /// @brief Drops every shared session.
+        static void clearCache()
+        {
+            std::lock_guard<std::mutex> lock(shared().mutex);
+            shared().sessions.clear();
+        }
+
+        /// @brief Gets the captured geometry data.
+        inline const AircraftGeometryData &getGeometryData() const
+        {
+            return geometryData;
+        }
+
+        /// @brief Tells whether the wetted area of a component was measured.
+        inline bool hasWettedArea(const std::string &nameOfComponent) const
+        {
+            return wettedAreas.count(nameOfComponent) > 0;
+        }
+
+        /// @brief Gets the wetted area of a component (0 if the component is not in the model, as WettedArea).
+        /// @param nameOfComponent Name of the component (GetGeomName).
+        inline double getWettedArea(const std::string &nameOfComponent) const
+        {
+            auto it = wettedAreas.find(nameOfComponent);
+            return it != wettedAreas.end() ? it->second : 0.0;
+        }
+
+        /// @brief Fuselage section data, as DiametersExtractor::extractFuselageDiameters.
+        /// @param fuseLength Fuselage length, to scale the XLocPercent stations of "Fuselage" components.
+        inline FuselageDiametersAndXStation getFuselageDiameters(double fuseLength) const
+        {
+            if (fuselageType.empty())
+            {
+                throw std::runtime_error("Fuselage not found in geometry data");
+            }
+            DiametersExtractor parser(parentFolder);
+            const bool isCustomFuselage = fuselageType != "Fuselage" && fuselageType != "Stack";
+            return parser.parseFuselageDiametersOutput(fuselageOutput, fuselageType, isCustomFuselage, fuseLength);
+        }
+
+        /// @brief Nacelle section data, as DiametersExtractor::extractNacelleDiameters.
+        /// @param nacelleLength Nacelle length, to scale the stations of non-"Stack" components.
+        inline NacelleDiametersAndXStation getNacelleDiameters(double nacelleLength) const
+        {
+            if (nacelleType.empty())
+            {
+                throw std::runtime_error("Nacelle not found in geometry data");
+            }
+            DiametersExtractor parser(parentFolder);
+            return parser.parseNacelleDiametersOutput(nacelleOutput, nacelleType, nacelleLength);
+        }
+
+        /// @brief Tells whether run() has been executed.
+        inline bool isExecuted() const
+        {
+            return executed;
+        }
+    };
+
+} // namespace VSPGEOMTRYEXTRACTOR
@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <array>
 #include <memory>
+#include "PROCESSRUNNER.h"
 
 namespace WETTEDAREA
 {
@@ -91,39 +92,8 @@ namespace WETTEDAREA
         // Funzione per eseguire un comando e catturare l'output
         inline std::string executeCommand(const std::string &command)
         {
-            std::string result;
-
-#ifdef _WIN32
-            // Windows
-            std::array<char, 128> buffer;
-            std::unique_ptr<FILE, decltype(&_pclose)> pipe(_popen(command.c_str(), "r"), _pclose);
-
-            if (!pipe)
-            {
-                throw std::runtime_error("popen() failed!");
-            }
-
-            while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr)
-            {
-                result += buffer.data();
-            }
-#else
-            // Linux/Mac
-            std::array<char, 128> buffer;
-            std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(command.c_str(), "r"), pclose);
-
-            if (!pipe)
-            {
-                throw std::runtime_error("popen() failed!");
-            }
-
-            while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr)
-            {
-                result += buffer.data();
-            }
-#endif
-
-            return result;
+            // posix_spawn/CreateProcess con pipe a blocchi grandi; timeout da PROCESS::defaults()
+            return PROCESS::captureOutput(command);
         }
 
         // Funzione per parsare l'output e popolare la struttura
@@ -0,0 +1,145 @@
+#define _HAS_STD_BYTE 0 // Risolve conflitto byte tra C++17 e Windows headers
+#define UNICODE         // Assicura che Windows usi le versioni wide delle strutture
+#define _UNICODE
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include "ISATable.h"
+
+using namespace std;
+using namespace Atmosphere;
+
+// Numero di controlli falliti, restituito da main
+static int failures = 0;
+
+static void check(bool condition, const string &name)
+{
+    cout << (condition ? "[PASS] " : "[FAIL] ") << name << endl;
+    if (!condition)
+    {
+        ++failures;
+    }
+}
+
+static double relativeError(double value, double exact)
+{
+    return std::abs(value - exact) / std::abs(exact);
+}
+
+int main()
+{
+
+    //============================= ISATable accuracy ==============================
+    {
+        const ISATable &standard = ISATable::standard();
+        ISATable linear(0.0, 100.0, ISATable::Interpolation::LINEAR);
+
+        // Valori dichiarati nella documentazione di ISATable
+        check(standard.maxRelativeError() < 1e-9, "cubic 100 m table within 1e-9");
+        check(linear.maxRelativeError() < 1e-4, "linear 100 m table within 1e-4");
+
+        // Controllo indipendente da maxRelativeError: quote fuori dai punti 1/4, 1/2, 3/4
+        double maxError = 0.0;
+        for (double h = -4987.3; h <= 85990.0; h += 733.7)
+        {
+            const ISA::Properties exact = ISA::calculate(h);
+            maxError = std::max({maxError,
+                                 relativeError(standard.temperature(h), exact.T),
+                                 relativeError(standard.speedOfSound(h), exact.a),
+                                 relativeError(standard.pressure(h), exact.P),
+                                 relativeError(standard.density(h), exact.rho),
+                                 relativeError(standard.viscosity(h), exact.mu)});
+        }
+        check(maxError <= standard.maxRelativeError() * 4.0, "random altitudes agree with the measured error");
+
+        // Intorno ai confini di strato (11 km, 20 km geopotenziali) e bordi della tabella
+        bool edges = true;
+        for (double h : {-5000.0, 0.0, 11019.13, 20063.1, 86000.0})
+        {
+            edges = edges && relativeError(standard.pressure(h), ISA::pressure(h)) < 1e-9 &&
+                    relativeError(standard.temperature(h), ISA::temperature(h)) < 1e-9;
+        }
+        check(edges, "layer boundaries and table edges");
+
+        // Giorno ISA + 15 K: pressione standard, temperatura spostata
+        ISATable hotDay(15.0);
+        const double h = 3000.0;
+        check(std::abs(hotDay.temperature(h) - (ISA::temperature(h) + 15.0)) < 1e-6, "hot day temperature is T_ISA + deltaT");
+        check(relativeError(hotDay.pressure(h), ISA::pressure(h)) < 1e-9, "hot day pressure is the standard pressure");
+        check(relativeError(hotDay.density(h), ISA::pressure(h) / (ISA::R * (ISA::temperature(h) + 15.0))) < 1e-6,
+              "hot day density from the gas law");
+
+        bool rejected = false;
+        try
+        {
+            ISATable invalid(0.0, -1.0);
+        }
+        catch (const std::invalid_argument &)
+        {
+            rejected = true;
+        }
+        check(rejected, "invalid grid is rejected");
+    }
+
+    //============================= Inverse queries ==============================
+    {
+        // Andata e ritorno: h -> P, rho -> h su tutto il campo di validità
+        double pressureError = 0.0;
+        double densityError = 0.0;
+        vector<double> altitudes, pressures, densities;
+        for (double h = -5000.0; h <= 86000.0; h += 250.0)
+        {
+            const ISA::Properties p = ISA::calculate(h);
+            pressureError = std::max(pressureError, std::abs(ISA::pressureAltitude(p.P) - h));
+            densityError = std::max(densityError, std::abs(ISA::densityAltitude(p.rho) - h));
+            altitudes.push_back(h);
+            pressures.push_back(p.P);
+            densities.push_back(p.rho);
+        }
+        check(pressureError < 1e-6, "pressureAltitude round trip within 1e-6 m");
+        check(densityError < 1e-6, "densityAltitude round trip within 1e-6 m");
+
+        // Versione vettoriale: stessi risultati, NaN e flag 0 fuori campo
+        pressures.push_back(1e6);
+        pressures.push_back(-1.0);
+        vector<double> h(pressures.size());
+        vector<std::uint8_t> status(pressures.size());
+        const size_t valid = ISA::pressureAltitude(pressures.data(), h.data(), pressures.size(), status.data());
+        bool batch = valid == altitudes.size();
+        for (size_t i = 0; batch && i < altitudes.size(); ++i)
+        {
+            batch = status[i] == 1 && std::abs(h[i] - altitudes[i]) < 1e-6;
+        }
+        batch = batch && status[altitudes.size()] == 0 && std::isnan(h[altitudes.size()]) &&
+                status[altitudes.size() + 1] == 0 && std::isnan(h[altitudes.size() + 1]);
+        check(batch, "vectorized pressureAltitude flags out-of-range samples");
+
+        bool thrown = false;
+        try
+        {
+            ISA::pressureAltitude(1e6);
+        }
+        catch (const std::out_of_range &)
+        {
+            thrown = true;
+        }
+        check(thrown, "scalar pressureAltitude throws out of range");
+
+        // Giorno ISA + 20 K a 2000 m di quota pressione: coerente con ISATable e con temperatureOffset
+        const double pressureAltitude = 2000.0;
+        const double deltaT = 20.0;
+        ISATable hotDay(deltaT);
+        const double densityAltitude = ISA::densityAltitude(pressureAltitude, deltaT);
+        check(std::abs(ISA::density(densityAltitude) - hotDay.density(pressureAltitude)) < 1e-9, "off-standard density altitude matches ISATable");
+        check(densityAltitude > pressureAltitude, "hot day density altitude is above the pressure altitude");
+        check(std::abs(ISA::temperatureOffset(hotDay.pressure(pressureAltitude), hotDay.temperature(pressureAltitude)) - deltaT) < 1e-6,
+              "temperatureOffset recovers deltaT");
+    }
+
+    cout << (failures == 0 ? "All ISA tests passed" : "Some ISA tests failed") << endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+#define _HAS_STD_BYTE 0 // Risolve conflitto byte tra C++17 e Windows headers
+#define UNICODE         // Assicura che Windows usi le versioni wide delle strutture
+#define _UNICODE
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include "ODE45Ensemble.h"
+
+using namespace std;
+
+// Numero di controlli falliti, restituito da main
+static int failures = 0;
+
+static void check(bool condition, const string &name)
+{
+    cout << (condition ? "[PASS] " : "[FAIL] ") << name << endl;
+    if (!condition)
+    {
+        ++failures;
+    }
+}
+
+// Parametri di un membro: y' = -rate * y
+struct Decay
+{
+    double rate;
+};
+
+int main()
+{
+    // 21 membri: l'ultimo blocco di corsie è riempito solo in parte
+    const size_t members = 21;
+    const double tf = 3.0;
+
+    vector<Decay> params;
+    vector<double> y0;
+    for (size_t m = 0; m < members; ++m)
+    {
+        params.push_back({0.1 + 0.2 * static_cast<double>(m)});
+        y0.push_back(1.0 + static_cast<double>(m));
+    }
+
+    auto decay = [](const double *, const double *y, double *dydt, const Decay *p, size_t width)
+    {
+        for (size_t l = 0; l < width; ++l)
+        {
+            dydt[l] = -p[l].rate * y[l];
+        }
+    };
+
+    //============================= Adaptive ensemble vs closed form ==============================
+    {
+        ODE45Options options = ODE45Ensemble<Decay, decltype(decay)>::ensembleDefaults();
+        options.relTol = 1e-9;
+        options.absTol = 1e-12;
+        ODE45Ensemble ensemble(decay, 1, 0.0, tf, y0, params, options);
+
+        double maxError = 0.0;
+        for (size_t m = 0; m < members; ++m)
+        {
+            const double exact = y0[m] * std::exp(-params[m].rate * tf);
+            maxError = std::max(maxError, std::abs(ensemble.getFinalState(m, 0) - exact) / exact);
+        }
+        check(ensemble.size() == members && ensemble.dimension() == 1, "ensemble size and dimension");
+        check(maxError < 1e-7, "adaptive members match exp(-k t)");
+
+        // Ogni corsia ha il proprio passo: il membro più rapido richiede più passi
+        const vector<size_t> &steps = ensemble.getNumberOfAcceptedSteps();
+        check(steps.back() > steps.front(), "each member has its own step size");
+
+        // Stesso problema con il solutore scalare: stessa norma dell'errore, stessi passi
+        auto scalar = [rate = params.back().rate](double, const double &y) { return -rate * y; };
+        options.output = ODE45Output::FINAL_STATE;
+        ODE45<double, decltype(scalar)> single(scalar, 0.0, tf, y0.back(), options);
+        check(std::abs(single.getFinalState() - ensemble.getFinalState(members - 1, 0)) < 1e-12 * y0.back(),
+              "member matches the scalar ODE45 run");
+    }
+
+    //============================= Fixed-step ensemble with samples ==============================
+    {
+        ODE45Options options;
+        options.mode = ODE45Mode::FIXED_STEP_RK4;
+        options.dt = 0.01;
+        options.output = ODE45Output::SAMPLE_TIMES;
+        options.sampleTimes = {2.0, 0.5, 5.0};   // Fuori ordine; 5.0 è fuori da [t0, tf] e viene scartato
+
+        ODE45Ensemble ensemble(decay, 1, 0.0, tf, y0, params, options);
+        const vector<double> &times = ensemble.getSampleTimes();
+        check(times.size() == 2 && times[0] == 0.5 && times[1] == 2.0, "sample times sorted and clipped to [t0, tf]");
+
+        double maxError = 0.0;
+        for (size_t s = 0; s < times.size(); ++s)
+        {
+            for (size_t m = 0; m < members; ++m)
+            {
+                const double exact = y0[m] * std::exp(-params[m].rate * times[s]);
+                maxError = std::max(maxError, std::abs(ensemble.getSamples()[s * members + m] - exact) / exact);
+            }
+        }
+        check(maxError < 1e-6, "RK4 samples match exp(-k t)");   // Errore di troncamento RK4 ~2e-7 per k = 4.1
+    }
+
+    //============================= Two-component members ==============================
+    {
+        // Oscillatori x'' = -w^2 x con pulsazioni diverse, stati SoA [x..., v...]
+        auto oscillator = [](const double *, const double *y, double *dydt, const Decay *p, size_t width)
+        {
+            for (size_t l = 0; l < width; ++l)
+            {
+                dydt[l] = y[width + l];
+                dydt[width + l] = -p[l].rate * p[l].rate * y[l];
+            }
+        };
+
+        vector<double> state(2 * members, 0.0);
+        for (size_t m = 0; m < members; ++m)
+        {
+            state[m] = 1.0;
+        }
+
+        ODE45Options options = ODE45Ensemble<Decay, decltype(oscillator)>::ensembleDefaults();
+        options.relTol = 1e-10;
+        options.absTol = 1e-12;
+        ODE45Ensemble ensemble(oscillator, 2, 0.0, tf, state, params, options);
+
+        double maxError = 0.0;
+        for (size_t m = 0; m < members; ++m)
+        {
+            const double w = params[m].rate;
+            maxError = std::max(maxError, std::abs(ensemble.getFinalState(m, 0) - std::cos(w * tf)));
+            maxError = std::max(maxError, std::abs(ensemble.getFinalState(m, 1) + w * std::sin(w * tf)));
+        }
+        check(maxError < 1e-7, "two-component members match cos(w t)");
+    }
+
+    cout << (failures == 0 ? "All ODE45Ensemble tests passed" : "Some ODE45Ensemble tests failed") << endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,232 @@
+#define _HAS_STD_BYTE 0 // Risolve conflitto byte tra C++17 e Windows headers
+#define UNICODE         // Assicura che Windows usi le versioni wide delle strutture
+#define _UNICODE
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <Eigen/Dense>   // Prima di ODE45.h: abilita la modalità STIFF_ROSENBROCK23
+#include "ODE45.h"
+
+using namespace std;
+
+// Contatore delle allocazioni, per verificare i cicli di integrazione senza allocazioni.
+// Tutte le forme (scalari e array, delete con e senza dimensione) su malloc/free
+static size_t allocationCount = 0;
+
+static void *countedAllocation(std::size_t size)
+{
+    ++allocationCount;
+    if (void *p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size) { return countedAllocation(size); }
+void *operator new[](std::size_t size) { return countedAllocation(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+// Numero di controlli falliti, restituito da main
+static int failures = 0;
+
+static void check(bool condition, const string &name)
+{
+    cout << (condition ? "[PASS] " : "[FAIL] ") << name << endl;
+    if (!condition)
+    {
+        ++failures;
+    }
+}
+
+static double relativeError(double value, double exact)
+{
+    return std::abs(value - exact) / std::max(1e-300, std::abs(exact));
+}
+
+int main()
+{
+
+    //============================= Adaptive Dormand-Prince 5(4) ==============================
+    {
+        // Decadimento esponenziale y' = -2 y, soluzione esatta exp(-2 t)
+        auto decay = [](double, const double &y) { return -2.0 * y; };
+
+        ODE45Options loose;
+        loose.mode = ODE45Mode::ADAPTIVE_DOPRI5;
+        loose.relTol = 1e-5;
+        loose.absTol = 1e-10;
+        loose.output = ODE45Output::FINAL_STATE;
+
+        ODE45Options tight = loose;
+        tight.relTol = 1e-10;
+        tight.absTol = 1e-14;
+
+        ODE45<double, decltype(decay)> coarse(decay, 0.0, 5.0, 1.0, loose);
+        ODE45<double, decltype(decay)> fine(decay, 0.0, 5.0, 1.0, tight);
+        const double exact = std::exp(-10.0);
+
+        check(coarse.getFinalTime() == 5.0, "adaptive run reaches tf exactly");
+        check(relativeError(coarse.getFinalState(), exact) < 1e-3, "adaptive decay within the loose tolerance");
+        check(relativeError(fine.getFinalState(), exact) < 1e-8, "adaptive decay within the tight tolerance");
+        check(fine.getNumberOfAcceptedSteps() > coarse.getNumberOfAcceptedSteps(), "tighter tolerance takes more steps");
+
+        // Oscillatore armonico y'' = -y: dopo un periodo torna allo stato iniziale
+        auto oscillator = [](double, const vector<double> &y) { return vector<double>{y[1], -y[0]}; };
+        const double period2Pi = 2.0 * std::acos(-1.0);
+        ODE45<vector<double>, decltype(oscillator)> period(oscillator, 0.0, period2Pi, vector<double>{1.0, 0.0}, tight);
+        const vector<double> &y = period.getFinalState();
+        check(std::abs(y[0] - 1.0) < 1e-8 && std::abs(y[1]) < 1e-8, "adaptive oscillator closes one period");
+    }
+
+    //============================= In-place right-hand side ==============================
+    {
+        // Stessa dinamica nelle due firme: i risultati devono coincidere
+        auto byValue = [](double t, const vector<double> &y) { return vector<double>{y[1], -y[0] + std::sin(t)}; };
+        auto inPlace = [](double t, const vector<double> &y, vector<double> &dydt)
+        {
+            dydt[0] = y[1];
+            dydt[1] = -y[0] + std::sin(t);
+        };
+
+        for (ODE45Mode mode : {ODE45Mode::FIXED_STEP_RK4, ODE45Mode::ADAPTIVE_DOPRI5})
+        {
+            ODE45Options options;
+            options.mode = mode;
+            options.output = ODE45Output::FINAL_STATE;
+
+            ODE45<vector<double>, decltype(byValue)> a(byValue, 0.0, 10.0, vector<double>{1.0, 0.0}, options);
+            ODE45<vector<double>, decltype(inPlace)> b(inPlace, 0.0, 10.0, vector<double>{1.0, 0.0}, options);
+            const bool same = std::abs(a.getFinalState()[0] - b.getFinalState()[0]) < 1e-13 &&
+                              std::abs(a.getFinalState()[1] - b.getFinalState()[1]) < 1e-13 &&
+                              a.getNumberOfAcceptedSteps() == b.getNumberOfAcceptedSteps();
+            check(same, mode == ODE45Mode::FIXED_STEP_RK4 ? "in-place RHS matches by-value RHS (RK4)"
+                                                          : "in-place RHS matches by-value RHS (Dormand-Prince)");
+        }
+
+        // Senza salvataggio dei campioni le allocazioni non dipendono dal numero di passi
+        auto inPlace2 = [](double, const array<double, 2> &y, array<double, 2> &dydt)
+        {
+            dydt[0] = y[1];
+            dydt[1] = -y[0];
+        };
+        auto allocationsFor = [&](double tf)
+        {
+            ODE45Options options;
+            options.output = ODE45Output::FINAL_STATE;
+            options.dt = 0.001;
+            const size_t before = allocationCount;
+            ODE45<array<double, 2>, decltype(inPlace2)> s(inPlace2, 0.0, tf, array<double, 2>{1.0, 0.0}, options);
+            return allocationCount - before;
+        };
+        check(allocationsFor(1.0) == allocationsFor(100.0), "fixed-step loop does not allocate per step");
+    }
+
+    //============================= Events ==============================
+    {
+        // Caduta libera da 10 m: evento terminale all'impatto, t = sqrt(2 h / g)
+        const double g = 9.81;
+        auto fall = [g](double, const array<double, 2> &y) { return array<double, 2>{y[1], -g}; };
+        ODE45Event<array<double, 2>> ground{[](double, const array<double, 2> &y) { return y[0]; }, -1, true};
+
+        ODE45Options options;
+        options.mode = ODE45Mode::ADAPTIVE_DOPRI5;
+        options.output = ODE45Output::FINAL_STATE;
+
+        ODE45<array<double, 2>, decltype(fall)> drop(fall, 0.0, 10.0, array<double, 2>{10.0, 0.0}, options, {ground});
+        const double impact = std::sqrt(2.0 * 10.0 / g);
+        check(drop.isTerminatedByEvent(), "terminal event stops the integration");
+        check(drop.getEventTimes().size() == 1 && std::abs(drop.getEventTimes()[0] - impact) < 1e-9, "terminal event located at the impact time");
+        check(std::abs(drop.getFinalTime() - impact) < 1e-9 && std::abs(drop.getFinalState()[0]) < 1e-9, "final state is the event state");
+
+        // y = sin t: eventi non terminali agli zeri, solo quelli nel verso richiesto
+        auto wave = [](double t, const double &) { return std::cos(t); };
+        const double pi = std::acos(-1.0);
+        ODE45Event<double> anyZero{[](double, const double &y) { return y; }, 0, false};
+        ODE45Event<double> downZero{[](double, const double &y) { return y; }, -1, false};
+
+        for (ODE45Mode mode : {ODE45Mode::FIXED_STEP_RK4, ODE45Mode::ADAPTIVE_DOPRI5})
+        {
+            options.mode = mode;
+            ODE45<double, decltype(wave)> s(wave, 0.5, 10.0, std::sin(0.5), options, {anyZero, downZero});
+            const vector<double> &times = s.getEventTimes();
+            const vector<size_t> &which = s.getEventIndices();
+
+            bool located = times.size() == 5 && !s.isTerminatedByEvent() && std::abs(s.getFinalTime() - 10.0) < 1e-9;
+            const double expected[] = {pi, pi, 2.0 * pi, 3.0 * pi, 3.0 * pi};
+            const size_t expectedIndex[] = {0, 1, 0, 0, 1};
+            for (size_t i = 0; located && i < times.size(); ++i)
+            {
+                const double tolerance = mode == ODE45Mode::FIXED_STEP_RK4 ? 1e-8 : 1e-5;
+                located = std::abs(times[i] - expected[i]) < tolerance && which[i] == expectedIndex[i];
+            }
+            check(located, mode == ODE45Mode::FIXED_STEP_RK4 ? "non-terminal events with direction (RK4)"
+                                                             : "non-terminal events with direction (Dormand-Prince)");
+        }
+
+        // y = t con evento terminale a t = 5: gli istanti richiesti oltre l'evento non vanno emessi
+        auto ramp = [](double, const double &) { return 1.0; };
+        ODE45Event<double> atFive{[](double, const double &y) { return y - 5.0; }, 0, true};
+        options.output = ODE45Output::SAMPLE_TIMES;
+        options.sampleTimes = {2.0, 8.0, 9.0};
+
+        for (ODE45Mode mode : {ODE45Mode::FIXED_STEP_RK4, ODE45Mode::ADAPTIVE_DOPRI5})
+        {
+            options.mode = mode;
+            ODE45<double, decltype(ramp)> s(ramp, 0.0, 10.0, 0.0, options, {atFive});
+            const bool dropped = s.isTerminatedByEvent() && s.getT().size() == 1 && std::abs(s.getT()[0] - 2.0) < 1e-12
+                              && std::abs(s.getY()[0] - 2.0) < 1e-9 && std::abs(s.getFinalTime() - 5.0) < 1e-9;
+            check(dropped, mode == ODE45Mode::FIXED_STEP_RK4 ? "sample times after a terminal event are dropped (RK4)"
+                                                             : "sample times after a terminal event are dropped (Dormand-Prince)");
+        }
+    }
+
+    //============================= Stiff Rosenbrock 2(3) ==============================
+    {
+        // y' = -1000 (y - cos t) - sin t, soluzione esatta y = cos t per y(0) = 1
+        auto stiff = [](double t, const double &y) { return -1000.0 * (y - std::cos(t)) - std::sin(t); };
+
+        ODE45Options options;
+        options.output = ODE45Output::FINAL_STATE;
+        // Tolleranze da ode23s: il passo è limitato dalla stabilità solo per Dormand-Prince
+        options.relTol = 1e-3;
+        options.absTol = 1e-6;
+
+        options.mode = ODE45Mode::STIFF_ROSENBROCK23;
+        ODE45<double, decltype(stiff)> rosenbrock(stiff, 0.0, 10.0, 1.0, options);
+        options.mode = ODE45Mode::ADAPTIVE_DOPRI5;
+        ODE45<double, decltype(stiff)> dopri(stiff, 0.0, 10.0, 1.0, options);
+
+        check(std::abs(rosenbrock.getFinalState() - std::cos(10.0)) < 1e-4, "Rosenbrock follows the slow solution");
+        check(rosenbrock.getNumberOfAcceptedSteps() * 10 < dopri.getNumberOfAcceptedSteps(), "Rosenbrock takes far fewer steps than Dormand-Prince");
+        check(rosenbrock.getNumberOfJacobianEvaluations() > 0 &&
+                  rosenbrock.getNumberOfJacobianEvaluations() <= rosenbrock.getNumberOfLUDecompositions(),
+              "Jacobian reused across LU decompositions");
+
+        // Sistema di Robertson (cinetica chimica): la massa totale si conserva
+        auto robertson = [](double, const vector<double> &y, vector<double> &dydt)
+        {
+            dydt[0] = -0.04 * y[0] + 1e4 * y[1] * y[2];
+            dydt[1] = 0.04 * y[0] - 1e4 * y[1] * y[2] - 3e7 * y[1] * y[1];
+            dydt[2] = 3e7 * y[1] * y[1];
+        };
+        options.mode = ODE45Mode::STIFF_ROSENBROCK23;
+        options.relTol = 1e-6;
+        options.absTol = 1e-10;
+        ODE45<vector<double>, decltype(robertson)> chemistry(robertson, 0.0, 40.0, vector<double>{1.0, 0.0, 0.0}, options);
+        const vector<double> &y = chemistry.getFinalState();
+        check(std::abs(y[0] + y[1] + y[2] - 1.0) < 1e-8, "Robertson conserves the total mass");
+        check(std::abs(y[0] - 0.7158) < 1e-3, "Robertson y1(40) matches the reference value");
+    }
+
+    cout << (failures == 0 ? "All ODE45 tests passed" : "Some ODE45 tests failed") << endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -14,6 +14,7 @@ template class vtkAOSDataArrayTemplate<long long>;
 #include "ConvLength.h"
 #include "EnumLENGTH.h"
 #include "ATMOSISA.h"
+#include "ISATable.h"
 #include "CONVFILEVSP.h"
 #include "READLOADFILE.h"
 #include "READPOLARFILE.h"
@@ -746,8 +747,10 @@ int main()
     for (size_t i = 0; i < altitudeEvaluations.size(); i++)
     {
 
-        double muViscosity = Atmosphere::ISA::viscosity(altitudeEvaluations[i]);                                                                    // Calculate viscosity at maxROCSeaLevel = 0.0; level for power calculation
-        auto [temperatureToEvaluate, speedOfSoundToEvaluate, pressureToEvaluate, densityToEvaluate] = Atmosphere::atmosisa(altitudeEvaluations[i]); // Atmosisa like in MATLAB
+        const Atmosphere::ISA::Properties atmosphere = Atmosphere::ISATable::standard().calculate(altitudeEvaluations[i]); // Tabulated ISA: no pow/exp in the altitude x Mach loop
+        double muViscosity = atmosphere.mu;                                                                                                  // Viscosity at the current altitude for the Reynolds number
+        const double speedOfSoundToEvaluate = atmosphere.a;
+        const double densityToEvaluate = atmosphere.rho;
         std::cout << "\n--- Evaluating at altitude: " << altitudeEvaluations[i] << " m ---" << std::endl;
 
         for (size_t j = 0; j < machNumbers.size(); j++)
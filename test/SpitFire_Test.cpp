@@ -734,22 +734,23 @@ double fuelMass = builder.getCommonData().getFuelWeight();
 
 CDCalculator cdCalc (aircraftName, builder, ac, settings, wing, horizontal, vertical, fus);
 
-std::vector<double> liftCoefficients;
-std::vector<double> dragCoefficients;
-std::vector<double> efficiencyAircraft; 
 
 CalculateAircrfatAlphaZeroLiftAngle alphaZeroLiftAngleCalc(builder, ac, settings, wing, horizontal, vertical, fus);
 
 double aircrfatalphaZeroLiftAngle = alphaZeroLiftAngleCalc.getAircraftAlphaZeroLiftAngle();
 
+// Una sola analisi VSPAERO per tutti gli angoli della polare
+std::vector<double> anglesOfAttack;
 for (double AoA = aircrfatalphaZeroLiftAngle; AoA <= 10; AoA += 1.0)
 {
+    anglesOfAttack.push_back(AoA);
+}
 
-    dragCoefficients.push_back(cdCalc.getCDTotalAircraft(AoA, settings.Mach, settings.altitude, "CRUISE"));
-    liftCoefficients.push_back(cdCalc.getLiftCoefficient());
+DragPolar dragPolar = cdCalc.getDragPolar(anglesOfAttack, settings.Mach, settings.altitude, "CRUISE");
 
-    efficiencyAircraft.push_back(liftCoefficients.back() / dragCoefficients.back());
-}
+std::vector<double> liftCoefficients = dragPolar.liftCoefficient;
+std::vector<double> dragCoefficients = dragPolar.dragCoefficient;
+std::vector<double> efficiencyAircraft = dragPolar.efficiency;
 
   Plot plotDragPolar(dragCoefficients, liftCoefficients,
                           "CD (-)",
@@ -0,0 +1,133 @@
+#define _HAS_STD_BYTE 0 // Risolve conflitto byte tra C++17 e Windows headers
+#define UNICODE         // Assicura che Windows usi le versioni wide delle strutture
+#define _UNICODE
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+#include "TabulatedInterpolant.h"
+#include "ChordCalculator.h"
+
+using namespace std;
+
+// Numero di controlli falliti, restituito da main
+static int failures = 0;
+
+static void check(bool condition, const string &name)
+{
+    cout << (condition ? "[PASS] " : "[FAIL] ") << name << endl;
+    if (!condition)
+    {
+        ++failures;
+    }
+}
+
+static bool near(double a, double b, double tol = 1e-12)
+{
+    return std::abs(a - b) <= tol * std::max(1.0, std::abs(b));
+}
+
+int main()
+{
+
+    //============================= Duplicate abscissae ==============================
+    // Tre campioni a x = 1: unione a coppie come il vecchio interpPchipLinearExtrap,
+    // ((2 + 4) / 2 + 8) / 2 = 5.5 (la media aritmetica darebbe 4.667)
+    {
+        TabulatedInterpolant table({0.0, 1.0, 2.0, 1.0, 1.0}, {0.0, 2.0, 2.0, 4.0, 8.0}, TabulatedMethod::LINEAR);
+        check(table.getXValues().size() == 3, "duplicates merged into one station");
+        check(near(table.evaluate(1.0), 5.5), "duplicates merged pairwise in input order");
+        check(near(table.evaluate(0.5), 2.75), "linear value next to a merged station");
+    }
+
+    //============================= Linear scheme ==============================
+    {
+        const vector<double> x = {0.0, 0.5, 1.5, 3.0};
+        const vector<double> y = {1.0, 2.0, 0.0, 3.0};
+        TabulatedInterpolant table(x, y, TabulatedMethod::LINEAR);
+
+        bool nodes = true;
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            nodes = nodes && near(table.evaluate(x[i]), y[i]);
+        }
+        check(nodes, "linear reproduces the samples");
+        check(!table.isUniform(), "irregular grid detected");
+        check(near(table.evaluate(1.0), 1.0), "linear value inside an interval");
+        check(near(table.evaluate(-1.0), -1.0), "linear extrapolation on the left edge secant");
+        check(near(table.evaluate(4.0), 5.0), "linear extrapolation on the right edge secant");
+
+        TabulatedInterpolant clamped(x, y, TabulatedMethod::LINEAR, TabulatedExtrapolation::CLAMP);
+        check(near(clamped.evaluate(4.0), 3.0), "clamped extrapolation holds the edge value");
+    }
+
+    //============================= Cubic schemes ==============================
+    {
+        // Dati lineari su griglia uniforme: PCHIP e spline naturale sono esatti
+        vector<double> x, y;
+        for (int i = 0; i <= 10; ++i)
+        {
+            x.push_back(0.1 * i);
+            y.push_back(3.0 * x.back() - 1.0);
+        }
+
+        TabulatedInterpolant pchip(x, y, TabulatedMethod::PCHIP);
+        TabulatedInterpolant spline(x, y, TabulatedMethod::NATURAL_SPLINE);
+        check(pchip.isUniform(), "uniform grid detected");
+        check(near(pchip.evaluate(0.437), 3.0 * 0.437 - 1.0, 1e-10), "PCHIP exact on linear data");
+        check(near(spline.evaluate(0.437), 3.0 * 0.437 - 1.0, 1e-10), "natural spline exact on linear data");
+
+        // Dati monotoni con un gradino: PCHIP non deve superare i campioni
+        TabulatedInterpolant step({0.0, 1.0, 2.0, 3.0}, {0.0, 0.0, 1.0, 1.0}, TabulatedMethod::PCHIP);
+        bool monotone = true;
+        double previous = step.evaluate(0.0);
+        for (int i = 1; i <= 300; ++i)
+        {
+            const double value = step.evaluate(0.01 * i);
+            monotone = monotone && value >= previous - 1e-15 && value >= 0.0 && value <= 1.0;
+            previous = value;
+        }
+        check(monotone, "PCHIP preserves monotonicity without overshoot");
+
+        // Tratti di estremità piatti: pendenza nulla agli estremi, la curva resta sui campioni
+        check(near(step.evaluate(0.5), 0.0) && near(step.evaluate(2.5), 1.0), "PCHIP keeps flat edge intervals flat");
+    }
+
+    //============================= ChordCalculator ==============================
+    {
+        VSP::Wing wing;
+        wing.typeOfWing = TypeOfWing::STRAIGHT_TAPERED;
+        wing.averageLeadingEdgeSweep = 25.0;
+        wing.totalProjectedSpan = 10.0;
+        wing.panelsYStation = {0.0, 2.0, 5.0};
+        wing.croot = {2.0, 1.5};
+        wing.ctip = {1.5, 1.0};
+
+        const ChordCalculator chordCalculator(wing);
+        check(near(chordCalculator.getChordAtEtaStation(0.0, wing.typeOfWing), 2.0), "root chord");
+        check(near(chordCalculator.getChordAtEtaStation(0.2, wing.typeOfWing), 1.75), "chord on the inner panel");
+        check(near(chordCalculator.getChordAtEtaStation(0.7, wing.typeOfWing), 1.25), "chord on the outer panel");
+        check(near(chordCalculator.getChordAtEtaStation(1.0, wing.typeOfWing), 1.0), "tip chord");
+
+        bool thrown = false;
+        try
+        {
+            chordCalculator.getChordAtEtaStation(1.5, wing.typeOfWing);
+        }
+        catch (const std::invalid_argument &)
+        {
+            thrown = true;
+        }
+        check(thrown, "station outside the span is rejected");
+
+        // Tipo diverso da quello della tabella: ellittica a freccia non nulla
+        const double kFactor = 1.0 - std::pow(1.0 / 2.0, 2);
+        check(near(chordCalculator.getChordAtEtaStation(0.6, TypeOfWing::ELLIPTICAL), 2.0 * std::sqrt(1.0 - kFactor * 0.36)),
+              "elliptical approximation for another type of wing");
+    }
+
+    cout << (failures == 0 ? "All tabulated interpolation tests passed" : "Some tabulated interpolation tests failed") << endl;
+    return failures == 0 ? 0 : 1;
+}